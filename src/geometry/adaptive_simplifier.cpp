@@ -0,0 +1,197 @@
+#include "geometry/adaptive_simplifier.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "geometry/mesh_simplifier.h"
+#include "geometry/vertex_clustering.h"
+
+namespace gfx {
+
+namespace {
+
+using Seconds = std::chrono::duration<float>;
+
+/** @brief The maximum number of triangles in the sample used to calibrate strategy predictions. */
+constexpr std::size_t kCalibrationFaceCount = 4096;
+
+/** @brief The number of candidates sampled for each edge contraction by the approximate strategy. */
+constexpr std::size_t kApproximateQueueSamples = 8;
+
+/** @brief Measured costs used to predict the duration of each strategy. */
+struct Calibration {
+  Seconds build_time_per_face{0.0f};
+  Seconds exact_time_per_contraction{0.0f};
+  Seconds approximate_time_per_contraction{0.0f};
+  Seconds cluster_time_per_face{0.0f};
+};
+
+/** @brief Gets the number of triangles to reduce a mesh below. */
+std::size_t GetTargetFaceCount(const std::size_t face_count, const float rate) {
+  if (rate < 0.0f || rate > 1.0f) {
+    throw std::invalid_argument{std::format("Invalid mesh simplification rate: {}", rate)};
+  }
+  return static_cast<std::size_t>((1.0f - rate) * static_cast<float>(face_count));
+}
+
+/** @brief Gets the number of edge contractions required to reduce a mesh to a target number of triangles. */
+float GetContractionCount(const std::size_t face_count, const std::size_t target_face_count) {
+  // each edge contraction removes two triangles
+  return static_cast<float>(face_count - std::min(face_count, target_face_count)) / 2.0f;
+}
+
+/** @brief Creates options for the mesh simplifier used by a strategy. */
+SimplifierOptions GetSimplifierOptions(const SimplificationStrategy strategy) {
+  SimplifierOptions options;
+  options.lock_boundary = true;
+  if (strategy == SimplificationStrategy::kApproximate) options.approximate_queue_samples = kApproximateQueueSamples;
+  return options;
+}
+
+/** @brief Creates a mesh from a prefix of the triangles in a mesh. */
+MeshData CreateSample(const MeshData& mesh, const std::size_t face_count) {
+  const auto& positions = mesh.positions();
+  const auto& indices = mesh.indices();
+  std::vector<glm::vec3> sample_positions;
+  std::vector<std::uint32_t> sample_indices;
+  std::unordered_map<std::uint32_t, std::uint32_t> index_map;
+
+  for (std::size_t i = 0; i < face_count * 3; ++i) {
+    const auto sample_index = static_cast<std::uint32_t>(sample_positions.size());
+    const auto [iterator, inserted] = index_map.try_emplace(indices[i], sample_index);
+    if (inserted) sample_positions.push_back(positions[indices[i]]);
+    sample_indices.push_back(iterator->second);
+  }
+
+  return MeshData{std::move(sample_positions), {}, {}, std::move(sample_indices)};
+}
+
+/**
+ * @brief Measures the cost of each strategy on a sample of a mesh.
+ * @param mesh The mesh to sample.
+ * @param rate The percentage of triangles to be removed from the sample.
+ * @return The measured cost of building simplification state, contracting edges, and clustering vertices.
+ */
+Calibration Calibrate(const MeshData& mesh, const float rate) {
+  const auto sample = CreateSample(mesh, std::min(mesh.indices().size() / 3, kCalibrationFaceCount));
+  const auto sample_face_count = static_cast<float>(sample.indices().size() / 3);
+  const auto target_face_count = GetTargetFaceCount(sample.indices().size() / 3, rate);
+  Calibration calibration;
+
+  for (const auto strategy : {SimplificationStrategy::kExact, SimplificationStrategy::kApproximate}) {
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    MeshSimplifier mesh_simplifier{sample, nullptr, GetSimplifierOptions(strategy)};
+    const auto build_time = std::chrono::high_resolution_clock::now();
+    mesh_simplifier.Simplify(target_face_count);
+    const auto end_time = std::chrono::high_resolution_clock::now();
+
+    // each edge contraction removes one vertex
+    const auto contraction_count = std::max<std::size_t>(
+        sample.positions().size() - mesh_simplifier.half_edge_mesh().vertices().size(), 1);
+    const auto time_per_contraction = Seconds{end_time - build_time} / static_cast<float>(contraction_count);
+
+    calibration.build_time_per_face += Seconds{build_time - start_time} / sample_face_count / 2.0f;
+    if (strategy == SimplificationStrategy::kExact) {
+      calibration.exact_time_per_contraction = time_per_contraction;
+    } else {
+      calibration.approximate_time_per_contraction = time_per_contraction;
+    }
+  }
+
+  const auto start_time = std::chrono::high_resolution_clock::now();
+  [[maybe_unused]] const auto clustered_sample =
+      mesh::ClusterVertices(sample, std::max<std::size_t>(sample.positions().size() / 4, 1));
+  const Seconds cluster_time = std::chrono::high_resolution_clock::now() - start_time;
+  calibration.cluster_time_per_face = cluster_time / sample_face_count;
+
+  return calibration;
+}
+
+/** @brief Simplifies a mesh with the exact or approximate strategy. */
+MeshData RunStrategy(const MeshData& mesh, const std::size_t target_face_count, const SimplificationStrategy strategy) {
+  MeshSimplifier mesh_simplifier{mesh, nullptr, GetSimplifierOptions(strategy)};
+  mesh_simplifier.Simplify(target_face_count);
+  return static_cast<MeshData>(mesh_simplifier.half_edge_mesh());
+}
+
+}  // namespace
+
+mesh::SimplificationJob mesh::SimplifyWithinBudget(const MeshData& mesh,
+                                                   const float rate,
+                                                   const std::chrono::duration<float> time_budget) {
+  const auto face_count = mesh.indices().size() / 3;
+  const auto target_face_count = GetTargetFaceCount(face_count, rate);
+
+  const auto calibration_start_time = std::chrono::high_resolution_clock::now();
+  const auto calibration = Calibrate(mesh, rate);
+  const Seconds calibration_time = std::chrono::high_resolution_clock::now() - calibration_start_time;
+
+  // predict the duration of each strategy by extrapolating measured costs to the size of the mesh
+  const auto contraction_count = GetContractionCount(face_count, target_face_count);
+  const auto build_time = calibration.build_time_per_face * static_cast<float>(face_count);
+  const auto exact_time = build_time + calibration.exact_time_per_contraction * contraction_count;
+  const auto approximate_time = build_time + calibration.approximate_time_per_contraction * contraction_count;
+
+  const auto get_clustered_time = [&](const std::size_t clustered_face_count) {
+    return calibration.cluster_time_per_face * static_cast<float>(face_count)
+           + calibration.build_time_per_face * static_cast<float>(clustered_face_count)
+           + calibration.exact_time_per_contraction * GetContractionCount(clustered_face_count, target_face_count);
+  };
+
+  SimplificationStrategy strategy{};
+  std::size_t clustered_face_count = 0;
+  Seconds predicted_time{0.0f};
+
+  if (exact_time <= time_budget) {
+    strategy = SimplificationStrategy::kExact;
+    predicted_time = exact_time;
+  } else if (approximate_time <= time_budget) {
+    strategy = SimplificationStrategy::kApproximate;
+    predicted_time = approximate_time;
+  } else {
+    // solve for the largest intermediate resolution whose exact edge contraction is predicted to finish in time
+    strategy = SimplificationStrategy::kClustered;
+    const auto cluster_time = calibration.cluster_time_per_face * static_cast<float>(face_count);
+    const auto time_per_face = calibration.build_time_per_face + calibration.exact_time_per_contraction / 2.0f;
+    const auto remaining_time = time_budget - cluster_time
+                                + calibration.exact_time_per_contraction * static_cast<float>(target_face_count) / 2.0f;
+    const auto max_face_count = time_per_face.count() > 0.0f ? std::max(remaining_time / time_per_face, 0.0f) : 0.0f;
+    clustered_face_count = std::clamp(static_cast<std::size_t>(max_face_count), target_face_count, face_count);
+    predicted_time = get_clustered_time(clustered_face_count);
+  }
+
+  const auto start_time = std::chrono::high_resolution_clock::now();
+  auto simplified_mesh = strategy == SimplificationStrategy::kClustered
+                             ? RunStrategy(ClusterVertices(mesh, std::max<std::size_t>(clustered_face_count / 2, 1)),
+                                           target_face_count,
+                                           SimplificationStrategy::kExact)
+                             : RunStrategy(mesh, target_face_count, strategy);
+  const Seconds actual_time = std::chrono::high_resolution_clock::now() - start_time;
+
+  std::clog << std::format(
+      "Mesh simplified from {} to {} triangles with the {} strategy in {} second (predicted {} second, budget {} "
+      "second, calibration {} second)\n",
+      face_count,
+      simplified_mesh.indices().size() / 3,
+      to_string(strategy),
+      actual_time.count(),
+      predicted_time.count(),
+      time_budget.count(),
+      calibration_time.count());
+
+  return SimplificationJob{.mesh = std::move(simplified_mesh),
+                           .strategy = strategy,
+                           .clustered_face_count = clustered_face_count,
+                           .predicted_time = predicted_time,
+                           .actual_time = actual_time,
+                           .calibration_time = calibration_time};
+}
+
+}  // namespace gfx
@@ -0,0 +1,80 @@
+#ifndef GEOMETRY_ADAPTIVE_SIMPLIFIER_H_
+#define GEOMETRY_ADAPTIVE_SIMPLIFIER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+#include "geometry/mesh_data.h"
+
+namespace gfx {
+
+/** @brief The algorithms available to simplify a mesh ordered from the highest to lowest quality. */
+enum class SimplificationStrategy {
+  /** @brief Edge contraction in order of increasing quadric error using an exact priority queue. */
+  kExact,
+
+  /** @brief Edge contraction using an approximate queue that samples a few candidates for each contraction. */
+  kApproximate,
+
+  /** @brief Vertex clustering to an intermediate resolution followed by exact edge contraction. */
+  kClustered
+};
+
+/** @brief Gets a human readable name for a mesh simplification strategy. */
+[[nodiscard]] constexpr std::string_view to_string(const SimplificationStrategy strategy) noexcept {
+  switch (strategy) {
+    case SimplificationStrategy::kExact:
+      return "exact";
+    case SimplificationStrategy::kApproximate:
+      return "approximate";
+    case SimplificationStrategy::kClustered:
+      return "clustered";
+  }
+  return "unknown";
+}
+
+namespace mesh {
+
+/** @brief A mesh simplified within a time budget and a record of how it was simplified. */
+struct SimplificationJob {
+  /** @brief The simplified mesh. */
+  MeshData mesh;
+
+  /** @brief The strategy selected to simplify the mesh. */
+  SimplificationStrategy strategy = SimplificationStrategy::kExact;
+
+  /** @brief The number of triangles after vertex clustering when the clustered strategy is selected. */
+  std::size_t clustered_face_count = 0;
+
+  /** @brief The predicted duration of the selected strategy excluding calibration. */
+  std::chrono::duration<float> predicted_time{0.0f};
+
+  /** @brief The actual duration of the selected strategy excluding calibration. */
+  std::chrono::duration<float> actual_time{0.0f};
+
+  /** @brief The duration of the calibration run used to predict the duration of each strategy. */
+  std::chrono::duration<float> calibration_time{0.0f};
+};
+
+/**
+ * @brief Reduces the number of triangles in a mesh with the highest quality strategy predicted to finish in time.
+ * @details Each strategy is timed on a small sample of the mesh to measure the cost of building simplification state
+ *          and contracting edges on the current machine. These measurements are extrapolated to the full mesh to
+ *          predict the duration of each strategy. The exact strategy is preferred, followed by the approximate
+ *          strategy. If neither is predicted to finish in time, the mesh is clustered to the largest intermediate
+ *          resolution from which exact edge contraction is predicted to finish in time.
+ * @param mesh The mesh to simplify. Vertices on a mesh boundary are locked.
+ * @param rate The percentage of triangles to be removed (e.g., .95 indicates 95% of triangles should be removed).
+ * @param time_budget The wall-clock time available to simplify the mesh excluding calibration.
+ * @return The simplified mesh and the selected strategy with its predicted and actual duration.
+ * @throw std::invalid_argument Thrown if the simplification rate is not in the interval [0,1].
+ * @note If no strategy is predicted to finish in time, the clustered strategy is used with the smallest intermediate
+ *       resolution and the predicted duration exceeds @p time_budget.
+ */
+SimplificationJob SimplifyWithinBudget(const MeshData& mesh, float rate, std::chrono::duration<float> time_budget);
+
+}  // namespace mesh
+}  // namespace gfx
+
+#endif  // GEOMETRY_ADAPTIVE_SIMPLIFIER_H_
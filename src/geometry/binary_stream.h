@@ -0,0 +1,81 @@
+#ifndef GEOMETRY_BINARY_STREAM_H_
+#define GEOMETRY_BINARY_STREAM_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace gfx::binary {
+
+/**
+ * @brief Writes a trivially copyable value to a binary stream in native byte order.
+ * @param os The stream to write to.
+ * @param value The value to write.
+ */
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+void Write(std::ostream& os, const T& value) {
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+/**
+ * @brief Writes a contiguous sequence of trivially copyable values to a binary stream preceded by its size.
+ * @param os The stream to write to.
+ * @param values The values to write.
+ */
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+void WriteArray(std::ostream& os, const std::span<const T> values) {
+  Write<std::uint64_t>(os, values.size());
+  os.write(reinterpret_cast<const char*>(values.data()),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+           static_cast<std::streamsize>(values.size_bytes()));
+}
+
+/**
+ * @brief Reads a trivially copyable value from a binary stream in native byte order.
+ * @param is The stream to read from.
+ * @return The value read from @p is.
+ * @throw std::runtime_error Thrown if the stream ends before the value could be read.
+ */
+template <typename T>
+  requires std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+T Read(std::istream& is) {
+  T value{};
+  is.read(reinterpret_cast<char*>(&value), sizeof(T));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  if (!is) throw std::runtime_error{"Unexpected end of binary stream"};
+  return value;
+}
+
+/**
+ * @brief Reads a contiguous sequence of trivially copyable values written by @c WriteArray.
+ * @param is The stream to read from.
+ * @return The values read from @p is.
+ * @throw std::runtime_error Thrown if the stream ends before every value could be read.
+ */
+template <typename T>
+  requires std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+std::vector<T> ReadArray(std::istream& is) {
+  const auto size = Read<std::uint64_t>(is);
+  std::vector<T> values;
+
+  // grow the result in bounded chunks so that a corrupt size fails on the end of the stream rather than on allocation
+  static constexpr std::uint64_t kChunkSize = 1u << 16u;
+  for (std::uint64_t offset = 0; offset < size; offset += kChunkSize) {
+    const auto chunk_size = std::min(kChunkSize, size - offset);
+    values.resize(static_cast<std::size_t>(offset + chunk_size));
+    is.read(reinterpret_cast<char*>(values.data() + offset),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            static_cast<std::streamsize>(chunk_size * sizeof(T)));
+    if (!is) throw std::runtime_error{"Unexpected end of binary stream"};
+  }
+
+  return values;
+}
+
+}  // namespace gfx::binary
+
+#endif  // GEOMETRY_BINARY_STREAM_H_
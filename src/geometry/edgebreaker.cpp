@@ -0,0 +1,674 @@
+#include "geometry/edgebreaker.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "geometry/binary_stream.h"
+#include "geometry/face.h"
+#include "geometry/half_edge.h"
+#include "geometry/half_edge_mesh.h"
+#include "geometry/vertex.h"
+
+namespace gfx {
+
+namespace {
+
+/** @brief Identifies a stream as a compressed mesh. */
+constexpr std::array kMagic{'G', 'F', 'X', 'E', 'B', 'R', 'K', '\0'};
+
+/** @brief The version of the compressed mesh format. */
+constexpr std::uint32_t kVersion = 1;
+
+/** @brief The error reported for any stream that could not have been written by @c edgebreaker::Encode. */
+constexpr auto kInvalidStream = "Invalid compressed mesh";
+
+/**
+ * @brief The operations that locate the third vertex of the triangle across the gate of the cut-border.
+ * @details Operations are ordered by how frequently they occur on typical meshes which determines their prefix code.
+ */
+enum class Operation : std::uint8_t {
+  kNewVertex,        // the vertex has not been encoded yet
+  kConnectForward,   // the vertex follows the gate in the cut-border
+  kConnectBackward,  // the vertex precedes the gate in the cut-border
+  kSkip,             // the gate is on a mesh boundary or the triangle across it has already been encoded
+  kSplit,            // the vertex is elsewhere in the loop of the gate which is split in two
+  kClose,            // the triangle closes a loop of three vertices
+  kReference         // the vertex is not in the loop of the gate and is referenced by its index
+};
+
+/** @brief The number of operations encoded by a unary prefix. Every other operation is encoded by a 2-bit suffix. */
+constexpr int kUnaryOperationCount = 3;
+
+/** @brief A position quantized to a uniform grid over the mesh bounding box. */
+using QuantizedPosition = std::array<std::int64_t, 3>;
+
+/** @brief Writes a sequence of bits packed from the least significant bit of each byte. */
+class BitWriter {
+public:
+  void Write(const bool bit) {
+    if (bit_count_ % 8 == 0) bytes_.push_back(0);
+    if (bit) bytes_.back() |= static_cast<std::uint8_t>(1u << (bit_count_ % 8));
+    ++bit_count_;
+  }
+
+  void Write(const std::uint32_t bits, const int length) {
+    for (auto i = 0; i < length; ++i) Write((bits >> static_cast<std::uint32_t>(i) & 1u) != 0);
+  }
+
+  [[nodiscard]] const std::vector<std::uint8_t>& bytes() const noexcept { return bytes_; }
+
+private:
+  std::vector<std::uint8_t> bytes_;
+  std::size_t bit_count_ = 0;
+};
+
+/** @brief Reads a sequence of bits written by @c BitWriter. */
+class BitReader {
+public:
+  explicit BitReader(const std::span<const std::uint8_t> bytes) noexcept : bytes_{bytes} {}
+
+  [[nodiscard]] bool Read() {
+    if (bit_index_ == bytes_.size() * 8) throw std::runtime_error{kInvalidStream};
+    const auto bit = (bytes_[bit_index_ / 8] >> (bit_index_ % 8) & 1u) != 0;
+    ++bit_index_;
+    return bit;
+  }
+
+  [[nodiscard]] std::uint32_t Read(const int length) {
+    std::uint32_t bits = 0;
+    for (auto i = 0; i < length; ++i) bits |= static_cast<std::uint32_t>(Read()) << static_cast<std::uint32_t>(i);
+    return bits;
+  }
+
+private:
+  std::span<const std::uint8_t> bytes_;
+  std::size_t bit_index_ = 0;
+};
+
+/** @brief Appends an unsigned integer using 7 bits per byte with the high bit indicating that another byte follows. */
+void WriteVarint(std::vector<std::uint8_t>& bytes, std::uint64_t value) {
+  for (; value >= 0x80; value >>= 7u) bytes.push_back(static_cast<std::uint8_t>(value | 0x80u));
+  bytes.push_back(static_cast<std::uint8_t>(value));
+}
+
+/** @brief Reads unsigned integers written by @c WriteVarint. */
+class VarintReader {
+public:
+  explicit VarintReader(const std::span<const std::uint8_t> bytes) noexcept : bytes_{bytes} {}
+
+  [[nodiscard]] std::uint64_t Read() {
+    std::uint64_t value = 0;
+    for (std::uint32_t shift = 0; shift < 64; shift += 7) {
+      if (offset_ == bytes_.size()) throw std::runtime_error{kInvalidStream};
+      const auto byte = bytes_[offset_++];
+      value |= static_cast<std::uint64_t>(byte & 0x7Fu) << shift;
+      if ((byte & 0x80u) == 0) return value;
+    }
+    throw std::runtime_error{kInvalidStream};
+  }
+
+private:
+  std::span<const std::uint8_t> bytes_;
+  std::size_t offset_ = 0;
+};
+
+/** @brief Maps a signed integer to an unsigned integer so that values of small magnitude have short varints. */
+std::uint64_t EncodeZigZag(const std::int64_t value) noexcept {
+  return static_cast<std::uint64_t>(value) << 1u ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+/** @brief Inverts @c EncodeZigZag. */
+std::int64_t DecodeZigZag(const std::uint64_t value) noexcept {
+  return static_cast<std::int64_t>(value >> 1u) ^ -static_cast<std::int64_t>(value & 1u);
+}
+
+/**
+ * @brief Predicts the position of the vertex across a gate edge by completing the parallelogram formed with the
+ *        triangle that contains the gate.
+ * @param u,v The positions of the gate edge vertices.
+ * @param opposite The position of the vertex opposite the gate in the encoded triangle that contains it.
+ */
+QuantizedPosition PredictParallelogram(const QuantizedPosition& u,
+                                       const QuantizedPosition& v,
+                                       const QuantizedPosition& opposite) noexcept {
+  return QuantizedPosition{u[0] + v[0] - opposite[0], u[1] + v[1] - opposite[1], u[2] + v[2] - opposite[2]};
+}
+
+/**
+ * @brief The boundary between encoded triangles and the rest of a connected component.
+ * @details The cut-border is a set of loops of vertices whose consecutive vertices are connected by the half-edges of
+ *          encoded triangles. The triangle across the gate of the current loop is encoded next, and the remaining
+ *          loops are kept on a stack. The encoder and decoder perform identical operations on the cut-border so that
+ *          the decoder can locate each triangle vertex from the operation alone.
+ */
+class CutBorder {
+public:
+  /** @brief A vertex in a loop and the cut-border edge to the vertex that follows it. */
+  struct Element {
+    std::uint32_t vertex = 0;
+    std::uint32_t opposite = 0;  // the vertex opposite the edge in the encoded triangle that contains it
+    int prev = -1;
+    int next = -1;
+    bool is_open = true;  // indicates if the triangle across the edge may still be encoded
+  };
+
+  /**
+   * @brief Starts a loop at the vertices of the seed triangle of a connected component.
+   * @return The element of @p v0 followed by the elements of @p v1 and @p v2.
+   */
+  int Start(const std::uint32_t v0, const std::uint32_t v1, const std::uint32_t v2) {
+    const auto e0 = static_cast<int>(elements_.size());
+    elements_.push_back(Element{.vertex = v0, .opposite = v2, .prev = e0 + 2, .next = e0 + 1, .is_open = true});
+    elements_.push_back(Element{.vertex = v1, .opposite = v0, .prev = e0, .next = e0 + 2, .is_open = true});
+    elements_.push_back(Element{.vertex = v2, .opposite = v1, .prev = e0 + 1, .next = e0, .is_open = true});
+    gate_ = e0;
+    return e0;
+  }
+
+  [[nodiscard]] bool has_gate() const noexcept { return gate_ != -1; }
+  [[nodiscard]] int gate() const noexcept { return gate_; }
+  [[nodiscard]] std::size_t size() const noexcept { return elements_.size(); }
+  [[nodiscard]] const Element& operator[](const int element) const noexcept { return elements_[element]; }
+
+  /** @brief Inserts a vertex after the gate and makes the edge from it to the next vertex the gate. */
+  int Insert(const std::uint32_t w) {
+    const auto x = gate_;
+    const auto y = elements_[x].next;
+    const auto n = static_cast<int>(elements_.size());
+    elements_.push_back(
+        Element{.vertex = w, .opposite = elements_[x].vertex, .prev = x, .next = y, .is_open = true});
+    Link(x, n, elements_[y].vertex);
+    elements_[y].prev = n;
+    gate_ = n;
+    return n;
+  }
+
+  /** @brief Removes the vertex that follows the gate whose edges are both edges of the encoded triangle. */
+  void ConnectForward() {
+    const auto x = gate_;
+    const auto y = elements_[x].next;
+    const auto z = elements_[y].next;
+    Link(x, z, elements_[y].vertex);
+    elements_[z].prev = x;
+  }
+
+  /** @brief Removes the gate vertex whose edges are both edges of the encoded triangle. */
+  void ConnectBackward() {
+    const auto x = gate_;
+    const auto p = elements_[x].prev;
+    const auto y = elements_[x].next;
+    Link(p, y, elements_[x].vertex);
+    elements_[y].prev = p;
+    gate_ = p;
+  }
+
+  /** @brief Removes the loop of the gate whose three edges are all edges of the encoded triangle. */
+  void Close() { PopLoop(); }
+
+  /**
+   * @brief Splits the loop of the gate at the vertex of the encoded triangle that is elsewhere in the loop.
+   * @param offset The number of elements from the element that follows the gate to the split vertex.
+   * @return The element of the split vertex added to the loop that continues from the gate.
+   */
+  int Split(const std::size_t offset) {
+    const auto x = gate_;
+    const auto y = elements_[x].next;
+    const auto z = Advance(y, offset);
+    const auto n = static_cast<int>(elements_.size());
+    elements_.push_back(Element{.vertex = elements_[z].vertex,
+                                .opposite = elements_[x].vertex,
+                                .prev = elements_[z].prev,
+                                .next = y,
+                                .is_open = true});
+    elements_[elements_[z].prev].next = n;
+    elements_[y].prev = n;
+    Link(x, z, elements_[y].vertex);
+    elements_[z].prev = x;
+
+    loops_.push_back(x);
+    gate_ = n;
+    return n;
+  }
+
+  /**
+   * @brief Closes the gate edge because there is no triangle across it to encode.
+   * @details An element between two closed edges is removed so that runs of closed edges never have to be traversed
+   *          to find the next gate.
+   */
+  void Skip() {
+    auto x = gate_;
+    elements_[x].is_open = false;
+    if (const auto p = elements_[x].prev; p != x && !elements_[p].is_open) {
+      Remove(x);
+      x = p;
+    }
+    if (const auto y = elements_[x].next; y != x && !elements_[y].is_open) Remove(y);
+
+    if (const auto y = elements_[x].next; elements_[y].is_open) {
+      gate_ = y;
+    } else {
+      PopLoop();
+    }
+  }
+
+  /**
+   * @brief Finds a vertex in the loop of the gate.
+   * @return The number of elements from the element that follows the gate to the first element of @p vertex or an
+   *         empty optional if the vertex is not in the loop.
+   */
+  [[nodiscard]] std::optional<std::size_t> Find(const std::uint32_t vertex) const {
+    const auto x = gate_;
+    std::size_t offset = 1;
+    for (auto element = elements_[elements_[x].next].next; element != x; element = elements_[element].next) {
+      if (elements_[element].vertex == vertex) return offset;
+      ++offset;
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * @brief Gets the element a number of elements after another element in the loop of the gate.
+   * @throw std::runtime_error Thrown if the gate is reached first.
+   */
+  [[nodiscard]] int Advance(int element, const std::size_t offset) const {
+    for (std::size_t i = 0; i < offset; ++i) {
+      element = elements_[element].next;
+      if (element == gate_) throw std::runtime_error{kInvalidStream};
+    }
+    return element;
+  }
+
+private:
+  /** @brief Connects an element to the next element with an edge of the encoded triangle opposite a vertex. */
+  void Link(const int element, const int next, const std::uint32_t opposite) noexcept {
+    elements_[element].next = next;
+    elements_[element].opposite = opposite;
+    elements_[element].is_open = true;
+  }
+
+  void Remove(const int element) noexcept {
+    const auto& removed = elements_[element];
+    elements_[removed.prev].next = removed.next;
+    elements_[removed.next].prev = removed.prev;
+  }
+
+  void PopLoop() noexcept {
+    if (loops_.empty()) {
+      gate_ = -1;
+    } else {
+      gate_ = loops_.back();
+      loops_.pop_back();
+    }
+  }
+
+  std::vector<Element> elements_;
+  std::vector<int> loops_;
+  int gate_ = -1;
+};
+
+/** @brief The uniform grid positions are quantized to. */
+struct Quantization {
+  glm::vec3 min{0.0f};
+  float step = 1.0f;
+  std::int64_t max_coordinate = 0;
+};
+
+/** @brief Encodes the connected components of a half-edge mesh one cut-border traversal at a time. */
+class MeshEncoder {
+public:
+  MeshEncoder(const HalfEdgeMesh& half_edge_mesh, const Quantization& quantization)
+      : half_edge_mesh_{half_edge_mesh}, quantization_{quantization} {
+    // seed components in a deterministic order independent of how faces are hashed
+    std::vector<const Face*> faces;
+    faces.reserve(half_edge_mesh.faces().size());
+    for (const auto& face : half_edge_mesh.faces() | std::views::values) faces.push_back(face.get());
+    std::ranges::sort(faces, {}, [](const Face* const face) {
+      return std::array{face->v0()->id(), face->v1()->id(), face->v2()->id()};
+    });
+
+    encoded_faces_.reserve(faces.size());
+    for (const auto* const face : faces) {
+      if (!encoded_faces_.contains(face)) EncodeComponent(*face);
+    }
+
+    // vertices without triangles are appended after every connected component
+    for (const auto& vertex : half_edge_mesh.vertices() | std::views::values) {
+      if (!vertex_indices_.contains(vertex->id())) AddVertex(*vertex, last_position_);
+    }
+  }
+
+  void Write(std::ostream& os) const {
+    binary::Write<std::uint64_t>(os, quantized_positions_.size());
+    binary::Write<std::uint64_t>(os, encoded_faces_.size());
+    binary::Write<std::uint64_t>(os, component_count_);
+    binary::WriteArray<std::uint8_t>(os, operations_.bytes());
+    binary::WriteArray<std::uint8_t>(os, integers_);
+    binary::WriteArray<std::uint8_t>(os, residuals_);
+  }
+
+private:
+  void EncodeComponent(const Face& face) {
+    ++component_count_;
+    encoded_faces_.insert(&face);
+
+    const auto v0 = face.v0();
+    const auto v1 = face.v1();
+    const auto v2 = face.v2();
+    const auto i0 = EncodeSeedVertex(*v0);
+    const auto i1 = EncodeSeedVertex(*v1);
+    const auto i2 = EncodeSeedVertex(*v2);
+    const auto e0 = border_.Start(i0, i1, i2);
+
+    const auto& edges = half_edge_mesh_.edges();
+    border_edges_.resize(border_.size());
+    border_edges_[e0] = edges.at(hash_value(*v0, *v1)).get();
+    border_edges_[e0 + 1] = edges.at(hash_value(*v1, *v2)).get();
+    border_edges_[e0 + 2] = edges.at(hash_value(*v2, *v0)).get();
+
+    while (border_.has_gate()) EncodeGate();
+  }
+
+  void EncodeGate() {
+    const auto x = border_.gate();
+    const auto y = border_[x].next;
+    const auto edge_vu = border_edges_[x]->flip();
+
+    if (edge_vu->is_boundary() || encoded_faces_.contains(edge_vu->face().get())) {
+      WriteOperation(Operation::kSkip);
+      border_.Skip();
+      return;
+    }
+    encoded_faces_.insert(edge_vu->face().get());
+
+    // the triangle across the gate from u to v is (v,u,w)
+    const auto edge_uw = edge_vu->next();
+    const auto edge_wv = edge_uw->next();
+    const auto& w = *edge_uw->vertex();
+
+    const auto iterator = vertex_indices_.find(w.id());
+    if (iterator == vertex_indices_.end()) {
+      WriteOperation(Operation::kNewVertex);
+      const auto& gate = border_[x];
+      const auto w_index = AddVertex(w,
+                                     PredictParallelogram(quantized_positions_[gate.vertex],
+                                                          quantized_positions_[border_[y].vertex],
+                                                          quantized_positions_[gate.opposite]));
+      SetBorderEdges(x, edge_uw, border_.Insert(w_index), edge_wv);
+      return;
+    }
+
+    const auto w_index = iterator->second;
+    const auto z = border_[y].next;
+    const auto p = border_[x].prev;
+    if (z != x && border_[z].next == x && border_[z].vertex == w_index) {
+      WriteOperation(Operation::kClose);
+      border_.Close();
+    } else if (z != x && border_[z].vertex == w_index) {
+      WriteOperation(Operation::kConnectForward);
+      border_.ConnectForward();
+      SetBorderEdge(x, edge_uw);
+    } else if (p != y && border_[p].vertex == w_index) {
+      WriteOperation(Operation::kConnectBackward);
+      border_.ConnectBackward();
+      SetBorderEdge(p, edge_wv);
+    } else if (const auto offset = border_.Find(w_index); offset.has_value()) {
+      WriteOperation(Operation::kSplit);
+      WriteVarint(integers_, *offset);
+      SetBorderEdges(x, edge_uw, border_.Split(*offset), edge_wv);
+    } else {
+      WriteOperation(Operation::kReference);
+      WriteVarint(integers_, w_index);
+      SetBorderEdges(x, edge_uw, border_.Insert(w_index), edge_wv);
+    }
+  }
+
+  /** @brief Encodes a vertex of the seed triangle of a connected component as a new vertex or a reference. */
+  std::uint32_t EncodeSeedVertex(const Vertex& vertex) {
+    if (const auto iterator = vertex_indices_.find(vertex.id()); iterator != vertex_indices_.end()) {
+      operations_.Write(true);
+      WriteVarint(integers_, iterator->second);
+      return iterator->second;
+    }
+    operations_.Write(false);
+    return AddVertex(vertex, last_position_);
+  }
+
+  /** @brief Assigns the next index to a vertex and encodes its quantized position relative to a prediction. */
+  std::uint32_t AddVertex(const Vertex& vertex, const QuantizedPosition& prediction) {
+    const auto index = static_cast<std::uint32_t>(quantized_positions_.size());
+    vertex_indices_.emplace(vertex.id(), index);
+
+    // clamp coordinates at the maximum extent which can round past the last grid point
+    const auto grid_position = (vertex.position() - quantization_.min) / quantization_.step;
+    QuantizedPosition position{};
+    for (glm::length_t i = 0; i < 3; ++i) {
+      position[i] = std::clamp<std::int64_t>(std::llround(grid_position[i]), 0, quantization_.max_coordinate);
+    }
+    for (std::size_t i = 0; i < position.size(); ++i) {
+      WriteVarint(residuals_, EncodeZigZag(position[i] - prediction[i]));
+    }
+
+    quantized_positions_.push_back(position);
+    last_position_ = position;
+    return index;
+  }
+
+  void WriteOperation(const Operation operation) {
+    const auto rank = static_cast<int>(operation);
+    for (auto i = 0; i < std::min(rank, kUnaryOperationCount); ++i) operations_.Write(true);
+    if (rank < kUnaryOperationCount) {
+      operations_.Write(false);
+    } else {
+      operations_.Write(static_cast<std::uint32_t>(rank - kUnaryOperationCount), 2);
+    }
+  }
+
+  void SetBorderEdge(const int element, const SharedHalfEdge& edge) {
+    border_edges_.resize(border_.size());
+    border_edges_[element] = edge.get();
+  }
+
+  void SetBorderEdges(const int e0, const SharedHalfEdge& edge0, const int e1, const SharedHalfEdge& edge1) {
+    SetBorderEdge(e0, edge0);
+    SetBorderEdge(e1, edge1);
+  }
+
+  const HalfEdgeMesh& half_edge_mesh_;
+  Quantization quantization_;
+
+  std::unordered_map<int, std::uint32_t> vertex_indices_;
+  std::vector<QuantizedPosition> quantized_positions_;
+  QuantizedPosition last_position_{};
+  std::unordered_set<const Face*> encoded_faces_;
+  std::uint64_t component_count_ = 0;
+
+  CutBorder border_;
+  std::vector<const HalfEdge*> border_edges_;  // the half-edge from each element to the element that follows it
+
+  BitWriter operations_;
+  std::vector<std::uint8_t> integers_;
+  std::vector<std::uint8_t> residuals_;
+};
+
+/** @brief Gets the uniform grid that quantizes every vertex position in a mesh to a number of bits. */
+Quantization GetQuantization(const HalfEdgeMesh& half_edge_mesh, const int quantization_bits) {
+  const auto max_coordinate = (std::int64_t{1} << quantization_bits) - 1;
+  if (half_edge_mesh.vertices().empty()) {
+    return Quantization{.min = glm::vec3{0.0f}, .step = 1.0f, .max_coordinate = max_coordinate};
+  }
+
+  glm::vec3 min{std::numeric_limits<float>::max()};
+  glm::vec3 max{std::numeric_limits<float>::lowest()};
+  for (const auto& vertex : half_edge_mesh.vertices() | std::views::values) {
+    min = glm::min(min, vertex->position());
+    max = glm::max(max, vertex->position());
+  }
+
+  const auto extent = max - min;
+  const auto max_extent = std::max({extent.x, extent.y, extent.z});
+  return Quantization{.min = min,
+                      .step = max_extent > 0.0f ? max_extent / static_cast<float>(max_coordinate) : 1.0f,
+                      .max_coordinate = max_coordinate};
+}
+
+}  // namespace
+
+void edgebreaker::Encode(std::ostream& os, const HalfEdgeMesh& half_edge_mesh, const int quantization_bits) {
+  if (quantization_bits < 1 || quantization_bits > kMaxQuantizationBits) {
+    throw std::invalid_argument{std::format("Invalid number of quantization bits: {}", quantization_bits)};
+  }
+
+  const auto quantization = GetQuantization(half_edge_mesh, quantization_bits);
+  const MeshEncoder mesh_encoder{half_edge_mesh, quantization};
+
+  os.write(kMagic.data(), kMagic.size());
+  binary::Write(os, kVersion);
+  binary::Write(os, half_edge_mesh.model_transform());
+  binary::Write<std::uint32_t>(os, static_cast<std::uint32_t>(quantization_bits));
+  binary::Write(os, quantization.min);
+  binary::Write(os, quantization.step);
+  mesh_encoder.Write(os);
+}
+
+edgebreaker::DecodedMesh edgebreaker::Decode(std::istream& is) {
+  std::array<char, kMagic.size()> magic{};
+  is.read(magic.data(), magic.size());
+  if (!is || magic != kMagic || binary::Read<std::uint32_t>(is) != kVersion) {
+    throw std::runtime_error{kInvalidStream};
+  }
+
+  DecodedMesh decoded_mesh;
+  decoded_mesh.model_transform = binary::Read<glm::mat4>(is);
+  const auto quantization_bits = binary::Read<std::uint32_t>(is);
+  const auto min = binary::Read<glm::vec3>(is);
+  const auto step = binary::Read<float>(is);
+  const auto vertex_count = binary::Read<std::uint64_t>(is);
+  const auto face_count = binary::Read<std::uint64_t>(is);
+  const auto component_count = binary::Read<std::uint64_t>(is);
+  const auto operation_bytes = binary::ReadArray<std::uint8_t>(is);
+  const auto integer_bytes = binary::ReadArray<std::uint8_t>(is);
+  const auto residual_bytes = binary::ReadArray<std::uint8_t>(is);
+
+  // every vertex has at least one byte per coordinate and every triangle at least one operation bit
+  if (quantization_bits < 1 || quantization_bits > static_cast<std::uint32_t>(kMaxQuantizationBits)
+      || vertex_count > residual_bytes.size() / 3 || face_count > operation_bytes.size() * 8
+      || component_count > face_count) {
+    throw std::runtime_error{kInvalidStream};
+  }
+
+  BitReader operations{operation_bytes};
+  VarintReader integers{integer_bytes};
+  VarintReader residuals{residual_bytes};
+  const auto max_coordinate = (std::int64_t{1} << quantization_bits) - 1;
+
+  std::vector<QuantizedPosition> quantized_positions;
+  quantized_positions.reserve(static_cast<std::size_t>(vertex_count));
+  QuantizedPosition last_position{};
+  const auto add_vertex = [&](const QuantizedPosition& prediction) {
+    if (quantized_positions.size() == vertex_count) throw std::runtime_error{kInvalidStream};
+    QuantizedPosition position{};
+    for (std::size_t i = 0; i < position.size(); ++i) {
+      position[i] = prediction[i] + DecodeZigZag(residuals.Read());
+      if (position[i] < 0 || position[i] > max_coordinate) throw std::runtime_error{kInvalidStream};
+    }
+    quantized_positions.push_back(position);
+    last_position = position;
+    return static_cast<std::uint32_t>(quantized_positions.size() - 1);
+  };
+  const auto read_vertex_index = [&] {
+    const auto index = integers.Read();
+    if (index >= quantized_positions.size()) throw std::runtime_error{kInvalidStream};
+    return static_cast<std::uint32_t>(index);
+  };
+  const auto read_operation = [&] {
+    auto rank = 0;
+    while (rank < kUnaryOperationCount && operations.Read()) ++rank;
+    if (rank == kUnaryOperationCount) rank += static_cast<int>(operations.Read(2));
+    return static_cast<Operation>(rank);
+  };
+
+  auto& indices = decoded_mesh.indices;
+  indices.reserve(static_cast<std::size_t>(face_count) * 3);
+  CutBorder border;
+
+  for (std::uint64_t component = 0; component < component_count; ++component) {
+    std::array<std::uint32_t, 3> seed{};
+    for (auto& vertex : seed) vertex = operations.Read() ? read_vertex_index() : add_vertex(last_position);
+    indices.insert(indices.end(), seed.begin(), seed.end());
+    border.Start(seed[0], seed[1], seed[2]);
+
+    while (border.has_gate()) {
+      const auto x = border.gate();
+      const auto y = border[x].next;
+      const auto u = border[x].vertex;
+      const auto v = border[y].vertex;
+      std::uint32_t w = 0;
+
+      switch (read_operation()) {
+        case Operation::kNewVertex:
+          w = add_vertex(PredictParallelogram(
+              quantized_positions[u], quantized_positions[v], quantized_positions[border[x].opposite]));
+          border.Insert(w);
+          break;
+        case Operation::kConnectForward:
+          if (border[y].next == x) throw std::runtime_error{kInvalidStream};
+          w = border[border[y].next].vertex;
+          border.ConnectForward();
+          break;
+        case Operation::kConnectBackward:
+          if (border[x].prev == y) throw std::runtime_error{kInvalidStream};
+          w = border[border[x].prev].vertex;
+          border.ConnectBackward();
+          break;
+        case Operation::kSkip:
+          border.Skip();
+          continue;
+        case Operation::kSplit: {
+          const auto offset = integers.Read();
+          if (offset == 0 || offset >= border.size()) throw std::runtime_error{kInvalidStream};
+          w = border[border.Advance(y, static_cast<std::size_t>(offset))].vertex;
+          border.Split(static_cast<std::size_t>(offset));
+          break;
+        }
+        case Operation::kClose:
+          if (const auto z = border[y].next; z == x || border[z].next != x) throw std::runtime_error{kInvalidStream};
+          w = border[border[y].next].vertex;
+          border.Close();
+          break;
+        case Operation::kReference:
+          w = read_vertex_index();
+          border.Insert(w);
+          break;
+      }
+
+      if (indices.size() == face_count * 3) throw std::runtime_error{kInvalidStream};
+      indices.insert(indices.end(), {v, u, w});
+    }
+  }
+
+  while (quantized_positions.size() < vertex_count) add_vertex(last_position);
+  if (indices.size() != face_count * 3) throw std::runtime_error{kInvalidStream};
+
+  decoded_mesh.positions.reserve(quantized_positions.size());
+  for (const auto& [x, y, z] : quantized_positions) {
+    const glm::vec3 grid_position{static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)};
+    decoded_mesh.positions.push_back(min + grid_position * step);
+  }
+
+  return decoded_mesh;
+}
+
+}  // namespace gfx
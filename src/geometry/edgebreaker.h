@@ -0,0 +1,63 @@
+#ifndef GEOMETRY_EDGEBREAKER_H_
+#define GEOMETRY_EDGEBREAKER_H_
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+namespace gfx {
+class HalfEdgeMesh;
+
+namespace edgebreaker {
+
+/** @brief The default number of bits each quantized position coordinate is stored with. */
+constexpr int kDefaultQuantizationBits = 16;
+
+/** @brief The maximum number of bits a quantized position coordinate can be stored with in a float. */
+constexpr int kMaxQuantizationBits = 24;
+
+/** @brief Vertex positions and triangle indices decoded from a compressed mesh. */
+struct DecodedMesh {
+  std::vector<glm::vec3> positions;
+  std::vector<std::uint32_t> indices;
+  glm::mat4 model_transform{1.0f};
+};
+
+/**
+ * @brief Compresses the connectivity and vertex positions of a half-edge mesh.
+ * @details Each connected component is traversed from a seed triangle by following the @c next and @c flip
+ *          half-edges of a cut-border that separates encoded triangles from the rest of the mesh. Each triangle
+ *          across the cut-border is encoded as the operation that locates its third vertex which takes about 2 bits
+ *          per triangle on typical meshes. Positions are quantized to a uniform grid over the mesh bounding box and
+ *          each new vertex is predicted from the triangle across its gate edge by the parallelogram rule, so only small
+ *          residuals are stored. Boundaries, handles, and non-manifold vertices are supported at a small additional
+ *          cost. Wedge attributes are not stored.
+ * @param os The binary stream to write to.
+ * @param half_edge_mesh The mesh to compress.
+ * @param quantization_bits The number of bits each position coordinate is quantized to.
+ * @throw std::invalid_argument Thrown if @p quantization_bits is not in [1, @c kMaxQuantizationBits].
+ * @see "Edgebreaker: Connectivity Compression for Triangle Meshes" by Jarek Rossignac (1999).
+ * @see "Real Time Compression of Triangle Mesh Connectivity" by Stefan Gumhold and Wolfgang Straßer (1998).
+ */
+void Encode(std::ostream& os,
+            const HalfEdgeMesh& half_edge_mesh,
+            int quantization_bits = kDefaultQuantizationBits);
+
+/**
+ * @brief Decompresses a mesh written by @c Encode.
+ * @param is The binary stream to read from.
+ * @return The dequantized positions and triangles of the mesh. Vertices are ordered by the traversal that encoded
+ *         them and triangles keep their winding order. The result can be passed directly to a @c HalfEdgeMesh or
+ *         @c MeshData constructor.
+ * @throw std::runtime_error Thrown if the stream ends early or does not contain a valid compressed mesh.
+ */
+[[nodiscard]] DecodedMesh Decode(std::istream& is);
+
+}  // namespace edgebreaker
+}  // namespace gfx
+
+#endif  // GEOMETRY_EDGEBREAKER_H_
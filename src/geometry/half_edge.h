@@ -58,6 +58,18 @@ public:
     return face_.lock();
   }
 
+  /**
+   * @brief Gets the ID of the wedge that stores attributes for the triangle corner at the head of this half-edge.
+   * @return The wedge ID or -1 if the mesh does not have vertex attributes.
+   */
+  [[nodiscard]] int wedge() const noexcept { return wedge_; }
+
+  /** @brief Sets the wedge ID of the triangle corner at the head of this half-edge. */
+  void set_wedge(const int wedge) noexcept { wedge_ = wedge; }
+
+  /** @brief Determines if this half-edge lies on a mesh boundary (i.e., it is not part of any triangle). */
+  [[nodiscard]] bool is_boundary() const noexcept { return face_.expired(); }
+
   /** @brief Sets the half-edge face. */
   void set_face(const std::shared_ptr<Face>& face) noexcept {
 #ifndef NDEBUG
@@ -92,6 +104,7 @@ private:
   std::weak_ptr<Vertex> vertex_;
   std::weak_ptr<HalfEdge> next_, flip_;
   std::weak_ptr<Face> face_;
+  int wedge_ = -1;
 };
 
 // defined here to avoid cyclical dependency
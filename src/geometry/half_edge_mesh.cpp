@@ -1,21 +1,54 @@
 #include "geometry/half_edge_mesh.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
+#include <format>
+#include <numeric>
 #include <ranges>
+#include <span>
+#include <stdexcept>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
-#include <glm/vec3.hpp>
+#include <glm/glm.hpp>
+#include <glm/gtx/hash.hpp>
 
+#include "geometry/binary_stream.h"
 #include "geometry/face.h"
 #include "geometry/half_edge.h"
+#include "geometry/mesh_data.h"
 #include "geometry/vertex.h"
-#include "graphics/mesh.h"
 
 namespace gfx {
 
 namespace {
 
+/** @brief A vertex as it is written to a binary stream. */
+struct VertexRecord {
+  int id;
+
+  /** @brief The ID of the vertex at the tail of the half-edge this vertex refers to or -1 if it has no edges. */
+  int edge_tail_id;
+
+  glm::vec3 position;
+};
+
+/** @brief A triangle as it is written to a binary stream. */
+struct FaceRecord {
+  std::array<int, 3> vertex_ids;
+
+  /** @brief The wedge ID of each triangle corner or -1 if the mesh does not have attributes. */
+  std::array<int, 3> wedge_ids;
+};
+
+/** @brief Gets a key which uniquely identifies a directed edge between two vertices. */
+std::uint64_t GetEdgeKey(const int v0, const int v1) noexcept {
+  return static_cast<std::uint64_t>(static_cast<std::uint32_t>(v0)) << 32u | static_cast<std::uint32_t>(v1);  // NOLINT
+}
+
 /**
  * @brief Creates a new half-edge and its associated flip edge.
  * @param v0,v1 The half-edge vertices.
@@ -51,16 +84,23 @@ std::shared_ptr<HalfEdge> CreateHalfEdge(const std::shared_ptr<Vertex>& v0,
  * @brief Creates a new triangle in the half-edge mesh.
  * @param v0,v1,v2 The triangle vertices in counter-clockwise order.
  * @param edges A mapping of mesh half-edges by hash key.
+ * @param wedges The wedge IDs of the triangle corners at @p v0, @p v1, @p v2.
  * @return A triangle face representing vertices @p v0, @p v1, @p v2 in the half-edge mesh.
  */
 std::shared_ptr<Face> CreateTriangle(const std::shared_ptr<Vertex>& v0,
                                      const std::shared_ptr<Vertex>& v1,
                                      const std::shared_ptr<Vertex>& v2,
-                                     std::unordered_map<std::size_t, std::shared_ptr<HalfEdge>>& edges) {
+                                     std::unordered_map<std::size_t, std::shared_ptr<HalfEdge>>& edges,
+                                     const std::array<int, 3>& wedges = {-1, -1, -1}) {
   const auto edge01 = CreateHalfEdge(v0, v1, edges);
   const auto edge12 = CreateHalfEdge(v1, v2, edges);
   const auto edge20 = CreateHalfEdge(v2, v0, edges);
 
+  // each half-edge stores the wedge of the triangle corner it points to
+  edge20->set_wedge(wedges[0]);
+  edge01->set_wedge(wedges[1]);
+  edge12->set_wedge(wedges[2]);
+
   v0->set_edge(edge20);
   v1->set_edge(edge01);
   v2->set_edge(edge12);
@@ -133,6 +173,7 @@ void DeleteFace(const Face& face, std::unordered_map<std::size_t, std::shared_pt
  * @param v_start The vertex opposite of @p v_target representing the first half-edge to process.
  * @param v_end The vertex opposite of @p v_target representing the last half-edge to process.
  * @param v_new The new vertex to attach edges to.
+ * @param wedge_map A mapping of wedge IDs at @p v_target to the wedge IDs that replace them at @p v_new.
  * @param edges A mapping of mesh half-edges by hash key.
  * @param faces A mapping of mesh faces by hash key.
  */
@@ -140,6 +181,7 @@ void UpdateIncidentEdges(const Vertex& v_target,
                          const Vertex& v_start,
                          const Vertex& v_end,
                          const std::shared_ptr<Vertex>& v_new,
+                         const std::unordered_map<int, int>& wedge_map,
                          std::unordered_map<std::size_t, std::shared_ptr<HalfEdge>>& edges,
                          std::unordered_map<std::size_t, std::shared_ptr<Face>>& faces) {
   const auto edge_start = GetHalfEdge(v_target, v_start, edges);
@@ -152,7 +194,10 @@ void UpdateIncidentEdges(const Vertex& v_target,
     const auto vi = edge0i->vertex();
     const auto vj = edgeij->vertex();
 
-    auto face_new = CreateTriangle(v_new, vi, vj, edges);
+    const auto wedge_iterator = wedge_map.find(edgej0->wedge());
+    const auto wedge_new = wedge_iterator == wedge_map.end() ? edgej0->wedge() : wedge_iterator->second;
+
+    auto face_new = CreateTriangle(v_new, vi, vj, edges, {wedge_new, edge0i->wedge(), edgeij->wedge()});
     assert(!faces.contains(hash_value(*face_new)));
     faces.emplace(hash_value(*face_new), std::move(face_new));
 
@@ -166,71 +211,486 @@ void UpdateIncidentEdges(const Vertex& v_target,
 }
 
 /**
- * @brief Computes a vertex normal by averaging its face normals weighted by surface area.
- * @param v0 The vertex to compute the normal for.
- * @return The weighted vertex normal.
+ * @brief Assigns a separate vertex to each fan of triangles around a vertex.
+ * @details Triangles at a vertex belong to the same fan if they are connected by edges incident to that vertex. Welding
+ *          surfaces that touch at a single point creates a vertex with more than one fan whose edges cannot all be
+ *          reached by circulating the vertex. Each fan after the first is assigned the smallest original index among
+ *          its corners that is not already a vertex ID. A fan without such an index, which only occurs if the mesh
+ *          was not manifold before welding, keeps its vertex.
+ * @param indices Element indices where consecutive triples define a triangle face in the mesh.
+ * @param corner_vertex_ids The vertex ID of each element in @p indices which is updated in place.
  */
-glm::vec3 ComputeWeightedVertexNormal(const Vertex& v0) {
-  glm::vec3 normal{0.0f};
-  auto edgei0 = v0.edge();
-  do {
-    const auto& face = edgei0->face();
-    normal += face->normal() * face->area();
-    edgei0 = edgei0->next()->flip();
-  } while (edgei0 != v0.edge());
-  return glm::normalize(normal);
+void SplitFans(const std::span<const std::uint32_t> indices, std::vector<int>& corner_vertex_ids) {
+  std::vector<std::size_t> parents(corner_vertex_ids.size());
+  std::iota(parents.begin(), parents.end(), 0);
+  const auto find_root = [&](std::size_t corner) {
+    while (parents[corner] != corner) corner = parents[corner] = parents[parents[corner]];
+    return corner;
+  };
+
+  // corners at the same vertex are in the same fan if their triangles share an edge incident to that vertex
+  std::unordered_map<std::uint64_t, std::size_t> spoke_corners;
+  for (std::size_t i = 0; i < corner_vertex_ids.size(); ++i) {
+    const auto face = i - i % 3;
+    for (const auto j : {face + (i + 1) % 3, face + (i + 2) % 3}) {
+      const auto spoke_key = GetEdgeKey(corner_vertex_ids[i], corner_vertex_ids[j]);
+      if (const auto [iterator, inserted] = spoke_corners.try_emplace(spoke_key, i); !inserted) {
+        parents[find_root(i)] = find_root(iterator->second);
+      }
+    }
+  }
+
+  std::unordered_map<std::size_t, std::vector<std::size_t>> fans;
+  std::map<int, std::vector<std::size_t>> vertex_fans;
+  for (std::size_t i = 0; i < corner_vertex_ids.size(); ++i) {
+    const auto [iterator, inserted] = fans.try_emplace(find_root(i));
+    if (inserted) vertex_fans[corner_vertex_ids[i]].push_back(iterator->first);
+    iterator->second.push_back(i);
+  }
+
+  std::unordered_set<int> vertex_ids{corner_vertex_ids.begin(), corner_vertex_ids.end()};
+  for (const auto& roots : vertex_fans | std::views::values) {
+    for (const auto root : roots | std::views::drop(1)) {
+      const auto& corners = fans.at(root);
+      auto vertex_id = -1;
+      for (const auto corner : corners) {
+        if (const auto index = static_cast<int>(indices[corner]);
+            !vertex_ids.contains(index) && (vertex_id == -1 || index < vertex_id)) {
+          vertex_id = index;
+        }
+      }
+      if (vertex_id == -1) continue;
+      vertex_ids.insert(vertex_id);
+      for (const auto corner : corners) corner_vertex_ids[corner] = vertex_id;
+    }
+  }
+}
+
+/**
+ * @brief Gets the ID of the half-edge mesh vertex that each triangle corner is assigned to.
+ * @param positions The mesh vertex positions.
+ * @param has_attributes Indicates if the mesh has texture coordinates or normals in which case vertices that share a
+ *                       position are welded.
+ * @param indices Element indices where consecutive triples define a triangle face in the mesh.
+ * @return The vertex ID of each element in @p indices.
+ * @see HalfEdgeMesh::GetCornerVertexIds
+ */
+std::vector<int> GetCornerVertexIds(const std::span<const glm::vec3> positions,
+                                    const bool has_attributes,
+                                    const std::span<const std::uint32_t> indices) {
+  std::vector<int> corner_vertex_ids{indices.begin(), indices.end()};
+  if (!has_attributes) return corner_vertex_ids;
+
+  // obj files index positions and attributes separately so loading them splits vertices at every attribute seam
+  std::unordered_map<glm::vec3, int> position_ids;
+  std::vector<int> welded_ids;
+  welded_ids.reserve(positions.size());
+  for (auto i = 0; std::cmp_less(i, positions.size()); ++i) {
+    welded_ids.push_back(position_ids.try_emplace(positions[i], i).first->second);
+  }
+
+  std::unordered_set<std::uint64_t> edges;
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    std::array face{welded_ids[indices[i]], welded_ids[indices[i + 1]], welded_ids[indices[i + 2]]};
+    const auto is_degenerate = face[0] == face[1] || face[1] == face[2] || face[2] == face[0];
+    if (is_degenerate || edges.contains(GetEdgeKey(face[0], face[1])) || edges.contains(GetEdgeKey(face[1], face[2]))
+        || edges.contains(GetEdgeKey(face[2], face[0]))) {
+      // welding vertices of this triangle cannot be represented by a half-edge mesh
+      face = {corner_vertex_ids[i], corner_vertex_ids[i + 1], corner_vertex_ids[i + 2]};
+    }
+    edges.insert({GetEdgeKey(face[0], face[1]), GetEdgeKey(face[1], face[2]), GetEdgeKey(face[2], face[0])});
+    std::ranges::copy(face, corner_vertex_ids.begin() + static_cast<std::ptrdiff_t>(i));
+  }
+
+  SplitFans(indices, corner_vertex_ids);
+  return corner_vertex_ids;
+}
+
+/**
+ * @brief Gets the faces of a half-edge mesh in a deterministic order.
+ * @details Faces are stored in a hash table whose iteration order depends on the standard library and on the history
+ *          of insertions and removals. Sorting faces by their vertex IDs ensures that equal half-edge meshes are always
+ *          converted to identical triangle meshes.
+ * @param half_edge_mesh The half-edge mesh to evaluate.
+ * @return The faces of @p half_edge_mesh sorted lexicographically by vertex ID.
+ */
+std::vector<const Face*> GetOrderedFaces(const HalfEdgeMesh& half_edge_mesh) {
+  std::vector<std::pair<std::array<int, 3>, const Face*>> faces;
+  faces.reserve(half_edge_mesh.faces().size());
+  for (const auto& face : half_edge_mesh.faces() | std::views::values) {
+    faces.emplace_back(std::array{face->v0()->id(), face->v1()->id(), face->v2()->id()}, face.get());
+  }
+  std::ranges::sort(faces, {}, [](const auto& face) { return face.first; });
+
+  const auto ordered_faces = faces | std::views::values;
+  return std::vector<const Face*>{ordered_faces.begin(), ordered_faces.end()};
+}
+
+/**
+ * @brief Gets the wedge of each triangle corner in a half-edge mesh.
+ * @param half_edge_mesh The half-edge mesh to evaluate.
+ * @return Distinct pairs of vertex and wedge IDs sorted by vertex ID and then by wedge ID.
+ */
+std::vector<std::pair<int, int>> GetVertexWedges(const HalfEdgeMesh& half_edge_mesh) {
+  std::vector<std::pair<int, int>> vertex_wedges;
+  vertex_wedges.reserve(half_edge_mesh.edges().size());
+  for (const auto& edge : half_edge_mesh.edges() | std::views::values) {
+    if (!edge->is_boundary()) vertex_wedges.emplace_back(edge->vertex()->id(), edge->wedge());
+  }
+  std::ranges::sort(vertex_wedges);
+  const auto [first, last] = std::ranges::unique(vertex_wedges);
+  vertex_wedges.erase(first, last);
+  return vertex_wedges;
+}
+
+/**
+ * @brief Creates a triangle mesh with one vertex for each wedge in a half-edge mesh.
+ * @details Attribute seams are split exactly as they were in the original mesh. Normals are taken from wedges when
+ *          available and are otherwise averaged from incident faces weighted by surface area.
+ * @param half_edge_mesh The half-edge mesh to convert which must have wedges.
+ * @param model_transform The model transform of the mesh.
+ * @return A triangle mesh with texture coordinates if @p half_edge_mesh has them and normals.
+ */
+MeshData CreateWedgeMesh(const HalfEdgeMesh& half_edge_mesh, const glm::mat4& model_transform) {
+  const auto& wedges = half_edge_mesh.wedges();
+  const auto vertex_wedges = GetVertexWedges(half_edge_mesh);
+
+  const auto faces = GetOrderedFaces(half_edge_mesh);
+
+  std::unordered_map<int, glm::vec3> vertex_normals;
+  if (!half_edge_mesh.has_normals()) {
+    for (const auto* const face : faces) {
+      for (const auto& vertex : {face->v0(), face->v1(), face->v2()}) {
+        vertex_normals[vertex->id()] += face->normal() * face->area();
+      }
+    }
+  }
+
+  std::vector<glm::vec3> positions, normals;
+  std::vector<glm::vec2> texcoords;
+  positions.reserve(vertex_wedges.size());
+  normals.reserve(vertex_wedges.size());
+  if (half_edge_mesh.has_texcoords()) texcoords.reserve(vertex_wedges.size());
+
+  std::unordered_map<std::uint64_t, std::uint32_t> index_map;
+  index_map.reserve(vertex_wedges.size());
+
+  for (std::uint32_t i = 0; const auto& [vertex_id, wedge_id] : vertex_wedges) {
+    const auto& wedge = wedges[static_cast<std::size_t>(wedge_id)];
+    positions.push_back(half_edge_mesh.vertices().at(vertex_id)->position());
+    if (half_edge_mesh.has_texcoords()) texcoords.push_back(wedge.texcoord);
+
+    // normals are interpolated linearly during simplification and must be renormalized
+    const auto& normal = half_edge_mesh.has_normals() ? wedge.normal : vertex_normals.at(vertex_id);
+    normals.push_back(glm::length(normal) > 0.0f ? glm::normalize(normal) : normal);
+    index_map.emplace(GetEdgeKey(vertex_id, wedge_id), i++);
+  }
+
+  std::vector<std::uint32_t> indices;
+  indices.reserve(faces.size() * 3);
+
+  for (const auto* const face : faces) {
+    // visit triangle corners in the same order as face vertices starting from the half-edge pointing to v0
+    auto edge = GetHalfEdge(*face->v0(), *face->v1(), half_edge_mesh.edges())->next()->next();
+    for (const auto& vertex : {face->v0(), face->v1(), face->v2()}) {
+      indices.push_back(index_map.at(GetEdgeKey(vertex->id(), edge->wedge())));
+      edge = edge->next();
+    }
+  }
+
+  return MeshData{std::move(positions), std::move(normals), std::move(texcoords), std::move(indices), model_transform};
 }
 
 }  // namespace
 
-HalfEdgeMesh::HalfEdgeMesh(const Mesh& mesh) : model_transform_{mesh.model_transform()} {
-  const auto& positions = mesh.positions();
-  const auto& indices = mesh.indices();
+std::vector<int> HalfEdgeMesh::GetCornerVertexIds(const MeshData& mesh) {
+  return gfx::GetCornerVertexIds(
+      mesh.positions(), !mesh.texcoords().empty() || !mesh.normals().empty(), mesh.indices());
+}
+
+HalfEdgeMesh::HalfEdgeMesh(const MeshData& mesh)
+    : HalfEdgeMesh{mesh.positions(), mesh.normals(), mesh.texcoords(), mesh.indices(), mesh.model_transform()} {}
+
+HalfEdgeMesh::HalfEdgeMesh(const std::span<const glm::vec3> positions,
+                           const std::span<const glm::vec3> normals,
+                           const std::span<const glm::vec2> texcoords,
+                           const std::span<const std::uint32_t> indices,
+                           const glm::mat4& model_transform)
+    : has_texcoords_{!texcoords.empty()}, has_normals_{!normals.empty()}, model_transform_{model_transform} {
+  if (indices.size() % 3 != 0) {
+    throw std::invalid_argument{std::format("Invalid number of triangle indices: {}", indices.size())};
+  }
+  if (const auto iterator = std::ranges::find_if(indices, [&](const auto index) { return index >= positions.size(); });
+      iterator != indices.end()) {
+    throw std::invalid_argument{std::format("Triangle index {} refers to a vertex that does not exist", *iterator)};
+  }
+  if ((has_texcoords_ && texcoords.size() != positions.size())
+      || (has_normals_ && normals.size() != positions.size())) {
+    throw std::invalid_argument{"Vertex attributes must align with position data"};
+  }
 
+  const auto corner_vertex_ids = gfx::GetCornerVertexIds(positions, has_texcoords_ || has_normals_, indices);
+
+  if (has_texcoords_ || has_normals_) {
+    wedges_.reserve(positions.size());
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+      wedges_.push_back(Wedge{.texcoord = has_texcoords_ ? texcoords[i] : glm::vec2{0.0f},
+                              .normal = has_normals_ ? normals[i] : glm::vec3{0.0f}});
+    }
+  }
+
+  // vertices without any triangles are kept unless they were welded into another vertex
+  std::vector<bool> is_welded(positions.size(), false);
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    if (std::cmp_not_equal(corner_vertex_ids[i], indices[i])) {
+      is_welded[indices[i]] = true;
+      welded_vertices_.emplace(static_cast<int>(indices[i]), corner_vertex_ids[i]);
+    }
+  }
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    if (std::cmp_equal(corner_vertex_ids[i], indices[i])) is_welded[indices[i]] = false;
+  }
   for (auto i = 0; std::cmp_less(i, positions.size()); ++i) {
-    vertices_.emplace(i, std::make_shared<Vertex>(i, positions[i]));
+    if (!is_welded[static_cast<std::size_t>(i)]) vertices_.emplace(i, std::make_shared<Vertex>(i, positions[i]));
   }
 
+  // a mesh vertex referred to by triangles at more than one vertex needs a separate wedge for each vertex
+  std::vector<int> wedge_vertex_ids(wedges_.size(), -1);
+  std::unordered_map<std::uint64_t, int> split_wedges;
+  const auto get_wedge = [&](const std::size_t corner) {
+    if (wedges_.empty()) return -1;
+    const auto index = static_cast<int>(indices[corner]);
+    auto& wedge_vertex_id = wedge_vertex_ids[indices[corner]];
+    if (wedge_vertex_id == -1) wedge_vertex_id = corner_vertex_ids[corner];
+    if (wedge_vertex_id == corner_vertex_ids[corner]) return index;
+
+    const auto [iterator, inserted] = split_wedges.try_emplace(GetEdgeKey(index, corner_vertex_ids[corner]), -1);
+    if (inserted) iterator->second = AddWedge(Wedge{wedges_[indices[corner]]});
+    return iterator->second;
+  };
+
   for (std::size_t i = 0; i < indices.size(); i += 3) {
-    const auto& v0 = vertices_[static_cast<int>(indices[i])];
-    const auto& v1 = vertices_[static_cast<int>(indices[i + 1])];
-    const auto& v2 = vertices_[static_cast<int>(indices[i + 2])];
-    auto face012 = CreateTriangle(v0, v1, v2, edges_);
+    const auto& v0 = vertices_.at(corner_vertex_ids[i]);
+    const auto& v1 = vertices_.at(corner_vertex_ids[i + 1]);
+    const auto& v2 = vertices_.at(corner_vertex_ids[i + 2]);
+    auto face012 = CreateTriangle(v0, v1, v2, edges_, {get_wedge(i), get_wedge(i + 1), get_wedge(i + 2)});
     faces_.emplace(hash_value(*face012), std::move(face012));
   }
 }
 
-HalfEdgeMesh::operator Mesh() const {
+HalfEdgeMesh::HalfEdgeMesh(std::istream& is)
+    : has_texcoords_{binary::Read<bool>(is)},
+      has_normals_{binary::Read<bool>(is)},
+      model_transform_{binary::Read<glm::mat4>(is)} {
+  const auto vertex_records = binary::ReadArray<VertexRecord>(is);
+  const auto face_records = binary::ReadArray<FaceRecord>(is);
+  const auto locked_vertex_ids = binary::ReadArray<int>(is);
+  wedges_ = binary::ReadArray<Wedge>(is);
+
+  for (const auto& [mesh_vertex_id, vertex_id] : binary::ReadArray<std::array<int, 2>>(is)) {
+    welded_vertices_.emplace(mesh_vertex_id, vertex_id);
+  }
+
+  for (const auto& [id, edge_tail_id, position] : vertex_records) {
+    vertices_.emplace(id, std::make_shared<Vertex>(id, position));
+  }
+
+  const auto get_vertex = [this](const int vertex_id) -> const std::shared_ptr<Vertex>& {
+    const auto iterator = vertices_.find(vertex_id);
+    if (iterator == vertices_.end()) {
+      throw std::runtime_error{std::format("Half-edge mesh refers to vertex {} which does not exist", vertex_id)};
+    }
+    return iterator->second;
+  };
+
+  for (const auto& [vertex_ids, wedge_ids] : face_records) {
+    for (const auto wedge_id : wedge_ids) {
+      if (wedge_id < -1 || std::cmp_greater_equal(wedge_id, wedges_.size())) {
+        throw std::runtime_error{std::format("Half-edge mesh refers to wedge {} which does not exist", wedge_id)};
+      }
+    }
+    const auto& [v0_id, v1_id, v2_id] = vertex_ids;
+    auto face012 = CreateTriangle(get_vertex(v0_id), get_vertex(v1_id), get_vertex(v2_id), edges_, wedge_ids);
+    faces_.emplace(hash_value(*face012), std::move(face012));
+  }
+
+  // creating triangles reassigns vertex half-edges which determine where traversal around each vertex begins
+  for (const auto& [id, edge_tail_id, position] : vertex_records) {
+    if (edge_tail_id == -1) continue;
+    const auto& vertex = vertices_.at(id);
+    const auto iterator = edges_.find(hash_value(*get_vertex(edge_tail_id), *vertex));
+    if (iterator == edges_.end()) {
+      throw std::runtime_error{
+          std::format("Half-edge mesh refers to edge ({},{}) which does not exist", edge_tail_id, id)};
+    }
+    vertex->set_edge(iterator->second);
+  }
+
+  for (const auto vertex_id : locked_vertex_ids) {
+    locked_vertices_.insert(get_vertex(vertex_id)->id());
+  }
+}
+
+void HalfEdgeMesh::Write(std::ostream& os) const {
+  std::vector<FaceRecord> face_records;
+  face_records.reserve(faces_.size());
+  std::unordered_set<int> face_vertex_ids;
+
+  for (const auto& face : faces_ | std::views::values) {
+    const auto v0 = face->v0();
+    const auto v1 = face->v1();
+    const auto edge01 = GetHalfEdge(*v0, *v1, edges_);
+    const auto edge12 = edge01->next();
+    const auto& face_record = face_records.emplace_back(
+        FaceRecord{.vertex_ids = {v0->id(), v1->id(), face->v2()->id()},
+                   .wedge_ids = {edge12->next()->wedge(), edge01->wedge(), edge12->wedge()}});
+    face_vertex_ids.insert(face_record.vertex_ids.begin(), face_record.vertex_ids.end());
+  }
+
+  std::vector<VertexRecord> vertex_records;
+  vertex_records.reserve(vertices_.size());
+
+  for (const auto& [vertex_id, vertex] : vertices_) {
+    const auto edge_tail_id = face_vertex_ids.contains(vertex_id) ? vertex->edge()->flip()->vertex()->id() : -1;
+    vertex_records.push_back(
+        VertexRecord{.id = vertex_id, .edge_tail_id = edge_tail_id, .position = vertex->position()});
+  }
+
+  const std::vector<int> locked_vertex_ids{locked_vertices_.begin(), locked_vertices_.end()};
+
+  std::vector<std::array<int, 2>> welded_vertices;
+  welded_vertices.reserve(welded_vertices_.size());
+  for (const auto& [mesh_vertex_id, vertex_id] : welded_vertices_) {
+    welded_vertices.push_back({mesh_vertex_id, vertex_id});
+  }
+
+  binary::Write(os, has_texcoords_);
+  binary::Write(os, has_normals_);
+  binary::Write(os, model_transform_);
+  binary::WriteArray<VertexRecord>(os, vertex_records);
+  binary::WriteArray<FaceRecord>(os, face_records);
+  binary::WriteArray<int>(os, locked_vertex_ids);
+  binary::WriteArray<Wedge>(os, wedges_);
+  binary::WriteArray<std::array<int, 2>>(os, welded_vertices);
+}
+
+HalfEdgeMesh::operator MeshData() const {
+  if (!wedges_.empty()) return CreateWedgeMesh(*this, model_transform_);
+
   std::vector<glm::vec3> positions;
   positions.reserve(vertices_.size());
 
   std::vector<glm::vec3> normals;
   normals.reserve(vertices_.size());
 
-  std::vector<GLuint> indices;
+  std::vector<std::uint32_t> indices;
   indices.reserve(faces_.size() * 3);
 
-  std::unordered_map<int, GLuint> index_map;
+  std::unordered_map<int, std::uint32_t> index_map;
   index_map.reserve(vertices_.size());
 
-  for (GLuint i = 0; const auto& vertex : vertices_ | std::views::values) {
+  for (std::uint32_t i = 0; const auto& vertex : vertices_ | std::views::values) {
     positions.push_back(vertex->position());
-    normals.push_back(ComputeWeightedVertexNormal(*vertex));
+    normals.emplace_back(0.0f);
     index_map.emplace(vertex->id(), i++);  // map original vertex IDs to new index positions
   }
 
+  // average face normals weighted by surface area by iterating faces rather than traversing the edges around each
+  // vertex which cannot be done for vertices on a mesh boundary
+  for (const auto* const face : GetOrderedFaces(*this)) {
+    const auto weighted_normal = face->normal() * face->area();
+    for (const auto& vertex : {face->v0(), face->v1(), face->v2()}) {
+      const auto index = index_map.at(vertex->id());
+      indices.push_back(index);
+      normals[index] += weighted_normal;
+    }
+  }
+
+  for (auto& normal : normals) normal = glm::normalize(normal);
+
+  return MeshData{std::move(positions), std::move(normals), {}, std::move(indices), model_transform_};
+}
+
+std::vector<int> HalfEdgeMesh::GetMeshVertexIds() const {
+  if (wedges_.empty()) {
+    const auto vertex_ids = vertices_ | std::views::keys;
+    return std::vector<int>{vertex_ids.begin(), vertex_ids.end()};
+  }
+  const auto vertex_ids = GetVertexWedges(*this) | std::views::keys;
+  return std::vector<int>{vertex_ids.begin(), vertex_ids.end()};
+}
+
+std::size_t HalfEdgeMesh::GetNextVertexId() const {
+  auto next_vertex_id = vertices_.empty() ? 0 : vertices_.rbegin()->first + 1;
+  for (const auto mesh_vertex_id : welded_vertices_ | std::views::keys) {
+    next_vertex_id = std::max(next_vertex_id, mesh_vertex_id + 1);
+  }
+  return static_cast<std::size_t>(next_vertex_id);
+}
+
+int HalfEdgeMesh::AddWedge(const Wedge& wedge) {
+  wedges_.push_back(wedge);
+  return static_cast<int>(wedges_.size()) - 1;
+}
+
+void HalfEdgeMesh::DiscardAttributes(const bool texcoords, const bool normals) {
+  has_texcoords_ = has_texcoords_ && !texcoords;
+  has_normals_ = has_normals_ && !normals;
+  if (has_texcoords_ || has_normals_) return;
+
+  wedges_.clear();
+  for (const auto& edge : edges_ | std::views::values) edge->set_wedge(-1);
+}
+
+void HalfEdgeMesh::Lock(const int vertex_id) {
+  const auto welded_iterator = welded_vertices_.find(vertex_id);
+  const auto is_welded = welded_iterator != welded_vertices_.end() && vertices_.contains(welded_iterator->second);
+  if (!vertices_.contains(vertex_id) && !is_welded) {
+    throw std::invalid_argument{std::format("Unable to lock vertex {} which does not exist", vertex_id)};
+  }
+  if (vertices_.contains(vertex_id)) locked_vertices_.insert(vertex_id);
+  if (is_welded) locked_vertices_.insert(welded_iterator->second);
+}
+
+void HalfEdgeMesh::LockBoundary() {
+  for (const auto& edge : edges_ | std::views::values) {
+    if (edge->is_boundary()) {
+      locked_vertices_.insert(edge->vertex()->id());
+      locked_vertices_.insert(edge->flip()->vertex()->id());
+    }
+  }
+  LockNonManifoldVertices();
+}
+
+void HalfEdgeMesh::LockNonManifoldVertices() {
+  std::unordered_map<int, int> face_counts;
   for (const auto& face : faces_ | std::views::values) {
-    indices.push_back(index_map.at(face->v0()->id()));
-    indices.push_back(index_map.at(face->v1()->id()));
-    indices.push_back(index_map.at(face->v2()->id()));
+    for (const auto& vertex : {face->v0(), face->v1(), face->v2()}) ++face_counts[vertex->id()];
   }
 
-  return Mesh{positions, normals, {}, indices, model_transform_};  // remapping texture coordinates is unsupported
+  // the edges around a vertex only reach every incident triangle if the triangles form a single closed fan
+  for (const auto& [vertex_id, vertex] : vertices_) {
+    if (locked_vertices_.contains(vertex_id)) continue;
+
+    const auto face_count = face_counts[vertex_id];
+    auto fan_face_count = 0;
+    if (face_count > 0) {
+      auto edgei0 = vertex->edge();
+      do {
+        ++fan_face_count;
+        edgei0 = edgei0->next()->flip();
+      } while (edgei0 != vertex->edge());
+    }
+    if (fan_face_count != face_count || face_count == 0) locked_vertices_.insert(vertex_id);
+  }
 }
 
-void HalfEdgeMesh::Contract(const HalfEdge& edge01, const std::shared_ptr<Vertex>& v_new) {
+void HalfEdgeMesh::Contract(const HalfEdge& edge01,
+                            const std::shared_ptr<Vertex>& v_new,
+                            const std::unordered_map<int, int>& wedge_map) {
   assert(edges_.contains(hash_value(edge01)));
   assert(!vertices_.contains(v_new->id()));
+  assert(!IsLocked(*edge01.vertex()) && !IsLocked(*edge01.flip()->vertex()));
 
   const auto edge10 = edge01.flip();
   const auto v0 = edge10->vertex();
@@ -238,8 +698,8 @@ void HalfEdgeMesh::Contract(const HalfEdge& edge01, const std::shared_ptr<Vertex
   const auto v0_next = edge10->next()->vertex();
   const auto v1_next = edge01.next()->vertex();
 
-  UpdateIncidentEdges(*v0, *v1_next, *v0_next, v_new, edges_, faces_);
-  UpdateIncidentEdges(*v1, *v0_next, *v1_next, v_new, edges_, faces_);
+  UpdateIncidentEdges(*v0, *v1_next, *v0_next, v_new, wedge_map, edges_, faces_);
+  UpdateIncidentEdges(*v1, *v0_next, *v1_next, v_new, wedge_map, edges_, faces_);
 
   DeleteFace(*edge01.face(), faces_);
   DeleteFace(*edge10->face(), faces_);
@@ -252,4 +712,70 @@ void HalfEdgeMesh::Contract(const HalfEdge& edge01, const std::shared_ptr<Vertex
   vertices_.emplace(v_new->id(), v_new);
 }
 
+void HalfEdgeMesh::Merge(const Vertex& v0, const Vertex& v1, const std::shared_ptr<Vertex>& v_new) {
+  assert(vertices_.contains(v0.id()) && vertices_.contains(v1.id()));
+  assert(!vertices_.contains(v_new->id()));
+  assert(!IsLocked(v0) && !IsLocked(v1));
+
+  for (const auto* const v_target : {&v0, &v1}) {
+    // collect the half-edges leaving the vertex before any of its faces are replaced
+    std::vector<std::shared_ptr<HalfEdge>> edges0i;
+    for (auto edge0i = v_target->edge()->flip(); edges0i.empty() || edge0i != edges0i.front();) {
+      edges0i.push_back(edge0i);
+      edge0i = edge0i->next()->next()->flip();
+    }
+
+    for (const auto& edge0i : edges0i) {
+      const auto edgeij = edge0i->next();
+      const auto edgej0 = edgeij->next();
+
+      auto face_new = CreateTriangle(v_new,
+                                     edge0i->vertex(),
+                                     edgeij->vertex(),
+                                     edges_,
+                                     {edgej0->wedge(), edge0i->wedge(), edgeij->wedge()});
+      assert(!faces_.contains(hash_value(*face_new)));
+      faces_.emplace(hash_value(*face_new), std::move(face_new));
+
+      DeleteFace(*edge0i->face(), faces_);
+    }
+
+    for (const auto& edge0i : edges0i) DeleteEdge(*edge0i, edges_);
+  }
+
+  DeleteVertex(v0, vertices_);
+  DeleteVertex(v1, vertices_);
+
+  vertices_.emplace(v_new->id(), v_new);
+  locked_vertices_.insert(v_new->id());
+}
+
+std::vector<int> HalfEdgeMesh::RemoveComponent(const Vertex& v0) {
+  assert(vertices_.contains(v0.id()));
+  std::vector<int> vertex_ids{v0.id()};
+  std::unordered_set<int> visited_vertices{v0.id()};
+  std::vector<std::size_t> edge_keys, face_keys;
+
+  // find all half-edges and faces in the connected component before deleting anything
+  for (std::size_t i = 0; i < vertex_ids.size(); ++i) {
+    const auto& vi = vertices_.at(vertex_ids[i]);
+    auto edgeji = vi->edge();
+    do {
+      // each half-edge points to exactly one vertex and each face has exactly one half-edge pointing to a given vertex
+      edge_keys.push_back(hash_value(*edgeji));
+      face_keys.push_back(hash_value(*edgeji->face()));
+      if (const auto vj = edgeji->flip()->vertex(); visited_vertices.insert(vj->id()).second) {
+        vertex_ids.push_back(vj->id());
+      }
+      edgeji = edgeji->next()->flip();
+    } while (edgeji != vi->edge());
+  }
+
+  for (const auto face_key : face_keys) faces_.erase(face_key);
+  for (const auto edge_key : edge_keys) edges_.erase(edge_key);
+  for (const auto vertex_id : vertex_ids) vertices_.erase(vertex_id);
+
+  return vertex_ids;
+}
+
 }  // namespace gfx
@@ -1,20 +1,40 @@
 #ifndef GEOMETRY_HALF_EDGE_MESH_H_
 #define GEOMETRY_HALF_EDGE_MESH_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <istream>
 #include <map>
 #include <memory>
+#include <ostream>
+#include <span>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <glm/mat4x4.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
 
 #include "geometry/half_edge.h"
 
 namespace gfx {
 class Face;
 class HalfEdge;
-class Mesh;
+class MeshData;
 class Vertex;
 
+/**
+ * @brief Vertex attributes shared by adjacent triangle corners around a vertex.
+ * @details A vertex on an attribute seam (e.g., where a texture atlas is cut) has one wedge for each side of the seam
+ *          while every other vertex has a single wedge. Attributes absent from the mesh are zero.
+ * @see "Progressive Meshes" by Hugues Hoppe (1996).
+ */
+struct Wedge {
+  glm::vec2 texcoord{0.0f};
+  glm::vec3 normal{0.0f};
+};
+
 /**
  * @brief An edge centric data structure used to represent a triangle mesh.
  * @details A half-edge mesh is comprised of directional half-edges that refer to the next edge in a triangle in
@@ -26,12 +46,85 @@ class HalfEdgeMesh {
 public:
   /**
    * @brief Creates a half-edge mesh.
+   * @details If @p mesh has texture coordinates or normals, mesh vertices that were split at an attribute seam are
+   *          welded into a single half-edge mesh vertex identified by the lowest mesh vertex index at that position so
+   *          that the seam does not appear as a boundary. Each mesh vertex then becomes a wedge that stores the
+   *          attributes of the triangle corners that referred to it.
    * @param mesh An indexed triangle mesh to construct the half-edge mesh from.
+   * @see GetCornerVertexIds
+   */
+  explicit HalfEdgeMesh(const MeshData& mesh);
+
+  /**
+   * @brief Creates a half-edge mesh from vertex attributes and indices without creating a @c MeshData.
+   * @details Vertices are welded and wedges created exactly as they are for a @c MeshData with the same attributes so
+   *          that meshes can be loaded and simplified without an intermediate copy of each attribute.
+   * @param positions The mesh vertex positions.
+   * @param normals The mesh normals or empty if the mesh does not have normals.
+   * @param texcoords The mesh texture coordinates or empty if the mesh does not have texture coordinates.
+   * @param indices Element indices where consecutive triples define a triangle face in the mesh.
+   * @param model_transform The model transform of the mesh.
+   * @throw std::invalid_argument Thrown if the number of indices is not a multiple of 3, an index refers to a vertex
+   *                              that does not exist, or an attribute is not specified for every vertex.
    */
-  explicit HalfEdgeMesh(const Mesh& mesh);
+  HalfEdgeMesh(std::span<const glm::vec3> positions,
+               std::span<const glm::vec3> normals,
+               std::span<const glm::vec2> texcoords,
+               std::span<const std::uint32_t> indices,
+               const glm::mat4& model_transform = glm::mat4{1.0f});
 
-  /** @brief Defines the conversion operator back to a triangle mesh. */
-  explicit operator Mesh() const;
+  /**
+   * @brief Reads a half-edge mesh previously written to a binary stream.
+   * @param is The binary stream to read from.
+   * @throw std::runtime_error Thrown if the stream ends early or refers to a vertex or half-edge that does not exist.
+   * @see Write
+   */
+  explicit HalfEdgeMesh(std::istream& is);
+
+  /**
+   * @brief Gets the ID of the half-edge mesh vertex that each triangle corner of a mesh is assigned to.
+   * @details Vertices that share a position are welded if the mesh has texture coordinates or normals unless doing so
+   *          would degenerate a triangle or create a second triangle on the same directed edge, in which case that
+   *          triangle keeps its original vertex indices. If welding joins triangles that only meet at a vertex (e.g.,
+   *          two surfaces that touch at a single point), each additional fan of triangles around that vertex is
+   *          assigned one of its original vertex indices instead.
+   * @param mesh The indexed triangle mesh to construct a half-edge mesh from.
+   * @return The vertex ID of each element in the index buffer of @p mesh.
+   */
+  [[nodiscard]] static std::vector<int> GetCornerVertexIds(const MeshData& mesh);
+
+  /**
+   * @brief Defines the conversion operator back to a triangle mesh.
+   * @details If the half-edge mesh has attributes, one mesh vertex is created for each wedge in use ordered by vertex
+   *          ID and then by wedge ID. Normals are taken from wedges when available and are otherwise averaged from
+   *          incident faces. Triangles are ordered by their vertex IDs so that equal half-edge meshes always produce
+   *          identical triangle meshes.
+   * @see GetMeshVertexIds
+   */
+  explicit operator MeshData() const;
+
+  /**
+   * @brief Gets the ID of the half-edge mesh vertex that each vertex of the mesh produced by @c operator MeshData
+   *        refers to.
+   * @return A vertex ID for each mesh vertex in the same order as the mesh. IDs are repeated for vertices with more
+   *         than one wedge.
+   */
+  [[nodiscard]] std::vector<int> GetMeshVertexIds() const;
+
+  /**
+   * @brief Writes the half-edge mesh to a binary stream.
+   * @details Vertex IDs, triangle winding order, locked vertices, and the half-edge each vertex refers to are preserved
+   *          so that the mesh read back is traversed in exactly the same order as this mesh.
+   * @param os The binary stream to write to.
+   */
+  void Write(std::ostream& os) const;
+
+  /**
+   * @brief Gets the smallest vertex ID that is not in use.
+   * @return One more than the largest vertex ID or welded mesh vertex index. For a half-edge mesh that has not been
+   *         modified, this is the number of vertices in the mesh it was created from.
+   */
+  [[nodiscard]] std::size_t GetNextVertexId() const;
 
   /** @brief Gets a mapping of mesh vertices by ID. */
   [[nodiscard]] const std::map<int, SharedVertex>& vertices() const noexcept { return vertices_; }
@@ -42,19 +135,107 @@ public:
   /** @brief Gets a mapping of mesh faces by hash key. */
   [[nodiscard]] const std::unordered_map<std::size_t, SharedFace>& faces() const noexcept { return faces_; }
 
+  /** @brief Gets wedges by ID. This is empty if the mesh does not have texture coordinates or normals. */
+  [[nodiscard]] const std::vector<Wedge>& wedges() const noexcept { return wedges_; }
+
+  /** @brief Determines if wedges store texture coordinates. */
+  [[nodiscard]] bool has_texcoords() const noexcept { return has_texcoords_; }
+
+  /** @brief Determines if wedges store normals. */
+  [[nodiscard]] bool has_normals() const noexcept { return has_normals_; }
+
+  /** @brief Gets the model transform of the mesh. */
+  [[nodiscard]] const glm::mat4& model_transform() const noexcept { return model_transform_; }
+
+  /**
+   * @brief Adds a wedge which can be assigned to triangle corners by edge contraction.
+   * @param wedge The wedge attributes.
+   * @return The ID of the new wedge.
+   */
+  int AddWedge(const Wedge& wedge);
+
+  /**
+   * @brief Discards vertex attributes.
+   * @details Wedges are removed once the mesh has neither texture coordinates nor normals. Otherwise they are kept
+   *          and the discarded attribute is no longer included when the half-edge mesh is converted to a triangle mesh.
+   * @param texcoords Indicates if texture coordinates should be discarded.
+   * @param normals Indicates if normals should be discarded in which case they are averaged from incident faces.
+   */
+  void DiscardAttributes(bool texcoords, bool normals);
+
+  /** @brief Gets the IDs of vertices which cannot be removed by edge contraction. */
+  [[nodiscard]] const std::unordered_set<int>& locked_vertices() const noexcept { return locked_vertices_; }
+
+  /** @brief Determines if a vertex cannot be removed by edge contraction. */
+  [[nodiscard]] bool IsLocked(const Vertex& v0) const { return locked_vertices_.contains(v0.id()); }
+
+  /**
+   * @brief Locks a vertex to prevent it from being removed by edge contraction.
+   * @details A locked vertex keeps its ID and position, and an edge between two locked vertices is never removed, so
+   *          meshes that share locked vertices along a seam remain connected after each is simplified independently.
+   * @param vertex_id The ID of the vertex to lock. The index of a mesh vertex welded at an attribute seam locks the
+   *                  vertex it was welded into.
+   * @throw std::invalid_argument Thrown if the vertex does not exist.
+   */
+  void Lock(int vertex_id);
+
+  /**
+   * @brief Locks every vertex whose incident edges cannot be traversed in a single cycle.
+   * @details This includes vertices on a mesh boundary (i.e., incident to an edge that belongs to only one triangle),
+   *          vertices whose incident triangles form more than one fan (e.g., two cones joined at their apex), and
+   *          vertices without any incident triangles.
+   */
+  void LockBoundary();
+
+  /**
+   * @brief Locks every vertex whose incident triangles form more than one fan or which has no incident triangles.
+   * @details Edge contraction circulates the edges around each vertex which only reaches every incident triangle if
+   *          they form a single fan.
+   */
+  void LockNonManifoldVertices();
+
   /**
    * @brief Performs edge contraction.
    * @details Edge contraction consists of removing an edge from the mesh by merging its two vertices into a
    *          single vertex and updating edges incident to each endpoint to connect to that new vertex.
    * @param edge01 The edge from vertex @c v0 to @c v1 to remove.
    * @param v_new The new vertex to update incident edges to.
+   * @param wedge_map A mapping of wedge IDs at either vertex of @p edge01 to the wedge IDs that replace them at
+   *                  @p v_new. Wedges without an entry are kept unchanged.
+   * @note Neither vertex of @p edge01 may be locked.
    */
-  void Contract(const HalfEdge& edge01, const SharedVertex& v_new);
+  void Contract(const HalfEdge& edge01,
+                const SharedVertex& v_new,
+                const std::unordered_map<int, int>& wedge_map = {});
+
+  /**
+   * @brief Merges two vertices in different connected components into a single vertex.
+   * @details Every triangle incident to either vertex is attached to the new vertex without removing any faces. The
+   *          triangles around the new vertex form two fans which edge contraction cannot traverse, so it is locked.
+   * @param v0,v1 The vertices to merge.
+   * @param v_new The new vertex to attach the triangles of @p v0 and @p v1 to.
+   * @note Neither @p v0 nor @p v1 may be locked.
+   */
+  void Merge(const Vertex& v0, const Vertex& v1, const SharedVertex& v_new);
+
+  /**
+   * @brief Removes a connected component from the mesh.
+   * @param v0 A vertex in the connected component to remove.
+   * @return The IDs of all vertices removed with the connected component.
+   */
+  std::vector<int> RemoveComponent(const Vertex& v0);
 
 private:
   std::map<int, SharedVertex> vertices_;
   std::unordered_map<std::size_t, SharedHalfEdge> edges_;
   std::unordered_map<std::size_t, SharedFace> faces_;
+  std::unordered_set<int> locked_vertices_;
+  std::vector<Wedge> wedges_;
+  bool has_texcoords_ = false, has_normals_ = false;
+
+  // mesh vertex indices welded at an attribute seam mapped to the ID of the vertex they were welded into
+  std::unordered_map<int, int> welded_vertices_;
+
   glm::mat4 model_transform_;
 };
 
@@ -0,0 +1,63 @@
+#include "geometry/mesh_data.h"
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+namespace gfx {
+
+namespace {
+
+/**
+ * @brief Ensures the provided vertex positions, normals, texture coordinates, and element indices describe a
+ *        triangle mesh in addition to enforcing alignment between vertex attribute.
+ */
+void Validate(const std::span<const glm::vec3> positions,
+              const std::span<const glm::vec3> normals,
+              const std::span<const glm::vec2> texcoords,
+              const std::span<const std::uint32_t> indices) {
+  if (positions.empty()) {
+    throw std::invalid_argument{"Vertex positions must be specified"};
+  }
+  if ((indices.empty() && positions.size() % 3 != 0) || indices.size() % 3 != 0) {
+    throw std::invalid_argument{"Object must be a triangle mesh"};
+  }
+  if (indices.empty() && !texcoords.empty() && positions.size() != texcoords.size()) {
+    throw std::invalid_argument{"Texture coordinates must align with position data"};
+  }
+  if (indices.empty() && !normals.empty() && positions.size() != normals.size()) {
+    throw std::invalid_argument{"Vertex normals must align with position data"};
+  }
+}
+
+}  // namespace
+
+MeshData::MeshData(std::vector<glm::vec3> positions,
+                   std::vector<glm::vec3> normals,
+                   std::vector<glm::vec2> texcoords,
+                   std::vector<std::uint32_t> indices,
+                   const glm::mat4& model_transform)
+    : positions_{std::move(positions)},
+      normals_{std::move(normals)},
+      texcoords_{std::move(texcoords)},
+      indices_{std::move(indices)},
+      model_transform_{model_transform} {
+  Validate(positions_, normals_, texcoords_, indices_);
+}
+
+void MeshData::ResizeIndices(const std::size_t size) {
+  if (size % 3 != 0) {
+    throw std::invalid_argument{std::format("Unable to resize {} element indices to {}", indices_.size(), size)};
+  }
+  indices_.resize(size);
+}
+
+void MeshData::UpdateIndices(const std::size_t offset, const std::span<const std::uint32_t> indices) {
+  if (offset > indices_.size() || indices.size() > indices_.size() - offset) {
+    throw std::out_of_range{std::format("Unable to update {} element indices at {}", indices.size(), offset)};
+  }
+  std::ranges::copy(indices, indices_.begin() + static_cast<std::ptrdiff_t>(offset));
+}
+
+}  // namespace gfx
@@ -0,0 +1,85 @@
+#ifndef GEOMETRY_MESH_DATA_H_
+#define GEOMETRY_MESH_DATA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+namespace gfx {
+
+/**
+ * @brief A triangle mesh stored in CPU memory.
+ * @details Unlike @c Mesh, mesh data does not create any OpenGL objects so it can be loaded, simplified, and written on
+ *          any thread and on machines without a display. Vertex attributes and indices are taken by value so that
+ *          vectors built by the caller are moved into the mesh without being copied. A @c Mesh is created from mesh
+ *          data only when it needs to be rendered.
+ */
+class MeshData {
+public:
+  /**
+   * @brief Creates a triangle mesh.
+   * @param positions The mesh vertex positions.
+   * @param normals The mesh normals.
+   * @param texcoords The mesh texture coordinates.
+   * @param indices Element indices where consecutive triples define a triangle face in the mesh.
+   * @param model_transform A 4x4 matrix representing an affine transform to apply to the mesh in model space.
+   * @throw std::invalid_argument Indicates the provided arguments do not represent a valid triangle mesh.
+   * @note If @p indices is non-empty, it must define a valid triangle mesh (i.e., its size must be a nonzero multiple
+   *       of 3). Otherwise, triangles are interpreted as sequential triples in @p positions which requires alignment
+   *       with @p normals and @p texcoords if specified.
+   */
+  explicit MeshData(std::vector<glm::vec3> positions,
+                    std::vector<glm::vec3> normals = {},
+                    std::vector<glm::vec2> texcoords = {},
+                    std::vector<std::uint32_t> indices = {},
+                    const glm::mat4& model_transform = glm::mat4{1.0f});
+
+  /** @brief Gets the mesh vertex positions. */
+  [[nodiscard]] const std::vector<glm::vec3>& positions() const noexcept { return positions_; }
+
+  /** @brief Gets the mesh normals. */
+  [[nodiscard]] const std::vector<glm::vec3>& normals() const noexcept { return normals_; }
+
+  /** @brief Gets the mesh texture coordinates. */
+  [[nodiscard]] const std::vector<glm::vec2>& texcoords() const noexcept { return texcoords_; }
+
+  /** @brief Gets the mesh indices corresponding to a triangle face for every three consecutive integers. */
+  [[nodiscard]] const std::vector<std::uint32_t>& indices() const noexcept { return indices_; }
+
+  /** @brief Gets the affine transform to apply to the mesh in model space. */
+  [[nodiscard]] const glm::mat4& model_transform() const noexcept { return model_transform_; }
+
+  /** @brief Sets the affine transform to apply to the mesh in model space. */
+  void set_model_transform(const glm::mat4& model_transform) noexcept { model_transform_ = model_transform; }
+
+  /**
+   * @brief Resizes the number of element indices.
+   * @param size The new number of indices. Indices added by growing the mesh are zero-initialized.
+   * @throw std::invalid_argument Thrown if @p size is not a multiple of 3.
+   */
+  void ResizeIndices(std::size_t size);
+
+  /**
+   * @brief Overwrites a contiguous range of element indices.
+   * @param offset The position of the first index to overwrite.
+   * @param indices The new element indices.
+   * @throw std::out_of_range Thrown if the range exceeds the current number of indices.
+   */
+  void UpdateIndices(std::size_t offset, std::span<const std::uint32_t> indices);
+
+private:
+  std::vector<glm::vec3> positions_;
+  std::vector<glm::vec3> normals_;
+  std::vector<glm::vec2> texcoords_;
+  std::vector<std::uint32_t> indices_;
+  glm::mat4 model_transform_;
+};
+
+}  // namespace gfx
+
+#endif  // GEOMETRY_MESH_DATA_H_
@@ -1,43 +1,74 @@
 #include "geometry/mesh_simplifier.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <memory>
-#include <queue>
+#include <numeric>
+#include <random>
 #include <ranges>
+#include <span>
+#include <sstream>
 #include <stdexcept>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_access.hpp>
 
+#include "geometry/binary_stream.h"
 #include "geometry/half_edge.h"
 #include "geometry/half_edge_mesh.h"
+#include "geometry/mesh_data.h"
+#include "geometry/progressive_mesh.h"
+#include "geometry/triangle_bvh.h"
 #include "geometry/vertex.h"
-#include "graphics/mesh.h"
 
 namespace gfx {
 
-namespace {
-
 /** @brief Represents a candidate edge contraction. */
-struct EdgeContraction {
+struct MeshSimplifier::EdgeContraction {
   EdgeContraction(std::shared_ptr<const HalfEdge> edge, std::shared_ptr<Vertex> vertex, const float cost)
       : edge{std::move(edge)}, vertex{std::move(vertex)}, cost{cost} {}
 
-  /** @brief The edge to contract. */
+  EdgeContraction(const std::array<int, 2>& virtual_pair, const float cost) : virtual_pair{virtual_pair}, cost{cost} {}
+
+  /** @brief The edge to contract. This is null for a virtual pair. */
   std::shared_ptr<const HalfEdge> edge;
 
-  /** @brief The optimal vertex position that minimizes the cost of this edge contraction. */
+  /**
+   * @brief For a virtual pair, the IDs of the vertices to merge. When removing connected components, this is the ID
+   *        of a vertex in the connected component to remove followed by the ID of the vertex it is folded into.
+   */
+  std::array<int, 2> virtual_pair{-1, -1};
+
+  /** @brief The optimal vertex position that minimizes the cost of this edge contraction or vertex merge. */
   std::shared_ptr<Vertex> vertex;
 
+  /** @brief The optimal vertex position in each additional pose. */
+  std::vector<glm::vec3> pose_positions;
+
   /** @brief A metric that quantifies how much the mesh will change after this edge has been contracted. */
   float cost;
 
+  /**
+   * @brief The deviation bound of each face created by this edge contraction keyed by the IDs of the face vertices
+   *        other than the new vertex. This is only computed when the maximum deviation is bounded.
+   */
+  std::vector<std::pair<std::array<int, 2>, FaceDeviation>> face_deviations;
+
   /**
    * @brief This is used as a workaround for priority_queue not providing a method to update an existing
    *        entry's priority. As edges are updated in the mesh, duplicated entries may be inserted in the queue
@@ -46,6 +77,32 @@ struct EdgeContraction {
   bool valid = true;
 };
 
+namespace {
+
+/** @brief The bytes at the start of every mesh simplifier checkpoint. */
+constexpr std::array<char, 8> kCheckpointMagic{'G', 'F', 'X', 'C', 'K', 'P', 'T', '\0'};
+
+/** @brief The checkpoint format version which must be incremented whenever the format changes. */
+constexpr std::uint32_t kCheckpointVersion = 4;
+
+/** @brief The number of times a face may be subdivided to establish a bound of its distance to the original surface. */
+constexpr int kMaxDeviationSubdivisions = 5;
+
+/** @brief Identifies the kind of each edge contraction candidate in a checkpoint. */
+enum class CandidateType : std::uint8_t { kInvalid, kEdge, kVirtualPair };
+
+/** @brief An error quadric as it is written to a checkpoint. */
+struct QuadricRecord {
+  std::uint64_t vertex_id;
+  glm::mat4 quadric;
+};
+
+/** @brief The deviation bound of a face as it is written to a checkpoint. */
+struct FaceDeviationRecord {
+  std::array<int, 3> vertex_ids;
+  float bound;
+};
+
 /**
  * @brief Gets a canonical representation of a half-edge used to disambiguate between its flip edge.
  * @param edge01 The half-edge to disambiguate.
@@ -56,18 +113,25 @@ std::shared_ptr<const HalfEdge> GetMinEdge(const std::shared_ptr<const HalfEdge>
   return edge01->vertex()->id() < edge10->vertex()->id() ? edge01 : edge10;
 }
 
-/** @brief Computes the error quadric for a vertex. */
-glm::mat4 ComputeQuadric(const Vertex& v0) {
-  glm::mat4 quadric{0.0f};
-  auto edgei0 = v0.edge();
-  do {
-    const auto& position = v0.position();
-    const auto& normal = edgei0->face()->normal();
-    const glm::vec4 plane{normal, -glm::dot(position, normal)};
-    quadric += glm::outerProduct(plane, plane);
-    edgei0 = edgei0->next()->flip();
-  } while (edgei0 != v0.edge());
-  return quadric;
+/**
+ * @brief Computes the error quadric for each vertex.
+ * @note Faces are iterated rather than the edges around each vertex which cannot be traversed on a mesh boundary.
+ */
+std::unordered_map<std::size_t, glm::mat4> ComputeQuadrics(const HalfEdgeMesh& half_edge_mesh) {
+  std::unordered_map<std::size_t, glm::mat4> quadrics;
+  quadrics.reserve(half_edge_mesh.vertices().size());
+
+  for (const auto& face : half_edge_mesh.faces() | std::views::values) {
+    const auto& normal = face->normal();
+    const glm::vec4 plane{normal, -glm::dot(face->v0()->position(), normal)};
+    const auto quadric = glm::outerProduct(plane, plane);
+    for (const auto& vertex : {face->v0(), face->v1(), face->v2()}) {
+      const auto [iterator, inserted] = quadrics.try_emplace(vertex->id(), quadric);
+      if (!inserted) iterator->second += quadric;
+    }
+  }
+
+  return quadrics;
 }
 
 /** @brief Gets the error quadric for a given vertex. */
@@ -77,6 +141,303 @@ const glm::mat4& GetQuadric(const Vertex& v0, const std::unordered_map<std::size
   return q0_iterator->second;
 }
 
+/**
+ * @brief Determines the position that minimizes an error quadric.
+ * @param quadric The error quadric to minimize.
+ * @param p0,p1 The positions of the edge vertices being contracted.
+ * @return The optimal position and its cost. If @p quadric is not invertible, the average of @p p0 and @p p1 is used.
+ */
+std::pair<glm::vec3, float> GetOptimalPosition(const glm::mat4& quadric, const glm::vec3& p0, const glm::vec3& p1) {
+  const glm::mat3 Q{quadric};
+  const glm::vec3 b = glm::column(quadric, 3);
+  const auto d = quadric[3][3];
+
+  // if the upper 3x3 matrix of the error quadric is not invertible, average the edge vertices
+  if (static constexpr auto kEpsilon = 1.0e-3f; fabs(determinant(Q)) < kEpsilon || fabs(d) < kEpsilon) {
+    return std::pair{(p0 + p1) / 2.0f, 0.0f};
+  }
+
+  const auto Q_inv = glm::inverse(Q);
+  const auto D_inv = glm::column(glm::mat4{Q_inv}, 3, glm::vec4{-1.0f / d * Q_inv * b, 1.0f / d});
+
+  auto position = D_inv * glm::vec4{0.0f, 0.0f, 0.0f, 1.0f};
+  position /= position.w;
+
+  return std::pair{glm::vec3{position}, glm::dot(position, quadric * position)};
+}
+
+/** @brief The maximum number of attributes in a generalized error quadric (two texture coordinates and a normal). */
+constexpr std::size_t kMaxAttributeCount = 5;
+
+/** @brief The maximum dimension of the space spanning positions and attributes of a generalized error quadric. */
+constexpr std::size_t kMaxQuadricDimension = 3 + kMaxAttributeCount;
+
+/** @brief The offset of the linear term in a generalized error quadric following its packed symmetric matrix. */
+constexpr std::size_t kLinearTermOffset = kMaxQuadricDimension * (kMaxQuadricDimension + 1) / 2;
+
+/** @brief The offset of the constant term in a generalized error quadric. */
+constexpr std::size_t kConstantTermOffset = kLinearTermOffset + kMaxQuadricDimension;
+
+/**
+ * @brief A generalized error quadric Q(v) = v^T A v + 2 b^T v + c over a position and wedge attributes stored as the
+ *        upper triangle of the symmetric matrix A followed by the vector b and the constant c.
+ */
+using AttributeQuadric = std::array<double, kConstantTermOffset + 1>;
+
+/** @brief A point in the space spanning positions and attributes of a generalized error quadric. */
+using QuadricVector = std::array<double, kMaxQuadricDimension>;
+
+/** @brief Gets the index of a matrix element in the packed upper triangle of a generalized error quadric. */
+constexpr std::size_t GetPackedIndex(const std::size_t i, const std::size_t j) noexcept {
+  return i <= j ? j * (j + 1) / 2 + i : i * (i + 1) / 2 + j;
+}
+
+/** @brief The error of a group of merged wedges as a function of position alone. */
+struct ReducedQuadric {
+  /** @brief The sum of the generalized error quadrics of each wedge in the group. */
+  AttributeQuadric attribute_quadric{};
+
+  /** @brief The generalized error quadric evaluated at the optimal attributes for each position. */
+  glm::mat4 quadric{0.0f};
+
+  /** @brief Rows of an affine transform that map a homogeneous position to its optimal attributes. */
+  std::array<glm::dvec4, kMaxAttributeCount> attribute_transform{};
+};
+
+/** @brief Gets the number of attributes in a generalized error quadric for attributes with a nonzero weight. */
+std::size_t GetAttributeCount(const std::array<float, 2>& attribute_weights) noexcept {
+  return (attribute_weights[0] > 0.0f ? 2 : 0) + (attribute_weights[1] > 0.0f ? 3 : 0);
+}
+
+/**
+ * @brief Embeds a wedge in the space spanning positions and attributes of a generalized error quadric.
+ * @param position The position of the vertex the wedge belongs to.
+ * @param wedge The wedge attributes.
+ * @param attribute_weights The scale of texture coordinates and normals or zero if the mesh does not have them.
+ * @return The position followed by each scaled attribute present in the mesh.
+ */
+QuadricVector EmbedWedge(const glm::vec3& position, const Wedge& wedge, const std::array<float, 2>& attribute_weights) {
+  QuadricVector v{position.x, position.y, position.z};
+  auto i = 3;
+  if (const auto weight = attribute_weights[0]; weight > 0.0f) {
+    for (auto j = 0; j < 2; ++j) v[i++] = wedge.texcoord[j] * weight;
+  }
+  if (const auto weight = attribute_weights[1]; weight > 0.0f) {
+    for (auto j = 0; j < 3; ++j) v[i++] = wedge.normal[j] * weight;
+  }
+  return v;
+}
+
+/** @brief Converts scaled attributes in a generalized error quadric back to a wedge. */
+Wedge GetWedge(const std::array<double, kMaxAttributeCount>& attributes,
+               const std::array<float, 2>& attribute_weights) {
+  Wedge wedge;
+  auto i = 0;
+  if (const auto weight = attribute_weights[0]; weight > 0.0f) {
+    for (auto j = 0; j < 2; ++j) wedge.texcoord[j] = static_cast<float>(attributes[i++] / weight);
+  }
+  if (const auto weight = attribute_weights[1]; weight > 0.0f) {
+    for (auto j = 0; j < 3; ++j) wedge.normal[j] = static_cast<float>(attributes[i++] / weight);
+  }
+  return wedge;
+}
+
+/**
+ * @brief Computes the generalized error quadric of a triangle which measures the squared distance to the plane of the
+ *        triangle in the space spanning positions and attributes.
+ * @param corners The triangle corners embedded in the space of the generalized error quadric.
+ * @param dimension The dimension of the space of the generalized error quadric.
+ * @return The generalized error quadric or zero if the triangle is degenerate.
+ */
+AttributeQuadric ComputeAttributeQuadric(const std::array<QuadricVector, 3>& corners, const std::size_t dimension) {
+  const auto dot = [dimension](const QuadricVector& lhs, const QuadricVector& rhs) {
+    auto result = 0.0;
+    for (std::size_t i = 0; i < dimension; ++i) result += lhs[i] * rhs[i];
+    return result;
+  };
+
+  // construct an orthonormal basis for the plane of the triangle using Gram-Schmidt orthogonalization
+  const auto& p = corners[0];
+  QuadricVector e1{}, e2{};
+  for (std::size_t i = 0; i < dimension; ++i) {
+    e1[i] = corners[1][i] - p[i];
+    e2[i] = corners[2][i] - p[i];
+  }
+
+  const auto e1_length = std::sqrt(dot(e1, e1));
+  if (e1_length == 0.0) return AttributeQuadric{};
+  for (std::size_t i = 0; i < dimension; ++i) e1[i] /= e1_length;
+
+  const auto e1_e2 = dot(e1, e2);
+  for (std::size_t i = 0; i < dimension; ++i) e2[i] -= e1_e2 * e1[i];
+  const auto e2_length = std::sqrt(dot(e2, e2));
+  if (e2_length == 0.0) return AttributeQuadric{};
+  for (std::size_t i = 0; i < dimension; ++i) e2[i] /= e2_length;
+
+  // A = I - e1 e1^T - e2 e2^T, b = (p.e1) e1 + (p.e2) e2 - p, c = p.p - (p.e1)^2 - (p.e2)^2
+  AttributeQuadric quadric{};
+  const auto p_e1 = dot(p, e1);
+  const auto p_e2 = dot(p, e2);
+  for (std::size_t j = 0; j < dimension; ++j) {
+    for (std::size_t i = 0; i <= j; ++i) {
+      quadric[GetPackedIndex(i, j)] = (i == j ? 1.0 : 0.0) - e1[i] * e1[j] - e2[i] * e2[j];
+    }
+    quadric[kLinearTermOffset + j] = p_e1 * e1[j] + p_e2 * e2[j] - p[j];
+  }
+  quadric[kConstantTermOffset] = dot(p, p) - p_e1 * p_e1 - p_e2 * p_e2;
+
+  return quadric;
+}
+
+/** @brief Adds a generalized error quadric to another. */
+void Accumulate(AttributeQuadric& quadric, const AttributeQuadric& other) noexcept {
+  for (std::size_t i = 0; i < quadric.size(); ++i) quadric[i] += other[i];
+}
+
+/**
+ * @brief Computes the generalized error quadric for each wedge.
+ * @param half_edge_mesh The half-edge mesh whose wedges should be evaluated.
+ * @param attribute_weights The scale of texture coordinates and normals or zero if the mesh does not have them.
+ * @return The sum of the generalized error quadrics of the triangles incident to each wedge indexed by wedge ID.
+ */
+std::vector<AttributeQuadric> ComputeWedgeQuadrics(const HalfEdgeMesh& half_edge_mesh,
+                                                   const std::array<float, 2>& attribute_weights) {
+  const auto& wedges = half_edge_mesh.wedges();
+  const auto dimension = 3 + GetAttributeCount(attribute_weights);
+  std::vector<AttributeQuadric> wedge_quadrics(wedges.size(), AttributeQuadric{});
+
+  for (const auto& face : half_edge_mesh.faces() | std::views::values) {
+    // each half-edge stores the wedge of the triangle corner at its head
+    const auto& edge01 = half_edge_mesh.edges().at(hash_value(*face->v0(), *face->v1()));
+    const std::array corner_edges{edge01->next()->next(), edge01, edge01->next()};
+
+    std::array<QuadricVector, 3> corners{};
+    for (std::size_t i = 0; i < corners.size(); ++i) {
+      const auto& edge = corner_edges[i];
+      corners[i] = EmbedWedge(edge->vertex()->position(), wedges[edge->wedge()], attribute_weights);
+    }
+
+    const auto quadric = ComputeAttributeQuadric(corners, dimension);
+    for (const auto& edge : corner_edges) Accumulate(wedge_quadrics[edge->wedge()], quadric);
+  }
+
+  return wedge_quadrics;
+}
+
+/**
+ * @brief Eliminates attributes from a generalized error quadric by solving for the attributes that minimize it at each
+ *        position.
+ * @param attribute_quadric The generalized error quadric to reduce.
+ * @param attribute_count The number of attributes in @p attribute_quadric.
+ * @param fallback_attributes The attributes to use if the optimal attributes are not unique.
+ * @return An error quadric over positions alone and the transform that maps positions to their optimal attributes.
+ */
+ReducedQuadric ReduceQuadric(const AttributeQuadric& attribute_quadric,
+                             const std::size_t attribute_count,
+                             const std::array<double, kMaxAttributeCount>& fallback_attributes) {
+  const auto n = 3 + attribute_count;
+  const auto get_element = [&](const std::size_t i, const std::size_t j) {
+    // the generalized error quadric as a symmetric (n+1)x(n+1) matrix acting on homogeneous vectors
+    if (i < n && j < n) return attribute_quadric[GetPackedIndex(i, j)];
+    if (i < n) return attribute_quadric[kLinearTermOffset + i];
+    if (j < n) return attribute_quadric[kLinearTermOffset + j];
+    return attribute_quadric[kConstantTermOffset];
+  };
+
+  // solve A_aa X = [A_ap | b_a] by Gaussian elimination with partial pivoting so that the optimal attributes for a
+  // position p are a = -X [p 1]^T
+  std::array<std::array<double, kMaxAttributeCount + 4>, kMaxAttributeCount> system{};
+  for (std::size_t i = 0; i < attribute_count; ++i) {
+    for (std::size_t j = 0; j < attribute_count; ++j) system[i][j] = get_element(3 + i, 3 + j);
+    for (std::size_t j = 0; j < 4; ++j) system[i][attribute_count + j] = get_element(3 + i, j < 3 ? j : n);
+  }
+
+  auto is_singular = false;
+  for (std::size_t k = 0; k < attribute_count && !is_singular; ++k) {
+    auto pivot = k;
+    for (auto i = k + 1; i < attribute_count; ++i) {
+      if (std::abs(system[i][k]) > std::abs(system[pivot][k])) pivot = i;
+    }
+    if (static constexpr auto kEpsilon = 1.0e-9; std::abs(system[pivot][k]) < kEpsilon) {
+      is_singular = true;
+      break;
+    }
+    std::swap(system[k], system[pivot]);
+    for (std::size_t i = 0; i < attribute_count; ++i) {
+      if (i == k) continue;
+      const auto factor = system[i][k] / system[k][k];
+      for (auto j = k; j < attribute_count + 4; ++j) system[i][j] -= factor * system[k][j];
+    }
+  }
+
+  ReducedQuadric reduced_quadric{.attribute_quadric = attribute_quadric};
+  for (std::size_t i = 0; i < attribute_count; ++i) {
+    auto& row = reduced_quadric.attribute_transform[i];
+    if (is_singular) {
+      row = glm::dvec4{0.0, 0.0, 0.0, fallback_attributes[i]};
+    } else {
+      for (auto j = 0; j < 4; ++j) row[j] = -system[i][attribute_count + j] / system[i][i];
+    }
+  }
+
+  // evaluate the generalized error quadric at [p a]^T = L [p 1]^T to obtain L^T Q L
+  std::array<glm::dvec4, kMaxQuadricDimension + 1> transform{};
+  for (auto i = 0; i < 3; ++i) transform[i][i] = 1.0;
+  for (std::size_t i = 0; i < attribute_count; ++i) transform[3 + i] = reduced_quadric.attribute_transform[i];
+  transform[n] = glm::dvec4{0.0, 0.0, 0.0, 1.0};
+
+  for (auto i = 0; i < 4; ++i) {
+    for (auto j = 0; j < 4; ++j) {
+      auto element = 0.0;
+      for (std::size_t r = 0; r <= n; ++r) {
+        if (transform[r][i] == 0.0) continue;
+        for (std::size_t c = 0; c <= n; ++c) element += transform[r][i] * get_element(r, c) * transform[c][j];
+      }
+      reduced_quadric.quadric[j][i] = static_cast<float>(element);
+    }
+  }
+
+  return reduced_quadric;
+}
+
+/**
+ * @brief Reduces the generalized error quadric of a group of merged wedges to an error quadric over positions.
+ * @param wedge_group The IDs of the wedges to merge.
+ * @param wedge_quadrics Generalized error quadrics indexed by wedge ID.
+ * @param wedges Wedges indexed by wedge ID.
+ * @param attribute_weights The scale of texture coordinates and normals or zero if the mesh does not have them.
+ * @return The reduced error quadric of the merged wedge. If its optimal attributes are not unique, the average
+ *         attributes of the wedges in @p wedge_group are used.
+ */
+ReducedQuadric ReduceWedgeGroup(const std::span<const int> wedge_group,
+                                const std::vector<AttributeQuadric>& wedge_quadrics,
+                                const std::vector<Wedge>& wedges,
+                                const std::array<float, 2>& attribute_weights) {
+  const auto attribute_count = GetAttributeCount(attribute_weights);
+  AttributeQuadric attribute_quadric{};
+  std::array<double, kMaxAttributeCount> average_attributes{};
+
+  for (const auto wedge_id : wedge_group) {
+    Accumulate(attribute_quadric, wedge_quadrics[static_cast<std::size_t>(wedge_id)]);
+    const auto attributes = EmbedWedge(glm::vec3{0.0f}, wedges[static_cast<std::size_t>(wedge_id)], attribute_weights);
+    for (std::size_t i = 0; i < attribute_count; ++i) {
+      average_attributes[i] += attributes[3 + i] / static_cast<double>(wedge_group.size());
+    }
+  }
+
+  return ReduceQuadric(attribute_quadric, attribute_count, average_attributes);
+}
+
+/** @brief Gets the attributes that minimize a reduced error quadric at a given position. */
+std::array<double, kMaxAttributeCount> GetOptimalAttributes(const ReducedQuadric& reduced_quadric,
+                                                            const glm::vec3& position) {
+  std::array<double, kMaxAttributeCount> attributes{};
+  for (std::size_t i = 0; i < attributes.size(); ++i) {
+    attributes[i] = glm::dot(reduced_quadric.attribute_transform[i], glm::dvec4{position, 1.0});
+  }
+  return attributes;
+}
+
 /**
  * @brief Determines the optimal vertex position for an edge contraction.
  * @param edge01 The edge to evaluate.
@@ -92,24 +453,49 @@ std::pair<std::shared_ptr<Vertex>, float> GetOptimalEdgeContractionVertex(
   const auto& q0 = GetQuadric(*v0, quadrics);
   const auto& q1 = GetQuadric(*v1, quadrics);
 
-  const auto q01 = q0 + q1;
-  const glm::mat3 Q{q01};
-  const glm::vec3 b = glm::column(q01, 3);
-  const auto d = q01[3][3];
+  const auto [position, cost] = GetOptimalPosition(q0 + q1, v0->position(), v1->position());
+  return std::pair{std::make_shared<Vertex>(position), cost};
+}
 
-  // if the upper 3x3 matrix of the error quadric is not invertible, average the edge vertices
-  if (static constexpr auto kEpsilon = 1.0e-3f; fabs(determinant(Q)) < kEpsilon || fabs(d) < kEpsilon) {
-    const auto position = (v0->position() + v1->position()) / 2.0f;
-    return std::pair{std::make_shared<Vertex>(position), 0.0f};
+/**
+ * @brief Determines the optimal vertex position for an edge contraction in a mesh with attributes.
+ * @param edge01 The edge to evaluate.
+ * @param wedge_groups The wedges at either vertex of @p edge01 grouped by the wedge they merge into.
+ * @param wedge_quadrics Generalized error quadrics indexed by wedge ID.
+ * @param wedges Wedges indexed by wedge ID.
+ * @param attribute_weights The scale of texture coordinates and normals or zero if the mesh does not have them.
+ * @return The vertex that minimizes the sum of the errors of each merged wedge at their optimal attributes and the
+ *         cost associated with contracting @p edge01.
+ */
+std::pair<std::shared_ptr<Vertex>, float> GetOptimalEdgeContractionVertex(
+    const HalfEdge& edge01,
+    const std::span<const std::vector<int>> wedge_groups,
+    const std::vector<AttributeQuadric>& wedge_quadrics,
+    const std::vector<Wedge>& wedges,
+    const std::array<float, 2>& attribute_weights) {
+  glm::mat4 quadric{0.0f};
+  for (const auto& wedge_group : wedge_groups) {
+    quadric += ReduceWedgeGroup(wedge_group, wedge_quadrics, wedges, attribute_weights).quadric;
   }
 
-  const auto Q_inv = glm::inverse(Q);
-  const auto D_inv = glm::column(glm::mat4{Q_inv}, 3, glm::vec4{-1.0f / d * Q_inv * b, 1.0f / d});
-
-  auto position = D_inv * glm::vec4{0.0f, 0.0f, 0.0f, 1.0f};
-  position /= position.w;
+  const auto [position, cost] =
+      GetOptimalPosition(quadric, edge01.flip()->vertex()->position(), edge01.vertex()->position());
+  return std::pair{std::make_shared<Vertex>(position), cost};
+}
 
-  return std::pair{std::make_shared<Vertex>(position), glm::dot(position, q01 * position)};
+/**
+ * @brief Gets the number of edges incident to a vertex.
+ * @return The vertex degree or the maximum integer value for a vertex on a mesh boundary.
+ */
+int GetDegree(const Vertex& v0) {
+  auto degree = 0;
+  auto edgei0 = v0.edge();
+  do {
+    ++degree;
+    edgei0 = edgei0->next()->flip();
+    if (edgei0->is_boundary()) return std::numeric_limits<int>::max();
+  } while (edgei0 != v0.edge());
+  return degree;
 }
 
 /**
@@ -121,6 +507,12 @@ bool WillDegenerate(const std::shared_ptr<const HalfEdge>& edge01) {
   const auto v0 = edge01->flip()->vertex();
   const auto v1_next = edge01->next()->vertex();
   const auto v0_next = edge01->flip()->next()->vertex();
+
+  // the vertex opposite the edge in each incident face loses an edge which folds its faces onto each other if it only
+  // has three incident edges (e.g., when contracting any edge in a tetrahedron). vertices on a mesh boundary are
+  // locked and can never be folded this way.
+  if (GetDegree(*v1_next) <= 3 || GetDegree(*v0_next) <= 3) return true;
+
   std::unordered_map<std::size_t, std::shared_ptr<Vertex>> neighborhood;
 
   for (auto iterator = edge01->next(); iterator != edge01->flip(); iterator = iterator->flip()->next()) {
@@ -138,118 +530,1276 @@ bool WillDegenerate(const std::shared_ptr<const HalfEdge>& edge01) {
   return false;
 }
 
-}  // namespace
+/**
+ * @brief Appends faces incident to a vertex to a vector of recorded faces.
+ * @param v0 The vertex whose incident faces should be recorded.
+ * @param v_exclude An optional vertex whose incident faces should be skipped (i.e., because they were recorded).
+ * @param faces The vector of recorded faces to append to.
+ */
+void RecordIncidentFaces(const Vertex& v0, const Vertex* const v_exclude, std::vector<VertexSplit::Face>& faces) {
+  auto edgei0 = v0.edge();
+  do {
+    const auto face = edgei0->face();
+    if (const VertexSplit::Face face_ids{face->v0()->id(), face->v1()->id(), face->v2()->id()};
+        v_exclude == nullptr || std::ranges::find(face_ids, v_exclude->id()) == face_ids.end()) {
+      faces.push_back(face_ids);
+    }
+    edgei0 = edgei0->next()->flip();
+  } while (edgei0 != v0.edge());
+}
+
+/**
+ * @brief Computes an upper bound of the distance from every point on a triangle to a surface.
+ * @details Two bounds are combined. The distance to a single triangle of the surface is convex, so its maximum over
+ *          the triangle is attained at a vertex and bounds the distance to the surface wherever the triangle lies over
+ *          that triangle of the surface. Elsewhere, the distance to a surface changes no faster than the distance
+ *          travelled, so the distance from any point on the triangle is at most the distance from one of its vertices
+ *          plus the distance from that vertex to the farthest point of the triangle, which is another vertex.
+ *          Triangles whose bound exceeds the maximum deviation are subdivided at the midpoints of their edges to
+ *          tighten both bounds.
+ * @param surface The surface to measure the distance to.
+ * @param triangle The triangle to bound.
+ * @param closest_triangles The closest triangle of @p surface to each vertex of @p triangle or null if it is farther
+ *                          than @p max_deviation.
+ * @param max_deviation The bound to establish.
+ * @param subdivisions The number of times @p triangle may be subdivided.
+ * @return An upper bound of the distance from @p triangle to @p surface which exceeds @p max_deviation if it could not
+ *         be established within @p subdivisions.
+ */
+float GetDeviationBound(const TriangleBvh& surface,
+                        const TriangleBvh::Triangle& triangle,
+                        const std::array<const TriangleBvh::Triangle*, 3>& closest_triangles,
+                        const float max_deviation,
+                        const int subdivisions) {
+  // a vertex farther than the maximum deviation cannot be bounded by subdividing
+  if (std::ranges::find(closest_triangles, nullptr) != closest_triangles.end()) {
+    return std::numeric_limits<float>::infinity();
+  }
+
+  const auto get_distance = [&](const TriangleBvh::Triangle& closest_triangle) {
+    auto max_distance = 0.0f;
+    for (const auto& position : triangle) {
+      max_distance =
+          std::max(max_distance, glm::distance(position, TriangleBvh::GetClosestPoint(position, closest_triangle)));
+    }
+    return max_distance;
+  };
+
+  const auto& [p0, p1, p2] = triangle;
+  const std::array edge_lengths{glm::distance(p1, p2), glm::distance(p2, p0), glm::distance(p0, p1)};
+  auto bound = std::numeric_limits<float>::infinity();
+
+  for (auto i = 0; i < 3; ++i) {
+    const auto& position = triangle[i];
+    const auto distance = glm::distance(position, TriangleBvh::GetClosestPoint(position, *closest_triangles[i]));
+    const auto farthest_distance = std::max(edge_lengths[(i + 1) % 3], edge_lengths[(i + 2) % 3]);
+    bound = std::min({bound, distance + farthest_distance, get_distance(*closest_triangles[i])});
+  }
+  if (bound <= max_deviation || subdivisions == 0) return bound;
+
+  const std::array midpoints{(p1 + p2) / 2.0f, (p2 + p0) / 2.0f, (p0 + p1) / 2.0f};
+  std::array<const TriangleBvh::Triangle*, 3> midpoint_triangles{};
+  for (auto i = 0; i < 3; ++i) {
+    midpoint_triangles[i] = surface.FindClosestTriangle(midpoints[i], max_deviation);
+    if (midpoint_triangles[i] == nullptr) return std::numeric_limits<float>::infinity();
+  }
 
-Mesh mesh::Simplify(const Mesh& mesh, const float rate) {
+  const std::array<std::pair<TriangleBvh::Triangle, std::array<const TriangleBvh::Triangle*, 3>>, 4> children{
+      std::pair{TriangleBvh::Triangle{p0, midpoints[2], midpoints[1]},
+                std::array{closest_triangles[0], midpoint_triangles[2], midpoint_triangles[1]}},
+      std::pair{TriangleBvh::Triangle{midpoints[2], p1, midpoints[0]},
+                std::array{midpoint_triangles[2], closest_triangles[1], midpoint_triangles[0]}},
+      std::pair{TriangleBvh::Triangle{midpoints[1], midpoints[0], p2},
+                std::array{midpoint_triangles[1], midpoint_triangles[0], closest_triangles[2]}},
+      std::pair{TriangleBvh::Triangle{midpoints[0], midpoints[1], midpoints[2]}, midpoint_triangles}};
+
+  auto max_bound = 0.0f;
+  for (const auto& [child_triangle, child_closest_triangles] : children) {
+    max_bound = std::max(
+        max_bound,
+        GetDeviationBound(surface, child_triangle, child_closest_triangles, max_deviation, subdivisions - 1));
+    if (max_bound > max_deviation) break;
+  }
+  return max_bound;
+}
+
+/**
+ * @brief Gets the number of triangles to reduce a mesh below.
+ * @param face_count The initial number of triangles in the mesh.
+ * @param rate The percentage of triangles to be removed.
+ * @throw std::invalid_argument Thrown if the simplification rate is not in the interval [0,1].
+ */
+std::size_t GetTargetFaceCount(const std::size_t face_count, const float rate) {
   if (rate < 0.0f || rate > 1.0f) {
     throw std::invalid_argument{std::format("Invalid mesh simplification rate: {}", rate)};
   }
+  return static_cast<std::size_t>((1.0f - rate) * static_cast<float>(face_count));
+}
 
-  const auto start_time = std::chrono::high_resolution_clock::now();
-  HalfEdgeMesh half_edge_mesh{mesh};
+/**
+ * @brief Creates a half-edge mesh with only the vertex attributes that simplification preserves.
+ * @details Vertices are only welded at attribute seams if an attribute is preserved so that a mesh simplified without
+ *          attributes has the same vertices as a mesh that does not have them.
+ */
+HalfEdgeMesh CreateHalfEdgeMesh(const MeshData& mesh, const SimplifierOptions& options) {
+  return HalfEdgeMesh{mesh.positions(),
+                      options.normal_weight > 0.0f ? std::span{mesh.normals()} : std::span<const glm::vec3>{},
+                      options.texcoord_weight > 0.0f ? std::span{mesh.texcoords()} : std::span<const glm::vec2>{},
+                      mesh.indices(),
+                      mesh.model_transform()};
+}
 
-  // compute error quadrics for each vertex
-  std::unordered_map<std::size_t, glm::mat4> quadrics;
-  for (const auto& [vertex_id, vertex] : half_edge_mesh.vertices()) {
-    quadrics.emplace(vertex_id, ComputeQuadric(*vertex));
+/** @brief Gets a path beside a checkpoint with a random suffix so that concurrent writers never share a file. */
+std::filesystem::path GetTemporaryPath(const std::filesystem::path& filepath) {
+  thread_local std::mt19937_64 generator{std::random_device{}()};
+  auto temporary_filepath = filepath;
+  temporary_filepath += std::format(".{:016x}.tmp", generator());
+  return temporary_filepath;
+}
+
+}  // namespace
+
+bool MeshSimplifier::MinCostComparator::operator()(const std::shared_ptr<EdgeContraction>& lhs,
+                                                   const std::shared_ptr<EdgeContraction>& rhs) const noexcept {
+  return lhs->cost > rhs->cost;
+}
+
+MeshSimplifier::MeshSimplifier(const MeshData& mesh,
+                               ProgressiveMesh* const progressive_mesh,
+                               const SimplifierOptions& options)
+    : MeshSimplifier{CreateHalfEdgeMesh(mesh, options), progressive_mesh, options} {
+  if (progressive_mesh_ != nullptr) {
+    // the progressive mesh welds vertices the same way as the half-edge mesh only if it has the same attributes
+    *progressive_mesh_ =
+        half_edge_mesh_.has_texcoords() || half_edge_mesh_.has_normals()
+            ? ProgressiveMesh{mesh}
+            : ProgressiveMesh{MeshData{mesh.positions(), {}, {}, mesh.indices(), mesh.model_transform()}};
+  }
+}
+
+MeshSimplifier::MeshSimplifier(HalfEdgeMesh half_edge_mesh, const SimplifierOptions& options)
+    : MeshSimplifier{std::move(half_edge_mesh), nullptr, options} {}
+
+MeshSimplifier::MeshSimplifier(HalfEdgeMesh half_edge_mesh,
+                               ProgressiveMesh* const progressive_mesh,
+                               const SimplifierOptions& options)
+    : half_edge_mesh_{std::move(half_edge_mesh)},
+      progressive_mesh_{progressive_mesh},
+      approximate_queue_samples_{options.approximate_queue_samples},
+      next_vertex_id_{half_edge_mesh_.GetNextVertexId()} {
+  if (options.virtual_pair_distance < 0.0f) {
+    throw std::invalid_argument{std::format("Invalid virtual pair distance: {}", options.virtual_pair_distance)};
+  }
+  if (options.virtual_pair_distance > 0.0f && progressive_mesh_ != nullptr) {
+    // merging vertices in different components or removing a component cannot be represented as a vertex split
+    throw std::invalid_argument{"Virtual pairs cannot be recorded in a progressive mesh"};
+  }
+  if (options.virtual_pair_distance > 0.0f && !options.poses.empty()) {
+    // virtual pairs only measure their error and position the merged vertex in the primary pose
+    throw std::invalid_argument{"Virtual pairs cannot be used with additional poses"};
+  }
+  if (options.virtual_pair_distance > 0.0f && (options.lock_boundary || !options.locked_vertices.empty())) {
+    // components are traversed by circulating each vertex which is not possible at a locked boundary vertex
+    throw std::invalid_argument{"Virtual pairs cannot be used with locked vertices"};
+  }
+  if (options.virtual_pair_distance > 0.0f && approximate_queue_samples_ > 0) {
+    // virtual pairs are lazily re-evaluated which relies on the order of the exact priority queue
+    throw std::invalid_argument{"Virtual pairs cannot be used with an approximate queue"};
+  }
+  if (!(options.max_deviation > 0.0f)) {
+    throw std::invalid_argument{std::format("Invalid maximum deviation: {}", options.max_deviation)};
+  }
+  if (options.virtual_pair_distance > 0.0f && options.max_deviation < std::numeric_limits<float>::infinity()) {
+    // faces attached to a merged vertex or removed with their component are not bounded by the original surface
+    throw std::invalid_argument{"Virtual pairs cannot be used with a maximum deviation"};
+  }
+
+  if (options.checkpoint_interval > 0 && progressive_mesh_ != nullptr) {
+    // the progressive mesh is owned by the caller and cannot be restored with the rest of the simplification state
+    throw std::invalid_argument{"Checkpoints cannot be saved while recording a progressive mesh"};
+  }
+  if (options.checkpoint_interval > 0 && options.checkpoint_path.empty()) {
+    throw std::invalid_argument{"A checkpoint path is required to save checkpoints"};
   }
+  checkpoint_interval_ = options.checkpoint_interval;
+  checkpoint_path_ = options.checkpoint_path;
 
-  // use a priority queue to sort edge contraction candidates by the cost of removing each edge
-  static constexpr auto kMinCostComparator = [](const auto& lhs, const auto& rhs) { return lhs->cost > rhs->cost; };
-  std::priority_queue<std::shared_ptr<EdgeContraction>,
-                      std::vector<std::shared_ptr<EdgeContraction>>,
-                      decltype(kMinCostComparator)>
-      edge_contractions{kMinCostComparator};
+  if (!(options.texcoord_weight >= 0.0f)) {
+    throw std::invalid_argument{std::format("Invalid texture coordinate weight: {}", options.texcoord_weight)};
+  }
+  if (!(options.normal_weight >= 0.0f)) {
+    throw std::invalid_argument{std::format("Invalid normal weight: {}", options.normal_weight)};
+  }
+  half_edge_mesh_.DiscardAttributes(options.texcoord_weight == 0.0f, options.normal_weight == 0.0f);
+
+  if (options.lock_boundary) half_edge_mesh_.LockBoundary();
+  for (const auto vertex_id : options.locked_vertices) half_edge_mesh_.Lock(vertex_id);
+
+  // edges around a vertex on an unlocked boundary cannot be traversed when it is contracted
+  for (const auto& edge : half_edge_mesh_.edges() | std::views::values) {
+    if (const auto& v0 = edge->vertex(); edge->is_boundary() && !half_edge_mesh_.IsLocked(*v0)) {
+      throw std::invalid_argument{std::format("Boundary vertex {} must be locked to simplify an open mesh", v0->id())};
+    }
+  }
+
+  // edges around a vertex joining more than one fan of triangles cannot all be traversed when it is contracted
+  half_edge_mesh_.LockNonManifoldVertices();
+
+  // compute error quadrics for each vertex
+  quadrics_ = ComputeQuadrics(half_edge_mesh_);
+  if (!options.poses.empty()) InitializePoses(options.poses);
+  if (options.max_deviation < std::numeric_limits<float>::infinity()) InitializeDeviation(options.max_deviation);
 
-  // this is used to invalidate existing priority queue entries as edges are updated or removed from the mesh
-  std::unordered_map<std::size_t, std::shared_ptr<EdgeContraction>> valid_edges;
+  // compute generalized error quadrics for each wedge so that attributes are preserved with geometry
+  if (!half_edge_mesh_.wedges().empty()) {
+    attribute_weights_ = {half_edge_mesh_.has_texcoords() ? options.texcoord_weight : 0.0f,
+                          half_edge_mesh_.has_normals() ? options.normal_weight : 0.0f};
+    wedge_quadrics_ = ComputeWedgeQuadrics(half_edge_mesh_, attribute_weights_);
+  }
 
   // compute the optimal vertex position that minimizes the cost of contracting each edge
-  for (const auto& edge : half_edge_mesh.edges() | std::views::values) {
+  for (const auto& edge : half_edge_mesh_.edges() | std::views::values) {
+    if (IsLocked(*edge)) continue;
     const auto min_edge = GetMinEdge(edge);
 
-    if (const auto min_edge_key = hash_value(*min_edge); !valid_edges.contains(min_edge_key)) {
-      const auto [vertex, cost] = GetOptimalEdgeContractionVertex(*edge, quadrics);
-      const auto edge_contraction = std::make_shared<EdgeContraction>(edge, vertex, cost);
-      edge_contractions.push(edge_contraction);
-      valid_edges.emplace(min_edge_key, edge_contraction);
+    if (const auto min_edge_key = hash_value(*min_edge); !valid_edges_.contains(min_edge_key)) {
+      auto edge_contraction = CreateEdgeContraction(edge);
+      valid_edges_.emplace(min_edge_key, edge_contraction);
+      Enqueue(std::move(edge_contraction));
     }
   }
 
-  // stop mesh simplification if the number of triangles has been sufficiently reduced
-  const auto initial_face_count = half_edge_mesh.faces().size();
-  const auto is_simplified = [&, target_face_count = (1.0f - rate) * static_cast<float>(initial_face_count)] {
-    return edge_contractions.empty() || half_edge_mesh.faces().size() < static_cast<std::size_t>(target_face_count);
-  };
+  remove_virtual_pair_components_ = options.remove_virtual_pair_components;
+  if (options.virtual_pair_distance > 0.0f) CreateVirtualPairs(options.virtual_pair_distance);
+}
 
-  for (auto next_vertex_id = half_edge_mesh.vertices().size(); !is_simplified(); edge_contractions.pop()) {
-    const auto& edge_contraction = edge_contractions.top();
-    const auto& edge01 = edge_contraction->edge;
+MeshSimplifier::MeshSimplifier(HalfEdgeMesh half_edge_mesh, const std::size_t next_vertex_id)
+    : half_edge_mesh_{std::move(half_edge_mesh)},
+      progressive_mesh_{nullptr},
+      approximate_queue_samples_{0},
+      next_vertex_id_{next_vertex_id} {}
 
-    if (!edge_contraction->valid || WillDegenerate(edge01)) continue;
+MeshSimplifier MeshSimplifier::LoadCheckpoint(const std::filesystem::path& filepath) {
+  std::ifstream ifs{filepath, std::ios::binary};
+  if (!ifs.good()) throw std::runtime_error{std::format("Unable to open {}", filepath.string())};
 
-    const auto v0 = edge01->flip()->vertex();
-    const auto v1 = edge01->vertex();
+  try {
+    std::array<char, kCheckpointMagic.size()> magic{};
+    ifs.read(magic.data(), magic.size());
+    if (!ifs || magic != kCheckpointMagic) throw std::runtime_error{"Invalid checkpoint header"};
+    if (const auto version = binary::Read<std::uint32_t>(ifs); version != kCheckpointVersion) {
+      throw std::runtime_error{std::format("Unsupported checkpoint version {}", version)};
+    }
 
-    const auto& q0 = GetQuadric(*v0, quadrics);
-    const auto& q1 = GetQuadric(*v1, quadrics);
+    auto half_edge_mesh = HalfEdgeMesh{ifs};
+    MeshSimplifier mesh_simplifier{std::move(half_edge_mesh), binary::Read<std::uint64_t>(ifs)};
+    mesh_simplifier.max_error_ = binary::Read<float>(ifs);
+    mesh_simplifier.approximate_queue_samples_ = binary::Read<std::uint64_t>(ifs);
+    mesh_simplifier.checkpoint_interval_ = binary::Read<std::uint64_t>(ifs);
+    mesh_simplifier.checkpoint_path_ = filepath;
 
-    // only assign a new vertex ID when processing the next edge contraction
-    const auto& v_new = edge_contraction->vertex;
-    v_new->set_id(static_cast<int>(next_vertex_id++));
+    for (const auto& [vertex_id, quadric] : binary::ReadArray<QuadricRecord>(ifs)) {
+      mesh_simplifier.quadrics_.emplace(vertex_id, quadric);
+    }
 
-    // compute the error quadric for the new vertex
-    quadrics.emplace(v_new->id(), q0 + q1);
+    mesh_simplifier.attribute_weights_ = binary::Read<std::array<float, 2>>(ifs);
+    mesh_simplifier.wedge_quadrics_ = binary::ReadArray<AttributeQuadric>(ifs);
+    if (mesh_simplifier.wedge_quadrics_.size() != mesh_simplifier.half_edge_mesh_.wedges().size()) {
+      throw std::runtime_error{"Wedge error quadrics do not match half-edge mesh wedges"};
+    }
 
-    // invalidate entries in the priority queue that will be removed during the edge contraction
-    for (const auto& vi : {v0, v1}) {
-      auto edgeji = vi->edge();
-      do {
-        const auto min_edge = GetMinEdge(edgeji);
-        if (const auto iterator = valid_edges.find(hash_value(*min_edge)); iterator != valid_edges.end()) {
-          iterator->second->valid = false;
-          valid_edges.erase(iterator);
-        }
-        edgeji = edgeji->next()->flip();
-      } while (edgeji != vi->edge());
+    mesh_simplifier.pose_count_ = binary::Read<std::uint64_t>(ifs);
+    mesh_simplifier.pose_positions_ = binary::ReadArray<glm::vec3>(ifs);
+    mesh_simplifier.pose_quadrics_ = binary::ReadArray<glm::mat4>(ifs);
+
+    mesh_simplifier.remove_virtual_pair_components_ = binary::Read<bool>(ifs);
+    mesh_simplifier.contracted_vertices_ = binary::ReadArray<int>(ifs);
+    mesh_simplifier.vertex_components_ = binary::ReadArray<int>(ifs);
+    mesh_simplifier.merged_components_ = binary::ReadArray<int>(ifs);
+    mesh_simplifier.component_quadrics_ = binary::ReadArray<glm::mat4>(ifs);
+
+    mesh_simplifier.max_deviation_ = binary::Read<float>(ifs);
+    if (mesh_simplifier.max_deviation_ < std::numeric_limits<float>::infinity()) {
+      mesh_simplifier.original_surface_.emplace(binary::ReadArray<TriangleBvh::Triangle>(ifs));
+      mesh_simplifier.original_positions_ = binary::ReadArray<glm::vec3>(ifs);
+      mesh_simplifier.ReadFaceDeviations(ifs);
     }
 
-    // remove the edge from the mesh and attach incident edges to the new vertex
-    half_edge_mesh.Contract(*edge01, v_new);
+    const auto random_engine_state = binary::ReadArray<char>(ifs);
+    std::istringstream{std::string{random_engine_state.begin(), random_engine_state.end()}}
+        >> mesh_simplifier.random_engine_;
 
-    // add new edge contraction candidates for edges affected by the edge contraction
-    std::unordered_map<std::size_t, std::shared_ptr<const HalfEdge>> visited_edges;
-    const auto& vi = v_new;
-    auto edgeji = vi->edge();
-    do {
-      const auto vj = edgeji->flip()->vertex();
-      auto edgekj = vj->edge();
-      do {
-        const auto min_edge = GetMinEdge(edgekj);
-        if (const auto min_edge_key = hash_value(*min_edge); !visited_edges.contains(min_edge_key)) {
-          if (const auto iterator = valid_edges.find(min_edge_key); iterator != valid_edges.end()) {
-            // invalidate existing edge contraction candidate in the priority queue
-            iterator->second->valid = false;
-          }
-          const auto [new_vertex, new_cost] = GetOptimalEdgeContractionVertex(*min_edge, quadrics);
-          const auto new_edge_contraction = std::make_shared<EdgeContraction>(min_edge, new_vertex, new_cost);
-          valid_edges[min_edge_key] = new_edge_contraction;
-          edge_contractions.push(new_edge_contraction);
-          visited_edges.emplace(min_edge_key, min_edge);
-        }
-        edgekj = edgekj->next()->flip();
-      } while (edgekj != vj->edge());
-      edgeji = edgeji->next()->flip();
-    } while (edgeji != vi->edge());
+    mesh_simplifier.ReadEdgeContractions(ifs, mesh_simplifier.edge_contractions_);
+    mesh_simplifier.ReadEdgeContractions(ifs, mesh_simplifier.candidates_);
+
+    return mesh_simplifier;
+
+  } catch (const std::runtime_error& e) {
+    throw std::runtime_error{std::format("Unable to load checkpoint {}: {}", filepath.string(), e.what())};
+  }
+}
+
+void MeshSimplifier::SaveCheckpoint(const std::filesystem::path& filepath) const {
+  if (progressive_mesh_ != nullptr) {
+    throw std::logic_error{"Unable to checkpoint a mesh simplifier recording a progressive mesh"};
   }
 
-  std::clog << std::format(
-      "Mesh simplified from {} to {} triangles in {} second\n",
+  // replace the previous checkpoint only once the new one is complete in case the process is terminated while writing
+  const auto temporary_filepath = GetTemporaryPath(filepath);
+
+  {
+    std::ofstream ofs{temporary_filepath, std::ios::binary};
+    if (!ofs.good()) throw std::runtime_error{std::format("Unable to open {}", temporary_filepath.string())};
+
+    ofs.write(kCheckpointMagic.data(), kCheckpointMagic.size());
+    binary::Write(ofs, kCheckpointVersion);
+
+    half_edge_mesh_.Write(ofs);
+    binary::Write<std::uint64_t>(ofs, next_vertex_id_);
+    binary::Write(ofs, max_error_);
+    binary::Write<std::uint64_t>(ofs, approximate_queue_samples_);
+    binary::Write<std::uint64_t>(ofs, checkpoint_interval_);
+
+    // error quadrics of vertices removed from the mesh are never used again
+    std::vector<QuadricRecord> quadric_records;
+    quadric_records.reserve(half_edge_mesh_.vertices().size());
+    for (const auto vertex_id : half_edge_mesh_.vertices() | std::views::keys) {
+      if (const auto iterator = quadrics_.find(vertex_id); iterator != quadrics_.end()) {
+        quadric_records.push_back(QuadricRecord{.vertex_id = iterator->first, .quadric = iterator->second});
+      }
+    }
+    binary::WriteArray<QuadricRecord>(ofs, quadric_records);
+
+    binary::Write(ofs, attribute_weights_);
+    binary::WriteArray<AttributeQuadric>(ofs, wedge_quadrics_);
+
+    binary::Write<std::uint64_t>(ofs, pose_count_);
+    binary::WriteArray<glm::vec3>(ofs, pose_positions_);
+    binary::WriteArray<glm::mat4>(ofs, pose_quadrics_);
+
+    binary::Write(ofs, remove_virtual_pair_components_);
+    binary::WriteArray<int>(ofs, contracted_vertices_);
+    binary::WriteArray<int>(ofs, vertex_components_);
+    binary::WriteArray<int>(ofs, merged_components_);
+    binary::WriteArray<glm::mat4>(ofs, component_quadrics_);
+
+    binary::Write(ofs, max_deviation_);
+    if (original_surface_.has_value()) {
+      binary::WriteArray<TriangleBvh::Triangle>(ofs, original_surface_->triangles());
+      binary::WriteArray<glm::vec3>(ofs, original_positions_);
+      WriteFaceDeviations(ofs);
+    }
+
+    std::ostringstream random_engine_state;
+    random_engine_state << random_engine_;
+    binary::WriteArray<char>(ofs, random_engine_state.view());
+
+    WriteEdgeContractions(ofs, edge_contractions_);
+    WriteEdgeContractions(ofs, candidates_);
+
+    if (!ofs.flush()) throw std::runtime_error{std::format("Unable to write {}", temporary_filepath.string())};
+  }
+
+  std::filesystem::rename(temporary_filepath, filepath);
+}
+
+void MeshSimplifier::ReadEdgeContractions(std::istream& is,
+                                          std::vector<std::shared_ptr<EdgeContraction>>& edge_contractions) {
+  const auto& vertices = half_edge_mesh_.vertices();
+  const auto get_vertex = [&vertices](const int vertex_id) -> const Vertex& {
+    const auto iterator = vertices.find(vertex_id);
+    if (iterator == vertices.end()) {
+      throw std::runtime_error{std::format("Edge contraction refers to vertex {} which does not exist", vertex_id)};
+    }
+    return *iterator->second;
+  };
+
+  const auto count = binary::Read<std::uint64_t>(is);
+  edge_contractions.clear();
+
+  for (std::uint64_t i = 0; i < count; ++i) {
+    const auto candidate_type = binary::Read<CandidateType>(is);
+    const auto cost = binary::Read<float>(is);
+
+    switch (candidate_type) {
+      case CandidateType::kInvalid: {
+        // invalid candidates are only kept to preserve the layout of the queue and are discarded without inspection
+        auto& edge_contraction =
+            edge_contractions.emplace_back(std::make_shared<EdgeContraction>(nullptr, nullptr, cost));
+        edge_contraction->valid = false;
+        break;
+      }
+      case CandidateType::kEdge: {
+        const auto [v0_id, v1_id] = binary::Read<std::array<int, 2>>(is);
+        const auto edge_iterator = half_edge_mesh_.edges().find(hash_value(get_vertex(v0_id), get_vertex(v1_id)));
+        if (edge_iterator == half_edge_mesh_.edges().end()) {
+          throw std::runtime_error{
+              std::format("Edge contraction refers to edge ({},{}) which does not exist", v0_id, v1_id)};
+        }
+        const std::shared_ptr<const HalfEdge> edge01 = edge_iterator->second;
+        auto vertex = std::make_shared<Vertex>(binary::Read<glm::vec3>(is));
+        auto& edge_contraction = edge_contractions.emplace_back(
+            std::make_shared<EdgeContraction>(edge01, std::move(vertex), cost));
+        edge_contraction->pose_positions = binary::ReadArray<glm::vec3>(is);
+        valid_edges_.insert_or_assign(hash_value(*GetMinEdge(edge01)), edge_contraction);
+        break;
+      }
+      case CandidateType::kVirtualPair:
+        edge_contractions.push_back(std::make_shared<EdgeContraction>(binary::Read<std::array<int, 2>>(is), cost));
+        break;
+      default:
+        throw std::runtime_error{std::format("Invalid edge contraction type {}", static_cast<int>(candidate_type))};
+    }
+  }
+}
+
+void MeshSimplifier::WriteEdgeContractions(std::ostream& os,
+                                           const std::vector<std::shared_ptr<EdgeContraction>>& edge_contractions) {
+  binary::Write<std::uint64_t>(os, edge_contractions.size());
+
+  for (const auto& edge_contraction : edge_contractions) {
+    if (!edge_contraction->valid) {
+      binary::Write(os, CandidateType::kInvalid);
+      binary::Write(os, edge_contraction->cost);
+    } else if (const auto& edge01 = edge_contraction->edge; edge01 != nullptr) {
+      binary::Write(os, CandidateType::kEdge);
+      binary::Write(os, edge_contraction->cost);
+      binary::Write(os, std::array{edge01->flip()->vertex()->id(), edge01->vertex()->id()});
+      binary::Write(os, edge_contraction->vertex->position());
+      binary::WriteArray<glm::vec3>(os, edge_contraction->pose_positions);
+    } else {
+      binary::Write(os, CandidateType::kVirtualPair);
+      binary::Write(os, edge_contraction->cost);
+      binary::Write(os, edge_contraction->virtual_pair);
+    }
+  }
+}
+
+void MeshSimplifier::ReadFaceDeviations(std::istream& is) {
+  const auto& vertices = half_edge_mesh_.vertices();
+  const auto get_vertex = [&vertices](const int vertex_id) -> const Vertex& {
+    const auto iterator = vertices.find(vertex_id);
+    if (iterator == vertices.end()) {
+      throw std::runtime_error{std::format("Face deviation refers to vertex {} which does not exist", vertex_id)};
+    }
+    return *iterator->second;
+  };
+
+  const auto count = binary::Read<std::uint64_t>(is);
+  for (std::uint64_t i = 0; i < count; ++i) {
+    const auto [vertex_ids, bound] = binary::Read<FaceDeviationRecord>(is);
+    const auto face_key = hash_value(get_vertex(vertex_ids[0]), get_vertex(vertex_ids[1]), get_vertex(vertex_ids[2]));
+    if (!half_edge_mesh_.faces().contains(face_key)) {
+      throw std::runtime_error{std::format("Face deviation refers to face ({},{},{}) which does not exist",
+                                           vertex_ids[0],
+                                           vertex_ids[1],
+                                           vertex_ids[2])};
+    }
+
+    auto points = binary::ReadArray<int>(is);
+    if (std::ranges::any_of(points, [&](const auto point) {
+          return point < 0 || static_cast<std::size_t>(point) >= original_positions_.size();
+        })) {
+      throw std::runtime_error{"Face deviation refers to an original vertex which does not exist"};
+    }
+    face_deviations_.insert_or_assign(face_key, FaceDeviation{.bound = bound, .points = std::move(points)});
+  }
+}
+
+void MeshSimplifier::WriteFaceDeviations(std::ostream& os) const {
+  binary::Write<std::uint64_t>(os, half_edge_mesh_.faces().size());
+  for (const auto& [face_key, face] : half_edge_mesh_.faces()) {
+    const auto& face_deviation = face_deviations_.at(face_key);
+    binary::Write(os,
+                  FaceDeviationRecord{.vertex_ids = {face->v0()->id(), face->v1()->id(), face->v2()->id()},
+                                      .bound = face_deviation.bound});
+    binary::WriteArray<int>(os, face_deviation.points);
+  }
+}
+
+bool MeshSimplifier::IsLocked(const HalfEdge& edge01) const {
+  return half_edge_mesh_.IsLocked(*edge01.vertex()) || half_edge_mesh_.IsLocked(*edge01.flip()->vertex());
+}
+
+std::vector<std::vector<glm::vec3>> MeshSimplifier::GetPosePositions() const {
+  std::vector<std::vector<glm::vec3>> poses(pose_count_);
+  for (auto& pose : poses) pose.reserve(half_edge_mesh_.vertices().size());
+
+  for (const auto vertex_id : half_edge_mesh_.GetMeshVertexIds()) {
+    const auto offset = static_cast<std::size_t>(vertex_id) * pose_count_;
+    for (std::size_t i = 0; i < pose_count_; ++i) {
+      poses[i].push_back(pose_positions_[offset + i]);
+    }
+  }
+
+  return poses;
+}
+
+void MeshSimplifier::InitializePoses(const std::span<const std::vector<glm::vec3>> poses) {
+  const auto vertex_count = next_vertex_id_;
+  for (const auto& pose : poses) {
+    if (pose.size() != vertex_count) {
+      throw std::invalid_argument{
+          std::format("Pose with {} positions does not match mesh with {} vertices", pose.size(), vertex_count)};
+    }
+  }
+
+  pose_count_ = poses.size();
+  pose_positions_.resize(vertex_count * pose_count_);
+  pose_quadrics_.resize(vertex_count * pose_count_, glm::mat4{0.0f});
+
+  for (std::size_t i = 0; i < vertex_count; ++i) {
+    for (std::size_t j = 0; j < pose_count_; ++j) {
+      pose_positions_[i * pose_count_ + j] = poses[j][i];
+    }
+  }
+
+  // accumulate the plane of each face in each pose into the error quadrics of its vertices
+  for (const auto& face : half_edge_mesh_.faces() | std::views::values) {
+    const std::array vertex_ids{face->v0()->id(), face->v1()->id(), face->v2()->id()};
+
+    for (std::size_t j = 0; j < pose_count_; ++j) {
+      const auto& pose = poses[j];
+      const auto& p0 = pose[static_cast<std::size_t>(vertex_ids[0])];
+      const auto& p1 = pose[static_cast<std::size_t>(vertex_ids[1])];
+      const auto& p2 = pose[static_cast<std::size_t>(vertex_ids[2])];
+
+      // faces which degenerate in a pose do not constrain that pose
+      const auto normal = glm::cross(p1 - p0, p2 - p0);
+      const auto normal_magnitude = glm::length(normal);
+      if (normal_magnitude == 0.0f) continue;
+
+      const auto unit_normal = normal / normal_magnitude;
+      const glm::vec4 plane{unit_normal, -glm::dot(p0, unit_normal)};
+      const auto quadric = glm::outerProduct(plane, plane);
+      for (const auto vertex_id : vertex_ids) {
+        pose_quadrics_[static_cast<std::size_t>(vertex_id) * pose_count_ + j] += quadric;
+      }
+    }
+  }
+}
+
+void MeshSimplifier::InitializeDeviation(const float max_deviation) {
+  max_deviation_ = max_deviation;
+
+  std::vector<TriangleBvh::Triangle> triangles;
+  triangles.reserve(half_edge_mesh_.faces().size());
+  for (const auto& [face_key, face] : half_edge_mesh_.faces()) {
+    triangles.push_back(TriangleBvh::Triangle{face->v0()->position(), face->v1()->position(), face->v2()->position()});
+    face_deviations_.emplace(face_key, FaceDeviation{});
+  }
+  original_surface_.emplace(std::move(triangles));
+
+  // original vertices lie on the original surface and are initially measured against an incident face
+  original_positions_.reserve(half_edge_mesh_.vertices().size());
+  for (const auto& vertex : half_edge_mesh_.vertices() | std::views::values) {
+    auto& face_points = face_deviations_.at(hash_value(*vertex->edge()->face())).points;
+    face_points.push_back(static_cast<int>(original_positions_.size()));
+    original_positions_.push_back(vertex->position());
+  }
+}
+
+float MeshSimplifier::GetDeviation() const {
+  if (!original_surface_.has_value()) return std::numeric_limits<float>::infinity();
+  auto deviation = 0.0f;
+  for (const auto& face_deviation : face_deviations_ | std::views::values) {
+    deviation = std::max(deviation, face_deviation.bound);
+  }
+  return deviation;
+}
+
+bool MeshSimplifier::BoundDeviation(EdgeContraction& edge_contraction) const {
+  const auto& edge01 = edge_contraction.edge;
+  const auto v0 = edge01->flip()->vertex();
+  const auto v1 = edge01->vertex();
+  const auto& position = edge_contraction.vertex->position();
+  const auto* const closest_triangle = original_surface_->FindClosestTriangle(position, max_deviation_);
+  if (closest_triangle == nullptr) return false;
+
+  auto& face_deviations = edge_contraction.face_deviations;
+  face_deviations.clear();
+  std::vector<TriangleBvh::Triangle> triangles;
+  std::vector<int> points;
+
+  // bound the distance from each face that will replace a face incident to the edge to the original surface while
+  // gathering the original vertices measured against each face that will be removed
+  for (const auto& [vi, v_other] : {std::pair{v0, v1}, std::pair{v1, v0}}) {
+    auto edgeji = vi->edge();
+    do {
+      const auto vj = edgeji->flip()->vertex();
+      const auto vk = edgeji->next()->vertex();
+
+      // faces incident to both vertices are only visited from the first vertex
+      if (vi == v0 || (vj != v0 && vk != v0)) {
+        const auto& face_points = face_deviations_.at(hash_value(*edgeji->face())).points;
+        points.insert(points.end(), face_points.begin(), face_points.end());
+      }
+
+      if (vj != v_other && vk != v_other) {
+        const TriangleBvh::Triangle triangle{position, vk->position(), vj->position()};
+        const std::array closest_triangles{closest_triangle,
+                                           original_surface_->FindClosestTriangle(vk->position(), max_deviation_),
+                                           original_surface_->FindClosestTriangle(vj->position(), max_deviation_)};
+        const auto bound = GetDeviationBound(
+            *original_surface_, triangle, closest_triangles, max_deviation_, kMaxDeviationSubdivisions);
+        if (bound > max_deviation_) return false;
+        face_deviations.emplace_back(std::array{vk->id(), vj->id()}, FaceDeviation{.bound = bound, .points = {}});
+        triangles.push_back(triangle);
+      }
+
+      edgeji = edgeji->next()->flip();
+    } while (edgeji != vi->edge());
+  }
+
+  // the distance from an original vertex to the closest new face bounds its distance to the simplified surface
+  for (const auto point : points) {
+    const auto& original_position = original_positions_[static_cast<std::size_t>(point)];
+    auto min_distance = std::numeric_limits<float>::infinity();
+    std::size_t min_index = 0;
+    for (std::size_t i = 0; i < triangles.size(); ++i) {
+      if (const auto point_distance =
+              glm::distance(original_position, TriangleBvh::GetClosestPoint(original_position, triangles[i]));
+          point_distance < min_distance) {
+        min_distance = point_distance;
+        min_index = i;
+      }
+    }
+    if (min_distance > max_deviation_) return false;
+
+    auto& face_deviation = face_deviations[min_index].second;
+    face_deviation.bound = std::max(face_deviation.bound, min_distance);
+    face_deviation.points.push_back(point);
+  }
+
+  return true;
+}
+
+std::shared_ptr<MeshSimplifier::EdgeContraction> MeshSimplifier::CreateEdgeContraction(
+    const std::shared_ptr<const HalfEdge>& edge01) const {
+  auto [vertex, cost] = wedge_quadrics_.empty()
+                            ? GetOptimalEdgeContractionVertex(*edge01, quadrics_)
+                            : GetOptimalEdgeContractionVertex(*edge01,
+                                                              GetWedgeGroups(*edge01),
+                                                              wedge_quadrics_,
+                                                              half_edge_mesh_.wedges(),
+                                                              attribute_weights_);
+  auto edge_contraction = std::make_shared<EdgeContraction>(edge01, std::move(vertex), cost);
+
+  // the cost of an edge contraction is the sum of its costs in every pose
+  if (pose_count_ > 0) {
+    const auto v0_offset = static_cast<std::size_t>(edge01->flip()->vertex()->id()) * pose_count_;
+    const auto v1_offset = static_cast<std::size_t>(edge01->vertex()->id()) * pose_count_;
+    edge_contraction->pose_positions.reserve(pose_count_);
+
+    for (std::size_t i = 0; i < pose_count_; ++i) {
+      const auto pose_quadric = pose_quadrics_[v0_offset + i] + pose_quadrics_[v1_offset + i];
+      const auto [pose_position, pose_cost] =
+          GetOptimalPosition(pose_quadric, pose_positions_[v0_offset + i], pose_positions_[v1_offset + i]);
+      edge_contraction->pose_positions.push_back(pose_position);
+      edge_contraction->cost += pose_cost;
+    }
+  }
+
+  return edge_contraction;
+}
+
+void MeshSimplifier::Simplify(const std::size_t face_count, const float max_error) {
+  if (approximate_queue_samples_ > 0) {
+    SimplifyApproximate(face_count, max_error);
+    return;
+  }
+
+  while (!edge_contractions_.empty() && half_edge_mesh_.faces().size() >= face_count) {
+    // copy the top entry because new edge contraction candidates are pushed while it is being processed
+    const auto edge_contraction = edge_contractions_.front();
+    if (!edge_contraction->valid) {
+      PopEdgeContraction();
+      continue;
+    }
+    if (edge_contraction->edge == nullptr) {
+      PopEdgeContraction();
+
+      // virtual pairs are updated lazily because vertices in either connected component may have since changed
+      const auto prev_cost = edge_contraction->cost;
+      if (!UpdateVirtualPair(*edge_contraction)) continue;
+      if (edge_contraction->cost > prev_cost || edge_contraction->cost > max_error) {
+        Enqueue(edge_contraction);
+        if (edge_contraction->cost > prev_cost) continue;
+        break;
+      }
+
+      ContractVirtualPair(*edge_contraction);
+      max_error_ = std::max(max_error_, edge_contraction->cost);
+      UpdateCheckpoint();
+      continue;
+    }
+    if (WillDegenerate(edge_contraction->edge)) {
+      PopEdgeContraction();
+      continue;
+    }
+    if (edge_contraction->cost > max_error) break;
+    if (original_surface_.has_value() && !BoundDeviation(*edge_contraction)) {
+      // the edge is reconsidered when a subsequent edge contraction creates a new candidate for it
+      PopEdgeContraction();
+      continue;
+    }
+
+    PopEdgeContraction();
+    Contract(*edge_contraction);
+    max_error_ = std::max(max_error_, edge_contraction->cost);
+    UpdateCheckpoint();
+  }
+}
+
+void MeshSimplifier::SimplifyApproximate(const std::size_t face_count, const float max_error) {
+  while (!candidates_.empty() && half_edge_mesh_.faces().size() >= face_count) {
+    // choose the lowest cost of several randomly sampled candidates while discarding invalid candidates as they are
+    // encountered by swapping them with the last candidate in the pool
+    std::shared_ptr<EdgeContraction> edge_contraction;
+    for (std::size_t i = 0; i < approximate_queue_samples_ && !candidates_.empty();) {
+      std::uniform_int_distribution<std::size_t> distribution{0, candidates_.size() - 1};
+      auto& candidate = candidates_[distribution(random_engine_)];
+      if (!candidate->valid) {
+        candidate = std::move(candidates_.back());
+        candidates_.pop_back();
+        continue;
+      }
+      if (edge_contraction == nullptr || candidate->cost < edge_contraction->cost) edge_contraction = candidate;
+      ++i;
+    }
+
+    if (edge_contraction == nullptr) break;
+    if (WillDegenerate(edge_contraction->edge)) {
+      // the edge is reconsidered when a subsequent edge contraction creates a new candidate for it
+      edge_contraction->valid = false;
+      continue;
+    }
+    if (edge_contraction->cost > max_error) break;
+    if (original_surface_.has_value() && !BoundDeviation(*edge_contraction)) {
+      edge_contraction->valid = false;
+      continue;
+    }
+
+    Contract(*edge_contraction);
+    max_error_ = std::max(max_error_, edge_contraction->cost);
+    UpdateCheckpoint();
+  }
+}
+
+void MeshSimplifier::Enqueue(std::shared_ptr<EdgeContraction> edge_contraction) {
+  if (approximate_queue_samples_ > 0) {
+    candidates_.push_back(std::move(edge_contraction));
+  } else {
+    edge_contractions_.push_back(std::move(edge_contraction));
+    std::push_heap(edge_contractions_.begin(), edge_contractions_.end(), MinCostComparator{});
+  }
+}
+
+void MeshSimplifier::PopEdgeContraction() {
+  std::pop_heap(edge_contractions_.begin(), edge_contractions_.end(), MinCostComparator{});
+  edge_contractions_.pop_back();
+}
+
+void MeshSimplifier::UpdateCheckpoint() {
+  if (checkpoint_interval_ > 0 && ++contraction_count_ % checkpoint_interval_ == 0) {
+    SaveCheckpoint(checkpoint_path_);
+  }
+}
+
+void MeshSimplifier::Contract(const EdgeContraction& edge_contraction) {
+  const auto& edge01 = edge_contraction.edge;
+  const auto v0 = edge01->flip()->vertex();
+  const auto v1 = edge01->vertex();
+
+  const auto& q0 = GetQuadric(*v0, quadrics_);
+  const auto& q1 = GetQuadric(*v1, quadrics_);
+
+  // only assign a new vertex ID when processing the next edge contraction
+  const auto& v_new = edge_contraction.vertex;
+  v_new->set_id(static_cast<int>(next_vertex_id_++));
+
+  // compute the error quadric for the new vertex
+  quadrics_.emplace(v_new->id(), q0 + q1);
+
+  // compute positions and error quadrics for the new vertex in each additional pose
+  if (pose_count_ > 0) {
+    const auto v0_offset = static_cast<std::size_t>(v0->id()) * pose_count_;
+    const auto v1_offset = static_cast<std::size_t>(v1->id()) * pose_count_;
+    for (std::size_t i = 0; i < pose_count_; ++i) {
+      pose_positions_.push_back(edge_contraction.pose_positions[i]);
+      pose_quadrics_.push_back(pose_quadrics_[v0_offset + i] + pose_quadrics_[v1_offset + i]);
+    }
+  }
+
+  if (!vertex_components_.empty()) {
+    contracted_vertices_[v0->id()] = contracted_vertices_[v1->id()] = v_new->id();
+    contracted_vertices_.push_back(v_new->id());
+    vertex_components_.push_back(vertex_components_[v0->id()]);
+  }
+
+  // invalidate entries in the priority queue that will be removed during the edge contraction
+  for (const auto& vi : {v0, v1}) {
+    auto edgeji = vi->edge();
+    do {
+      const auto min_edge = GetMinEdge(edgeji);
+      if (const auto iterator = valid_edges_.find(hash_value(*min_edge)); iterator != valid_edges_.end()) {
+        iterator->second->valid = false;
+        valid_edges_.erase(iterator);
+      }
+      edgeji = edgeji->next()->flip();
+    } while (edgeji != vi->edge());
+  }
+
+  // record faces affected by the edge contraction so that it can later be undone as a vertex split
+  VertexSplit vertex_split;
+  if (progressive_mesh_ != nullptr) {
+    vertex_split.collapsed_vertices = {v0->id(), v1->id()};
+    vertex_split.vertex = v_new->id();
+    vertex_split.position = v_new->position();
+    RecordIncidentFaces(*v0, nullptr, vertex_split.removed_faces);
+    RecordIncidentFaces(*v1, v0.get(), vertex_split.removed_faces);
+  }
+
+  // merge wedges that meet across the edge and solve for the attributes of each wedge at the new vertex position
+  std::unordered_map<int, int> wedge_map;
+  for (const auto& wedge_group : wedge_quadrics_.empty() ? std::vector<std::vector<int>>{} : GetWedgeGroups(*edge01)) {
+    auto reduced_quadric =
+        ReduceWedgeGroup(wedge_group, wedge_quadrics_, half_edge_mesh_.wedges(), attribute_weights_);
+    const auto wedge_id = half_edge_mesh_.AddWedge(
+        GetWedge(GetOptimalAttributes(reduced_quadric, v_new->position()), attribute_weights_));
+    wedge_quadrics_.push_back(reduced_quadric.attribute_quadric);
+    for (const auto merged_wedge_id : wedge_group) wedge_map.emplace(merged_wedge_id, wedge_id);
+  }
+
+  // discard the deviation bounds of faces that will be removed by the edge contraction
+  if (original_surface_.has_value()) {
+    for (const auto& vi : {v0, v1}) {
+      auto edgeji = vi->edge();
+      do {
+        face_deviations_.erase(hash_value(*edgeji->face()));
+        edgeji = edgeji->next()->flip();
+      } while (edgeji != vi->edge());
+    }
+  }
+
+  // remove the edge from the mesh and attach incident edges to the new vertex
+  half_edge_mesh_.Contract(*edge01, v_new, wedge_map);
+
+  // assign the deviation bounds computed for each new face when the edge contraction was accepted
+  if (original_surface_.has_value()) {
+    auto edgeji = v_new->edge();
+    do {
+      const std::array face_vertex_ids{edgeji->next()->vertex()->id(), edgeji->flip()->vertex()->id()};
+      const auto iterator = std::ranges::find(edge_contraction.face_deviations,
+                                              face_vertex_ids,
+                                              [](const auto& face_deviation) { return face_deviation.first; });
+      assert(iterator != edge_contraction.face_deviations.end());
+      face_deviations_.insert_or_assign(hash_value(*edgeji->face()), iterator->second);
+      edgeji = edgeji->next()->flip();
+    } while (edgeji != v_new->edge());
+  }
+
+  if (progressive_mesh_ != nullptr) {
+    RecordIncidentFaces(*v_new, nullptr, vertex_split.added_faces);
+    progressive_mesh_->Append(std::move(vertex_split));
+  }
+
+  // add new edge contraction candidates for edges affected by the edge contraction
+  UpdateEdgeContractions(*v_new);
+}
+
+void MeshSimplifier::UpdateEdgeContractions(const Vertex& v0) {
+  std::unordered_map<std::size_t, std::shared_ptr<const HalfEdge>> visited_edges;
+  auto edgeji = v0.edge();
+  do {
+    // edges incident to a locked vertex are never contracted which also avoids traversing a mesh boundary
+    const auto vj = edgeji->flip()->vertex();
+    if (half_edge_mesh_.IsLocked(*vj)) {
+      edgeji = edgeji->next()->flip();
+      continue;
+    }
+    auto edgekj = vj->edge();
+    do {
+      const auto min_edge = GetMinEdge(edgekj);
+      if (IsLocked(*min_edge)) {
+        edgekj = edgekj->next()->flip();
+        continue;
+      }
+      if (const auto min_edge_key = hash_value(*min_edge); !visited_edges.contains(min_edge_key)) {
+        if (const auto iterator = valid_edges_.find(min_edge_key); iterator != valid_edges_.end()) {
+          // invalidate existing edge contraction candidate in the priority queue
+          iterator->second->valid = false;
+        }
+        auto new_edge_contraction = CreateEdgeContraction(min_edge);
+        valid_edges_[min_edge_key] = new_edge_contraction;
+        Enqueue(std::move(new_edge_contraction));
+        visited_edges.emplace(min_edge_key, min_edge);
+      }
+      edgekj = edgekj->next()->flip();
+    } while (edgekj != vj->edge());
+    edgeji = edgeji->next()->flip();
+  } while (edgeji != v0.edge());
+}
+
+std::vector<std::vector<int>> MeshSimplifier::GetWedgeGroups(const HalfEdge& edge01) const {
+  const auto edge10 = edge01.flip();
+  std::vector<int> wedge_ids;
+  for (const auto& vi : {edge10->vertex(), edge01.vertex()}) {
+    auto edgeji = vi->edge();
+    do {
+      if (std::ranges::find(wedge_ids, edgeji->wedge()) == wedge_ids.end()) wedge_ids.push_back(edgeji->wedge());
+      edgeji = edgeji->next()->flip();
+    } while (edgeji != vi->edge());
+  }
+
+  std::vector<std::size_t> parents(wedge_ids.size());
+  std::iota(parents.begin(), parents.end(), 0);
+  const auto find_root = [&](const int wedge_id) {
+    auto root = static_cast<std::size_t>(std::ranges::find(wedge_ids, wedge_id) - wedge_ids.begin());
+    if (root == wedge_ids.size()) {
+      throw std::logic_error{std::format("Wedge {} is not incident to edge ({},{})",
+                                         wedge_id,
+                                         edge10->vertex()->id(),
+                                         edge01.vertex()->id())};
+    }
+    while (parents[root] != root) root = parents[root];
+    return root;
+  };
+
+  // wedges at either vertex merge if they meet at the corners of a triangle removed by the edge contraction. this
+  // keeps an attribute seam along the edge while wedges on either side of it merge independently.
+  for (const auto& [w0, w1] : {std::pair{edge01.next()->next()->wedge(), edge01.wedge()},
+                               std::pair{edge10->wedge(), edge10->next()->next()->wedge()}}) {
+    parents[find_root(w0)] = find_root(w1);
+  }
+
+  std::vector<std::vector<int>> wedge_groups;
+  std::unordered_map<std::size_t, std::size_t> group_indices;
+  for (const auto wedge_id : wedge_ids) {
+    const auto [iterator, inserted] = group_indices.try_emplace(find_root(wedge_id), wedge_groups.size());
+    if (inserted) wedge_groups.emplace_back();
+    wedge_groups[iterator->second].push_back(wedge_id);
+  }
+
+  return wedge_groups;
+}
+
+void MeshSimplifier::CreateVirtualPairs(const float max_distance) {
+  const auto vertex_count = next_vertex_id_;
+  contracted_vertices_.resize(vertex_count);
+  std::iota(contracted_vertices_.begin(), contracted_vertices_.end(), 0);
+  vertex_components_.assign(vertex_count, -1);
+
+  // label connected components and accumulate the error quadric of each component
+  const auto& vertices = half_edge_mesh_.vertices();
+  for (const auto& [vertex_id, vertex] : vertices) {
+    if (vertex_components_[vertex_id] != -1) continue;
+
+    const auto component = static_cast<int>(component_quadrics_.size());
+    auto& component_quadric = component_quadrics_.emplace_back(0.0f);
+    std::vector<const Vertex*> component_vertices{vertex.get()};
+    vertex_components_[vertex_id] = component;
+
+    while (!component_vertices.empty()) {
+      const auto* const vi = component_vertices.back();
+      component_vertices.pop_back();
+      component_quadric += GetQuadric(*vi, quadrics_);
+
+      auto edgeji = vi->edge();
+      do {
+        if (const auto& vj = edgeji->flip()->vertex(); vertex_components_[vj->id()] == -1) {
+          vertex_components_[vj->id()] = component;
+          component_vertices.push_back(vj.get());
+        }
+        edgeji = edgeji->next()->flip();
+      } while (edgeji != vi->edge());
+    }
+  }
+  if (component_quadrics_.size() < 2) {
+    contracted_vertices_.clear();
+    vertex_components_.clear();
+    return;
+  }
+  merged_components_.resize(component_quadrics_.size());
+  std::iota(merged_components_.begin(), merged_components_.end(), 0);
+
+  // bin vertices in a uniform grid whose cells are the size of the maximum virtual pair distance
+  const auto get_cell = [max_distance](const glm::vec3& position) {
+    return glm::ivec3{glm::floor(position / max_distance)};
+  };
+  const auto get_cell_key = [](const glm::ivec3& cell) {
+    return std::hash<int>{}(cell.x) ^ (std::hash<int>{}(cell.y) << 21u) ^ (std::hash<int>{}(cell.z) << 42u);  // NOLINT
+  };
+  std::unordered_map<std::size_t, std::vector<const Vertex*>> grid;
+  for (const auto& vertex : vertices | std::views::values) {
+    grid[get_cell_key(get_cell(vertex->position()))].push_back(vertex.get());
+  }
+
+  // find the closest pair of vertices between each pair of nearby connected components
+  std::unordered_map<std::size_t, std::pair<float, std::array<int, 2>>> closest_pairs;
+  for (const auto& v0 : vertices | std::views::values) {
+    const auto cell = get_cell(v0->position());
+    const auto c0 = vertex_components_[v0->id()];
+
+    for (auto i = -1; i <= 1; ++i) {
+      for (auto j = -1; j <= 1; ++j) {
+        for (auto k = -1; k <= 1; ++k) {
+          const auto iterator = grid.find(get_cell_key(cell + glm::ivec3{i, j, k}));
+          if (iterator == grid.end()) continue;
+
+          for (const auto* const v1 : iterator->second) {
+            const auto c1 = vertex_components_[v1->id()];
+            if (c0 >= c1) continue;  // only consider each pair of connected components once
+
+            if (const auto distance = glm::distance(v0->position(), v1->position()); distance <= max_distance) {
+              const auto component_pair_key = static_cast<std::size_t>(c0) << 32u | static_cast<std::uint32_t>(c1);
+              const auto [closest_pair, inserted] =
+                  closest_pairs.try_emplace(component_pair_key, distance, std::array{v0->id(), v1->id()});
+              if (!inserted && distance < closest_pair->second.first) {
+                closest_pair->second = std::pair{distance, std::array{v0->id(), v1->id()}};
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  for (const auto& [distance, virtual_pair] : closest_pairs | std::views::values) {
+    auto edge_contraction = std::make_shared<EdgeContraction>(virtual_pair, 0.0f);
+    UpdateVirtualPair(*edge_contraction);
+    Enqueue(std::move(edge_contraction));
+  }
+}
+
+int MeshSimplifier::FindVertex(const int vertex_id) {
+  // follow the chain of edge contractions that replaced a vertex while compressing the path for later lookups
+  auto root_id = vertex_id;
+  while (contracted_vertices_[root_id] != root_id) root_id = contracted_vertices_[root_id];
+  for (auto id = vertex_id; id != root_id;) id = std::exchange(contracted_vertices_[id], root_id);
+  return root_id;
+}
+
+int MeshSimplifier::FindComponent(const int component) {
+  // follow the chain of virtual pairs that joined a component while compressing the path for later lookups
+  auto root = component;
+  while (merged_components_[root] != root) root = merged_components_[root];
+  for (auto c = component; c != root;) c = std::exchange(merged_components_[c], root);
+  return root;
+}
+
+bool MeshSimplifier::UpdateVirtualPair(EdgeContraction& virtual_pair) {
+  const auto& vertices = half_edge_mesh_.vertices();
+  const auto v0_iterator = vertices.find(FindVertex(virtual_pair.virtual_pair[0]));
+  const auto v1_iterator = vertices.find(FindVertex(virtual_pair.virtual_pair[1]));
+
+  assert(v0_iterator != vertices.end() && v1_iterator != vertices.end());
+
+  // a virtual pair is discarded if its connected components have since been joined
+  const auto& [v0_id, v0] = *v0_iterator;
+  const auto& [v1_id, v1] = *v1_iterator;
+  const auto c0 = FindComponent(vertex_components_[v0_id]);
+  const auto c1 = FindComponent(vertex_components_[v1_id]);
+  if (c0 == c1) return false;
+
+  if (!remove_virtual_pair_components_) {
+    // the triangles of a merged vertex form more than one fan which cannot be traversed to merge it again
+    if (half_edge_mesh_.IsLocked(*v0) || half_edge_mesh_.IsLocked(*v1)) return false;
+
+    const auto& q0 = GetQuadric(*v0, quadrics_);
+    const auto& q1 = GetQuadric(*v1, quadrics_);
+    const auto [position, cost] = GetOptimalPosition(q0 + q1, v0->position(), v1->position());
+
+    virtual_pair.virtual_pair = {v0_id, v1_id};
+    virtual_pair.vertex = std::make_shared<Vertex>(position);
+    virtual_pair.cost = cost;
+    return true;
+  }
+
+  // the cost of folding a connected component into a vertex is its accumulated error quadric evaluated at that vertex
+  const auto get_cost = [](const glm::mat4& quadric, const glm::vec3& position) {
+    const glm::vec4 homogeneous_position{position, 1.0f};
+    return glm::dot(homogeneous_position, quadric * homogeneous_position);
+  };
+  const auto cost01 = get_cost(component_quadrics_[c0], v1->position());
+  const auto cost10 = get_cost(component_quadrics_[c1], v0->position());
+
+  virtual_pair.virtual_pair = cost01 <= cost10 ? std::array{v0_id, v1_id} : std::array{v1_id, v0_id};
+  virtual_pair.cost = std::min(cost01, cost10);
+  return true;
+}
+
+void MeshSimplifier::ContractVirtualPair(const EdgeContraction& virtual_pair) {
+  const auto& [v0_id, v1_id] = virtual_pair.virtual_pair;
+  const auto v0 = half_edge_mesh_.vertices().at(v0_id);
+  const auto v1 = half_edge_mesh_.vertices().at(v1_id);
+  const auto c0 = FindComponent(vertex_components_[v0_id]);
+  const auto c1 = FindComponent(vertex_components_[v1_id]);
+  merged_components_[c0] = c1;
+
+  if (!remove_virtual_pair_components_) {
+    MergeVirtualPair(virtual_pair, *v0, *v1, c1);
+    return;
+  }
+
+  // invalidate entries in the priority queue for edges in the connected component that will be removed
+  std::unordered_set<int> visited_vertices{v0_id};
+  std::vector<std::shared_ptr<Vertex>> component_vertices{v0};
+  while (!component_vertices.empty()) {
+    const auto vi = std::move(component_vertices.back());
+    component_vertices.pop_back();
+
+    auto edgeji = vi->edge();
+    do {
+      if (const auto iterator = valid_edges_.find(hash_value(*GetMinEdge(edgeji))); iterator != valid_edges_.end()) {
+        iterator->second->valid = false;
+        valid_edges_.erase(iterator);
+      }
+      if (auto vj = edgeji->flip()->vertex(); visited_vertices.insert(vj->id()).second) {
+        component_vertices.push_back(std::move(vj));
+      }
+      edgeji = edgeji->next()->flip();
+    } while (edgeji != vi->edge());
+  }
+
+  // removed vertices resolve to the vertex they were folded into so that their virtual pairs join its component
+  for (const auto vertex_id : half_edge_mesh_.RemoveComponent(*v0)) {
+    quadrics_.erase(vertex_id);
+    contracted_vertices_[vertex_id] = v1_id;
+  }
+
+  // fold the error quadric of the removed component into the vertex so that error is still measured against it
+  component_quadrics_[c1] += component_quadrics_[c0];
+
+  const auto q1_iterator = quadrics_.find(v1_id);
+  assert(q1_iterator != quadrics_.end());
+  q1_iterator->second += component_quadrics_[c0];
+
+  UpdateEdgeContractions(*v1);
+}
+
+void MeshSimplifier::MergeVirtualPair(const EdgeContraction& virtual_pair,
+                                      const Vertex& v0,
+                                      const Vertex& v1,
+                                      const int component) {
+  // only assign a new vertex ID when processing the next virtual pair
+  const auto& v_new = virtual_pair.vertex;
+  v_new->set_id(static_cast<int>(next_vertex_id_++));
+  quadrics_.emplace(v_new->id(), GetQuadric(v0, quadrics_) + GetQuadric(v1, quadrics_));
+
+  contracted_vertices_[v0.id()] = contracted_vertices_[v1.id()] = v_new->id();
+  contracted_vertices_.push_back(v_new->id());
+  vertex_components_.push_back(component);
+
+  // invalidate entries in the priority queue for edges incident to either vertex which are replaced by the merge
+  for (const auto* const vi : {&v0, &v1}) {
+    auto edgeji = vi->edge();
+    do {
+      if (const auto iterator = valid_edges_.find(hash_value(*GetMinEdge(edgeji))); iterator != valid_edges_.end()) {
+        iterator->second->valid = false;
+        valid_edges_.erase(iterator);
+      }
+      edgeji = edgeji->next()->flip();
+    } while (edgeji != vi->edge());
+  }
+
+  // edges incident to the merged vertex are never contracted because it is locked so no new candidates are created
+  half_edge_mesh_.Merge(v0, v1, v_new);
+}
+
+MeshData mesh::Simplify(const MeshData& mesh,
+                        const float rate,
+                        ProgressiveMesh* const progressive_mesh,
+                        const SimplifierOptions& options) {
+  const auto initial_face_count = mesh.indices().size() / 3;
+  const auto target_face_count = GetTargetFaceCount(initial_face_count, rate);
+
+  const auto start_time = std::chrono::high_resolution_clock::now();
+  MeshSimplifier mesh_simplifier{mesh, progressive_mesh, options};
+  mesh_simplifier.Simplify(target_face_count);
+
+  std::clog << std::format(
+      "Mesh simplified from {} to {} triangles in {} second\n",
+      initial_face_count,
+      mesh_simplifier.face_count(),
+      std::chrono::duration<float>{std::chrono::high_resolution_clock::now() - start_time}.count());
+
+  return static_cast<MeshData>(mesh_simplifier.half_edge_mesh());
+}
+
+mesh::PosedMesh mesh::Simplify(const MeshData& mesh,
+                               const std::span<const std::vector<glm::vec3>> poses,
+                               const float rate) {
+  const auto initial_face_count = mesh.indices().size() / 3;
+  const auto target_face_count = GetTargetFaceCount(initial_face_count, rate);
+
+  const auto start_time = std::chrono::high_resolution_clock::now();
+  SimplifierOptions options;
+  options.poses = poses;
+  MeshSimplifier mesh_simplifier{mesh, nullptr, options};
+  mesh_simplifier.Simplify(target_face_count);
+
+  std::clog << std::format(
+      "Mesh with {} poses simplified from {} to {} triangles in {} second\n",
+      poses.size() + 1,
+      initial_face_count,
+      mesh_simplifier.face_count(),
+      std::chrono::duration<float>{std::chrono::high_resolution_clock::now() - start_time}.count());
+
+  return PosedMesh{.mesh = static_cast<MeshData>(mesh_simplifier.half_edge_mesh()),
+                   .poses = mesh_simplifier.GetPosePositions()};
+}
+
+MeshData mesh::Simplify(MeshSimplifier& mesh_simplifier, const float rate) {
+  const auto initial_face_count = mesh_simplifier.face_count();
+  const auto target_face_count = GetTargetFaceCount(initial_face_count, rate);
+
+  const auto start_time = std::chrono::high_resolution_clock::now();
+  mesh_simplifier.Simplify(target_face_count);
+
+  std::clog << std::format(
+      "Mesh simplified from {} to {} triangles in {} second\n",
+      initial_face_count,
+      mesh_simplifier.face_count(),
+      std::chrono::duration<float>{std::chrono::high_resolution_clock::now() - start_time}.count());
+
+  return static_cast<MeshData>(mesh_simplifier.half_edge_mesh());
+}
+
+std::vector<mesh::LevelOfDetail> mesh::SimplifyLods(const MeshData& mesh,
+                                                    const std::span<const LodTarget> targets,
+                                                    const SimplifierOptions& options) {
+  const auto initial_face_count = mesh.indices().size() / 3;
+  std::vector<std::size_t> target_face_counts;
+  target_face_counts.reserve(targets.size());
+
+  for (const auto& [rate, max_error] : targets) {
+    target_face_counts.push_back(GetTargetFaceCount(initial_face_count, rate));
+    if (max_error < 0.0f) {
+      throw std::invalid_argument{std::format("Invalid level of detail error threshold: {}", max_error)};
+    }
+  }
+
+  const auto start_time = std::chrono::high_resolution_clock::now();
+  MeshSimplifier mesh_simplifier{mesh, nullptr, options};
+  std::vector<LevelOfDetail> levels_of_detail;
+  levels_of_detail.reserve(targets.size());
+
+  // each level of detail resumes edge contraction from the state of the previous level
+  for (std::size_t i = 0; i < targets.size(); ++i) {
+    mesh_simplifier.Simplify(target_face_counts[i], targets[i].max_error);
+    levels_of_detail.push_back(LevelOfDetail{.mesh = static_cast<MeshData>(mesh_simplifier.half_edge_mesh()),
+                                             .face_count = mesh_simplifier.face_count(),
+                                             .max_error = mesh_simplifier.max_error()});
+  }
+
+  std::clog << std::format(
+      "Generated {} levels of detail from {} triangles in {} second\n",
+      levels_of_detail.size(),
       initial_face_count,
-      half_edge_mesh.faces().size(),
       std::chrono::duration<float>{std::chrono::high_resolution_clock::now() - start_time}.count());
 
-  return static_cast<Mesh>(half_edge_mesh);
+  return levels_of_detail;
 }
 
 }  // namespace gfx
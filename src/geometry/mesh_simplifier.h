@@ -1,20 +1,397 @@
 #ifndef GEOMETRY_MESH_SIMPLIFIER_H_
 #define GEOMETRY_MESH_SIMPLIFIER_H_
 
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <random>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+#include "geometry/half_edge_mesh.h"
+#include "geometry/mesh_data.h"
+#include "geometry/triangle_bvh.h"
+
 namespace gfx {
-class Mesh;
+class ProgressiveMesh;
+
+/** @brief Options that control how a mesh is simplified. */
+struct SimplifierOptions {
+  /**
+   * @brief The maximum distance in model space between two vertices in different connected components for them to be
+   *        considered a virtual pair. Virtual pairs are disabled when this value is zero.
+   * @details Contracting a virtual pair merges its two vertices into a single vertex at the position that minimizes
+   *          their combined error so that nearby disconnected parts are joined and simplified as one surface. The
+   *          merged vertex is locked because its triangles form two fans, and a virtual pair whose vertex was already
+   *          merged is discarded.
+   */
+  float virtual_pair_distance = 0.0f;
+
+  /**
+   * @brief Indicates if contracting a virtual pair should remove a connected component instead of merging vertices.
+   * @details The connected component with the lowest cost is folded into the vertex it is paired with. This allows
+   *          meshes comprised of many small disconnected parts to be simplified beyond the point where edge
+   *          contractions alone would degenerate each part, but each removal deletes every face of a part and may
+   *          overshoot the target face count by that many faces.
+   */
+  bool remove_virtual_pair_components = false;
+
+  /**
+   * @brief Vertex positions for additional poses of an animated mesh which share its connectivity.
+   * @details Error quadrics are accumulated from every pose so that a single simplified connectivity is suitable for
+   *          the entire animation and the optimal position of each new vertex is computed separately for each pose.
+   *          Each pose must have one position per mesh vertex.
+   */
+  std::span<const std::vector<glm::vec3>> poses;
+
+  /**
+   * @brief Indicates if vertices on a mesh boundary should be locked. This is required to simplify an open mesh.
+   * @details Locked vertices and the edges between them are never removed so that meshes which share a boundary (e.g.,
+   *          adjacent tiles in a tiled dataset) can be simplified independently and still stitch together without
+   *          cracks. Edges incident to a locked vertex are never contracted.
+   */
+  bool lock_boundary = false;
+
+  /** @brief The IDs of additional vertices to lock (e.g., vertices shared with an adjacent mesh). */
+  std::span<const int> locked_vertices;
+
+  /**
+   * @brief The number of randomly sampled candidates to choose the lowest cost edge contraction from. The exact
+   *        priority queue is used when this value is zero.
+   * @details Sampling a few candidates approximates the lowest cost edge contraction while avoiding the cost of
+   *          maintaining a priority queue. A larger sample produces a closer approximation.
+   * @see "Multiple Choice: A New Approach to Mesh Simplification" by Jianhua Wu and Leif Kobbelt (2002).
+   */
+  std::size_t approximate_queue_samples = 0;
+
+  /**
+   * @brief The number of edge contractions between checkpoints of the simplification state. Checkpoints are disabled
+   *        when this value is zero.
+   * @details A long running simplification can be resumed from its last checkpoint with
+   *          @c MeshSimplifier::LoadCheckpoint if the process is terminated.
+   */
+  std::size_t checkpoint_interval = 0;
+
+  /** @brief The file to save checkpoints to. Each checkpoint replaces the previous one. */
+  std::filesystem::path checkpoint_path;
+
+  /**
+   * @brief The scale of texture coordinates relative to model space positions in the error quadric of a mesh with
+   *        texture coordinates, or zero to discard texture coordinates. Larger values preserve texture coordinates
+   *        at the expense of geometry.
+   * @details Each wedge accumulates a generalized error quadric that measures the squared distance to the planes of
+   *          its triangles in a space spanning positions and scaled attributes. The optimal position of each new
+   *          vertex minimizes the error of all of its wedges and the attributes of each wedge are then solved for
+   *          that position. Vertices split at attribute seams are welded by position so that seams do not become
+   *          boundaries. Evaluating these quadrics makes simplification several times slower than geometry alone,
+   *          especially when many vertices are split (e.g., flat shaded normals). A mesh simplified without any
+   *          preserved attributes is not welded, and its normals are recomputed from the simplified faces.
+   * @see "Simplifying Surfaces with Color and Texture using Quadric Error Metrics" by Michael Garland and Paul S.
+   *      Heckbert (1998).
+   */
+  float texcoord_weight = 0.0f;
+
+  /**
+   * @brief The scale of normals relative to model space positions in the error quadric of a mesh with normals, or
+   *        zero to discard normals and recompute them from the simplified faces.
+   * @see texcoord_weight
+   */
+  float normal_weight = 0.0f;
+
+  /**
+   * @brief The maximum distance in model space between the simplified and original surface. Edge contractions that
+   *        would exceed it are rejected. The deviation is not bounded when this value is infinite.
+   * @details A bounding volume hierarchy over the original triangles bounds the distance from each new face to the
+   *          original surface, and each original vertex is measured against the simplified face it was last
+   *          reassigned to, so that every face carries an incrementally updated bound of its deviation in both
+   *          directions. This guarantees the result without an offline verification pass at the expense of rejecting
+   *          some edge contractions whose bound cannot be established, notably those creating faces much larger than
+   *          the maximum deviation. Only the rest pose of an animated mesh is bounded.
+   * @see "Mesh Reduction with Error Control" by Reinhard Klein, Gunther Liebich, and Wolfgang Straßer (1996).
+   */
+  float max_deviation = std::numeric_limits<float>::infinity();
+};
+
+/**
+ * @brief A mesh simplification session that incrementally contracts edges in order of increasing cost.
+ * @details The half-edge mesh, accumulated error quadrics, and queue of candidate edge contractions persist between
+ *          calls to @c Simplify so that simplification can be resumed without rebuilding any state from the
+ *          partially simplified mesh. Because error quadrics are never recomputed from simplified geometry, the error
+ *          of each vertex continues to be measured against the original surface.
+ */
+class MeshSimplifier {
+public:
+  /**
+   * @brief Creates a mesh simplifier.
+   * @param mesh The mesh to simplify.
+   * @param progressive_mesh An optional progressive mesh to record each edge contraction in. When provided, it is
+   *                         reset to @p mesh and must outlive the mesh simplifier.
+   * @param options Options that control how the mesh is simplified.
+   * @throw std::invalid_argument Thrown if virtual pairs are enabled while recording a progressive mesh, with
+   *                              additional poses, with locked vertices, with an approximate queue, or with a maximum
+   *                              deviation, if the virtual pair distance is negative, if checkpoints are enabled while
+   *                              recording a progressive mesh or without a checkpoint path, if an attribute weight is
+   *                              negative, if the maximum deviation is not positive, if a pose does not have one
+   *                              position per mesh vertex, if a locked vertex does not exist, or if the mesh has a
+   *                              boundary vertex that is not locked.
+   */
+  explicit MeshSimplifier(const MeshData& mesh,
+                          ProgressiveMesh* progressive_mesh = nullptr,
+                          const SimplifierOptions& options = {});
+
+  /**
+   * @brief Creates a mesh simplifier from a half-edge mesh without creating a @c MeshData first.
+   * @param half_edge_mesh The half-edge mesh to simplify. Its vertex IDs are the mesh vertex indices locked vertices
+   *                       and poses refer to.
+   * @param options Options that control how the mesh is simplified.
+   * @throw std::invalid_argument Thrown under the same conditions as when a mesh simplifier is created from a
+   *                              @c MeshData.
+   * @see obj_loader::LoadHalfEdgeMesh
+   */
+  explicit MeshSimplifier(HalfEdgeMesh half_edge_mesh, const SimplifierOptions& options = {});
+
+  /**
+   * @brief Restores a mesh simplification session from a checkpoint.
+   * @details The half-edge mesh, error quadrics, the exact layout of the queue of candidate edge contractions, and the
+   *          state of the random number generator are restored so that resuming simplification produces the same edge
+   *          contractions as a session that was never interrupted. The restored session continues to save checkpoints
+   *          to @p filepath at the interval it was created with.
+   * @param filepath The checkpoint file to read.
+   * @return The mesh simplification session saved in @p filepath.
+   * @throw std::runtime_error Thrown if the file cannot be opened or is not a valid checkpoint.
+   * @note Checkpoints use native byte order and are not portable between architectures.
+   */
+  [[nodiscard]] static MeshSimplifier LoadCheckpoint(const std::filesystem::path& filepath);
+
+  /**
+   * @brief Saves the current state of simplification to a checkpoint.
+   * @details The checkpoint is written to a temporary file that replaces @p filepath once complete so that an existing
+   *          checkpoint is never left partially written.
+   * @param filepath The checkpoint file to write.
+   * @throw std::logic_error Thrown if edge contractions are being recorded in a progressive mesh.
+   * @throw std::runtime_error Thrown if the checkpoint cannot be written.
+   */
+  void SaveCheckpoint(const std::filesystem::path& filepath) const;
+
+  /** @brief Gets the half-edge mesh in its current state of simplification. */
+  [[nodiscard]] const HalfEdgeMesh& half_edge_mesh() const noexcept { return half_edge_mesh_; }
+
+  /** @brief Gets the number of triangles in the current state of simplification. */
+  [[nodiscard]] std::size_t face_count() const noexcept { return half_edge_mesh_.faces().size(); }
+
+  /** @brief Gets the largest cost of any edge contraction performed so far. */
+  [[nodiscard]] float max_error() const noexcept { return max_error_; }
+
+  /**
+   * @brief Gets an upper bound of the distance between the simplified and original surface.
+   * @return The largest deviation bound of any face in the current state of simplification or infinity if
+   *         @c SimplifierOptions::max_deviation was not set.
+   * @note The distance from the original surface to the simplified surface is measured at original vertices.
+   */
+  [[nodiscard]] float GetDeviation() const;
+
+  /**
+   * @brief Gets vertex positions for each additional pose in the current state of simplification.
+   * @return The positions of each pose in @c SimplifierOptions::poses ordered consistently with the vertices of the
+   *         mesh produced by converting the half-edge mesh to a @c MeshData.
+   */
+  [[nodiscard]] std::vector<std::vector<glm::vec3>> GetPosePositions() const;
+
+  /**
+   * @brief Contracts edges until a target has been reached.
+   * @param face_count The number of triangles to reduce the mesh below.
+   * @param max_error The maximum cost of an edge contraction. Simplification stops early if the lowest cost edge
+   *                  contraction exceeds this value.
+   */
+  void Simplify(std::size_t face_count, float max_error = std::numeric_limits<float>::infinity());
+
+private:
+  struct EdgeContraction;
+
+  /** @brief An upper bound of the distance between a simplified face and the original surface. */
+  struct FaceDeviation {
+    float bound = 0.0f;
+    std::vector<int> points;  // indices of the original vertices measured against this face
+  };
+
+  /** @brief Orders edge contractions in a priority queue such that the lowest cost edge contraction is on top. */
+  struct MinCostComparator {
+    bool operator()(const std::shared_ptr<EdgeContraction>& lhs,
+                    const std::shared_ptr<EdgeContraction>& rhs) const noexcept;
+  };
+
+  MeshSimplifier(HalfEdgeMesh half_edge_mesh, ProgressiveMesh* progressive_mesh, const SimplifierOptions& options);
+  MeshSimplifier(HalfEdgeMesh half_edge_mesh, std::size_t next_vertex_id);
+
+  [[nodiscard]] bool IsLocked(const HalfEdge& edge01) const;
+  void InitializePoses(std::span<const std::vector<glm::vec3>> poses);
+  void InitializeDeviation(float max_deviation);
+  [[nodiscard]] bool BoundDeviation(EdgeContraction& edge_contraction) const;
+  [[nodiscard]] std::shared_ptr<EdgeContraction> CreateEdgeContraction(
+      const std::shared_ptr<const HalfEdge>& edge01) const;
+  void SimplifyApproximate(std::size_t face_count, float max_error);
+  void Enqueue(std::shared_ptr<EdgeContraction> edge_contraction);
+  void PopEdgeContraction();
+  void UpdateCheckpoint();
+  void ReadEdgeContractions(std::istream& is, std::vector<std::shared_ptr<EdgeContraction>>& edge_contractions);
+  static void WriteEdgeContractions(std::ostream& os,
+                                    const std::vector<std::shared_ptr<EdgeContraction>>& edge_contractions);
+  void ReadFaceDeviations(std::istream& is);
+  void WriteFaceDeviations(std::ostream& os) const;
+  void Contract(const EdgeContraction& edge_contraction);
+  void UpdateEdgeContractions(const Vertex& v0);
+  [[nodiscard]] std::vector<std::vector<int>> GetWedgeGroups(const HalfEdge& edge01) const;
+
+  void CreateVirtualPairs(float max_distance);
+  [[nodiscard]] int FindVertex(int vertex_id);
+  [[nodiscard]] int FindComponent(int component);
+  bool UpdateVirtualPair(EdgeContraction& virtual_pair);
+  void ContractVirtualPair(const EdgeContraction& virtual_pair);
+  void MergeVirtualPair(const EdgeContraction& virtual_pair, const Vertex& v0, const Vertex& v1, int component);
+
+  HalfEdgeMesh half_edge_mesh_;
+  ProgressiveMesh* progressive_mesh_;
+  std::unordered_map<std::size_t, glm::mat4> quadrics_;
+
+  // generalized error quadrics over a position and up to five attributes indexed by wedge ID. each is stored as the
+  // upper triangle of its symmetric 8x8 matrix followed by its linear and constant terms. the weight of an attribute
+  // the mesh does not have is zero.
+  std::array<float, 2> attribute_weights_{};
+  std::vector<std::array<double, 45>> wedge_quadrics_;  // NOLINT(*-magic-numbers)
+
+  // use a binary heap to sort edge contraction candidates by the cost of removing each edge. this is kept in a vector
+  // rather than a priority queue so that checkpoints can restore its exact layout which orders equal cost candidates
+  std::vector<std::shared_ptr<EdgeContraction>> edge_contractions_;
+
+  // this is used to invalidate existing priority queue entries as edges are updated or removed from the mesh
+  std::unordered_map<std::size_t, std::shared_ptr<EdgeContraction>> valid_edges_;
+
+  // when approximating the priority queue, candidates are sampled from an unordered pool instead
+  std::size_t approximate_queue_samples_;
+  std::vector<std::shared_ptr<EdgeContraction>> candidates_;
+  std::mt19937 random_engine_;
+
+  std::size_t next_vertex_id_;
+  float max_error_ = 0.0f;
+
+  std::size_t checkpoint_interval_ = 0, contraction_count_ = 0;
+  std::filesystem::path checkpoint_path_;
+
+  // used to resolve vertices in virtual pairs which may have been replaced by edge contractions and components which
+  // may have been joined by contracting a virtual pair
+  bool remove_virtual_pair_components_ = false;
+  std::vector<int> contracted_vertices_, vertex_components_, merged_components_;
+  std::vector<glm::mat4> component_quadrics_;
+
+  // positions and error quadrics for each additional pose indexed by vertex ID * pose count + pose index
+  std::size_t pose_count_ = 0;
+  std::vector<glm::vec3> pose_positions_;
+  std::vector<glm::mat4> pose_quadrics_;
+
+  // when the maximum deviation is bounded, the original surface and vertices are kept to measure simplified faces
+  float max_deviation_ = std::numeric_limits<float>::infinity();
+  std::optional<TriangleBvh> original_surface_;
+  std::vector<glm::vec3> original_positions_;
+  std::unordered_map<std::size_t, FaceDeviation> face_deviations_;
+};
 
 namespace mesh {
 
+/** @brief The criteria used to determine when a level of detail has been reached. */
+struct LodTarget {
+  /** @brief The percentage of triangles to be removed from the input mesh (e.g., .95 indicates 95%). */
+  float rate = 0.0f;
+
+  /**
+   * @brief The maximum quadric error of an edge contraction. The level of detail is reached early if the lowest cost
+   *        edge contraction exceeds this value.
+   */
+  float max_error = std::numeric_limits<float>::infinity();
+};
+
+/** @brief A simplified mesh in a level of detail chain. */
+struct LevelOfDetail {
+  /** @brief The simplified mesh. */
+  MeshData mesh;
+
+  /** @brief The number of triangles in the simplified mesh. */
+  std::size_t face_count = 0;
+
+  /** @brief The largest quadric error of any edge contraction performed to produce this level of detail. */
+  float max_error = 0.0f;
+};
+
+/** @brief A simplified animated mesh whose poses share a single connectivity. */
+struct PosedMesh {
+  /** @brief The simplified mesh in its rest pose. */
+  MeshData mesh;
+
+  /** @brief The vertex positions of each additional pose ordered consistently with the vertices of the mesh. */
+  std::vector<std::vector<glm::vec3>> poses;
+};
+
 /**
  * @brief Reduces the number of triangles in a mesh.
  * @param mesh The mesh to simplify.
  * @param rate The percentage of triangles to be removed (e.g., .95 indicates 95% of triangles should be removed).
+ * @param progressive_mesh An optional progressive mesh to record each edge contraction in. When provided, it is
+ *                         reset to @p mesh before simplification so that any level of detail between @p mesh and the
+ *                         returned mesh can later be extracted without running the simplifier again.
+ * @param options Options that control how the mesh is simplified.
  * @return A triangle mesh with @p rate percent of triangles removed from @p mesh.
  * @throw std::invalid_argument Thrown if the simplification rate is not in the interval [0,1].
  * @see docs/surface_simplification for a detailed description of this mesh simplification algorithm.
  */
-Mesh Simplify(const Mesh& mesh, float rate);
+MeshData Simplify(const MeshData& mesh,
+                  float rate,
+                  ProgressiveMesh* progressive_mesh = nullptr,
+                  const SimplifierOptions& options = {});
+
+/**
+ * @brief Reduces the number of triangles in an animated mesh while preserving a single connectivity for all poses.
+ * @param mesh The mesh to simplify which defines the connectivity and rest pose of the animation.
+ * @param poses Vertex positions for each additional pose. Each pose must have one position per vertex in @p mesh.
+ * @param rate The percentage of triangles to be removed (e.g., .95 indicates 95% of triangles should be removed).
+ * @return The simplified mesh in its rest pose and the optimal vertex positions of each pose in @p poses.
+ * @throw std::invalid_argument Thrown if the simplification rate is not in the interval [0,1] or if a pose does not
+ *                              have one position per vertex in @p mesh.
+ */
+PosedMesh Simplify(const MeshData& mesh, std::span<const std::vector<glm::vec3>> poses, float rate);
+
+/**
+ * @brief Resumes a mesh simplification session to further reduce the number of triangles in a mesh.
+ * @param mesh_simplifier The mesh simplification session to resume.
+ * @param rate The percentage of triangles to be removed from the current state of simplification.
+ * @return A triangle mesh with @p rate percent of triangles removed from the previously simplified mesh.
+ * @throw std::invalid_argument Thrown if the simplification rate is not in the interval [0,1].
+ */
+MeshData Simplify(MeshSimplifier& mesh_simplifier, float rate);
+
+/**
+ * @brief Generates a chain of progressively simplified meshes in a single pass.
+ * @param mesh The mesh to simplify.
+ * @param targets The criteria for each level of detail ordered from the finest to the coarsest level of detail.
+ * @param options Options that control how the mesh is simplified.
+ * @return A level of detail for each target in @p targets. Each level of detail is captured as its target is reached
+ *         during one continuous sequence of edge contractions so the cost of generating the entire chain is comparable
+ *         to generating the coarsest level of detail alone.
+ * @throw std::invalid_argument Thrown if a simplification rate is not in the interval [0,1] or if an error
+ *                              threshold is negative.
+ * @note Because each level of detail resumes from the previous level, a target that is already satisfied by the
+ *       previous level of detail produces a copy of that level.
+ */
+std::vector<LevelOfDetail> SimplifyLods(const MeshData& mesh,
+                                        std::span<const LodTarget> targets,
+                                        const SimplifierOptions& options = {});
 
 }  // namespace mesh
 }  // namespace gfx
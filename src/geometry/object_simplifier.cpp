@@ -0,0 +1,68 @@
+#include "geometry/object_simplifier.h"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "geometry/mesh_data.h"
+#include "geometry/parallel_for.h"
+
+namespace gfx {
+
+std::vector<ObjObject> mesh::SimplifyObjects(const std::span<const ObjObject> objects,
+                                             const float rate,
+                                             const SimplifierOptions& options,
+                                             const std::size_t thread_count) {
+  if (rate < 0.0f || rate > 1.0f) {
+    throw std::invalid_argument{std::format("Invalid mesh simplification rate: {}", rate)};
+  }
+  if (!options.poses.empty() || !options.locked_vertices.empty() || options.checkpoint_interval > 0) {
+    throw std::invalid_argument{"Poses, locked vertices, and checkpoints cannot be shared by multiple objects"};
+  }
+
+  const auto start_time = std::chrono::high_resolution_clock::now();
+
+  // schedule the largest objects first so that the last objects to finish are the smallest
+  const auto get_face_count = [objects](const std::size_t i) { return objects[i].mesh.indices().size() / 3; };
+  std::vector<std::size_t> schedule(objects.size());
+  std::iota(schedule.begin(), schedule.end(), 0);
+  std::ranges::stable_sort(schedule, std::ranges::greater{}, get_face_count);
+
+  // each object is converted back to mesh data by the worker thread that simplified it
+  std::vector<std::optional<MeshData>> simplified_meshes(objects.size());
+  std::vector<std::size_t> face_counts(objects.size(), 0);
+  ParallelFor(schedule.size(), thread_count, [&](const std::size_t i) {
+    const auto j = schedule[i];
+    MeshSimplifier mesh_simplifier{objects[j].mesh, nullptr, options};
+    mesh_simplifier.Simplify(static_cast<std::size_t>((1.0f - rate) * static_cast<float>(get_face_count(j))));
+    face_counts[j] = mesh_simplifier.face_count();
+    simplified_meshes[j].emplace(static_cast<MeshData>(mesh_simplifier.half_edge_mesh()));
+  });
+
+  std::size_t initial_face_count = 0, face_count = 0;
+  std::vector<ObjObject> simplified_objects;
+  simplified_objects.reserve(objects.size());
+
+  for (std::size_t i = 0; i < objects.size(); ++i) {
+    initial_face_count += get_face_count(i);
+    face_count += face_counts[i];
+    simplified_objects.push_back(ObjObject{.name = objects[i].name, .mesh = std::move(*simplified_meshes[i])});
+  }
+
+  std::clog << std::format(
+      "{} objects simplified from {} to {} triangles in {} second\n",
+      objects.size(),
+      initial_face_count,
+      face_count,
+      std::chrono::duration<float>{std::chrono::high_resolution_clock::now() - start_time}.count());
+
+  return simplified_objects;
+}
+
+}  // namespace gfx
@@ -0,0 +1,41 @@
+#ifndef GEOMETRY_OBJECT_SIMPLIFIER_H_
+#define GEOMETRY_OBJECT_SIMPLIFIER_H_
+
+#include <cstddef>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "geometry/mesh_simplifier.h"
+#include "io/obj_loader.h"
+
+namespace gfx {
+
+namespace mesh {
+
+/**
+ * @brief Reduces the number of triangles in each object of a multi-object mesh independently.
+ * @details Objects are simplified concurrently on worker threads in order of decreasing triangle count so that the
+ *          largest objects start first and a single large object does not delay the batch after every smaller object
+ *          has finished. Each simplified object is converted back to mesh data on the worker thread that simplified
+ *          it.
+ * @param objects The objects to simplify (e.g., as loaded by @c obj_loader::LoadObjects).
+ * @param rate The percentage of triangles to be removed from each object (e.g., .95 indicates 95% of triangles should
+ *             be removed).
+ * @param options Options that control how each object is simplified. Options that refer to the vertices of a single
+ *                mesh (poses and locked vertices) and checkpoints are not supported.
+ * @param thread_count The maximum number of worker threads used to simplify objects concurrently.
+ * @return A simplified mesh for each object in @p objects with the same name and in the same order.
+ * @throw std::invalid_argument Thrown if the simplification rate is not in the interval [0,1], if @p options refers
+ *                              to the vertices of a single mesh or enables checkpoints, or if an object cannot be
+ *                              simplified with @p options.
+ */
+std::vector<ObjObject> SimplifyObjects(std::span<const ObjObject> objects,
+                                       float rate,
+                                       const SimplifierOptions& options = {},
+                                       std::size_t thread_count = std::thread::hardware_concurrency());
+
+}  // namespace mesh
+}  // namespace gfx
+
+#endif  // GEOMETRY_OBJECT_SIMPLIFIER_H_
@@ -0,0 +1,51 @@
+#ifndef GEOMETRY_PARALLEL_FOR_H_
+#define GEOMETRY_PARALLEL_FOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace gfx {
+
+/**
+ * @brief Invokes a function for each index in a range on up to a maximum number of worker threads.
+ * @param count The number of indices to invoke @p function with.
+ * @param thread_count The maximum number of worker threads.
+ * @param function The function to invoke with each index in [0, @p count).
+ * @throw Rethrows the exception thrown for the lowest index so that errors are reported consistently with a serial
+ *        loop over the same range.
+ */
+template <typename F>
+void ParallelFor(const std::size_t count, const std::size_t thread_count, const F& function) {
+  std::vector<std::exception_ptr> exceptions(count);
+  std::atomic<std::size_t> next_index = 0;
+  const auto run = [&] {
+    for (auto i = next_index++; i < count; i = next_index++) {
+      try {
+        function(i);
+      } catch (...) {
+        exceptions[i] = std::current_exception();
+      }
+    }
+  };
+
+  if (const auto worker_count = std::clamp<std::size_t>(thread_count, 1, std::max<std::size_t>(count, 1));
+      worker_count == 1) {
+    run();
+  } else {
+    std::vector<std::jthread> workers;
+    workers.reserve(worker_count);
+    for (std::size_t i = 0; i < worker_count; ++i) workers.emplace_back(run);
+  }
+
+  for (const auto& exception : exceptions) {
+    if (exception != nullptr) std::rethrow_exception(exception);
+  }
+}
+
+}  // namespace gfx
+
+#endif  // GEOMETRY_PARALLEL_FOR_H_
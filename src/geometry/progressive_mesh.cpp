@@ -0,0 +1,133 @@
+#include "geometry/progressive_mesh.h"
+
+#include <cassert>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <glm/geometric.hpp>
+
+#include "geometry/half_edge_mesh.h"
+#include "geometry/mesh_data.h"
+
+namespace gfx {
+
+namespace {
+
+// sentinel value indicating an inactive vertex
+constexpr auto kInvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+/**
+ * @brief Gets a canonical ordering of face vertex IDs such that the vertex with the lowest ID is first.
+ * @param v0,v1,v2 The face vertex IDs in counter-clockwise order.
+ * @return The face vertex IDs ordered by the lowest ID with winding order preserved.
+ * @note This must match the ordering used by @c Face so that recorded faces can be compared by value.
+ */
+VertexSplit::Face GetMinVertexOrder(const int v0, const int v1, const int v2) noexcept {
+  if (v0 < v1 && v0 < v2) return VertexSplit::Face{v0, v1, v2};
+  if (v1 < v2) return VertexSplit::Face{v1, v2, v0};
+  return VertexSplit::Face{v2, v0, v1};
+}
+
+}  // namespace
+
+std::size_t ProgressiveMesh::FaceHash::operator()(const VertexSplit::Face& face) const noexcept {
+  // NOLINTBEGIN(*-magic-numbers)
+  auto seed = static_cast<std::size_t>(static_cast<std::uint32_t>(face[0])) << 32u
+              | static_cast<std::uint32_t>(face[1]);
+  seed = ((seed ^ (seed >> 30u)) * 0xBF58476D1CE4E5B9u) ^ static_cast<std::uint32_t>(face[2]);
+  seed = (seed ^ (seed >> 27u)) * 0x94D049BB133111EBu;
+  return seed ^ (seed >> 31u);
+  // NOLINTEND(*-magic-numbers)
+}
+
+ProgressiveMesh::ProgressiveMesh(const MeshData& mesh)
+    : positions_{mesh.positions()}, model_transform_{mesh.model_transform()} {
+  // use the same vertex IDs as a half-edge mesh which welds vertices split at attribute seams
+  const auto corner_vertex_ids = HalfEdgeMesh::GetCornerVertexIds(mesh);
+  faces_.reserve(corner_vertex_ids.size() / 3);
+
+  for (std::size_t i = 0; i < corner_vertex_ids.size(); i += 3) {
+    faces_.insert(GetMinVertexOrder(corner_vertex_ids[i], corner_vertex_ids[i + 1], corner_vertex_ids[i + 2]));
+  }
+}
+
+void ProgressiveMesh::Append(VertexSplit vertex_split) {
+  if (std::cmp_not_equal(vertex_split.vertex, positions_.size())) {
+    throw std::invalid_argument{std::format("Unexpected vertex split ID: {}", vertex_split.vertex)};
+  }
+  positions_.push_back(vertex_split.position);
+  vertex_splits_.push_back(std::move(vertex_split));
+}
+
+void ProgressiveMesh::SetFaceCount(const std::size_t face_count) {
+  while (next_vertex_split_ < vertex_splits_.size() && faces_.size() > face_count) {
+    Collapse(vertex_splits_[next_vertex_split_++]);
+  }
+
+  while (next_vertex_split_ > 0) {
+    const auto& vertex_split = vertex_splits_[next_vertex_split_ - 1];
+    if (faces_.size() - vertex_split.added_faces.size() + vertex_split.removed_faces.size() > face_count) break;
+    Split(vertex_split);
+    --next_vertex_split_;
+  }
+}
+
+MeshData ProgressiveMesh::ToMesh() const {
+  std::vector<glm::vec3> vertex_normals(positions_.size(), glm::vec3{0.0f});
+  for (const auto& [v0, v1, v2] : faces_) {
+    // the cross product magnitude is proportional to the face area which weights its contribution to vertex normals
+    const auto normal = glm::cross(positions_[v1] - positions_[v0], positions_[v2] - positions_[v0]);
+    vertex_normals[v0] += normal;
+    vertex_normals[v1] += normal;
+    vertex_normals[v2] += normal;
+  }
+
+  std::vector<std::uint32_t> index_map(positions_.size(), kInvalidIndex);
+  for (const auto& face : faces_) {
+    for (const auto vertex_id : face) index_map[vertex_id] = 0;
+  }
+
+  std::vector<glm::vec3> positions;
+  std::vector<glm::vec3> normals;
+  for (std::uint32_t i = 0, vertex_id = 0; vertex_id < index_map.size(); ++vertex_id) {
+    if (index_map[vertex_id] != kInvalidIndex) {
+      positions.push_back(positions_[vertex_id]);
+      normals.push_back(glm::normalize(vertex_normals[vertex_id]));
+      index_map[vertex_id] = i++;  // map vertex IDs to new index positions
+    }
+  }
+
+  std::vector<std::uint32_t> indices;
+  indices.reserve(faces_.size() * 3);
+  for (const auto& face : faces_) {
+    for (const auto vertex_id : face) indices.push_back(index_map[vertex_id]);
+  }
+
+  return MeshData{std::move(positions), std::move(normals), {}, std::move(indices), model_transform_};
+}
+
+MeshData ProgressiveMesh::Extract(const std::size_t face_count) {
+  SetFaceCount(face_count);
+  return ToMesh();
+}
+
+void ProgressiveMesh::Collapse(const VertexSplit& vertex_split) {
+  for (const auto& face : vertex_split.removed_faces) {
+    [[maybe_unused]] const auto erased = faces_.erase(face);
+    assert(erased == 1);
+  }
+  faces_.insert(vertex_split.added_faces.begin(), vertex_split.added_faces.end());
+}
+
+void ProgressiveMesh::Split(const VertexSplit& vertex_split) {
+  for (const auto& face : vertex_split.added_faces) {
+    [[maybe_unused]] const auto erased = faces_.erase(face);
+    assert(erased == 1);
+  }
+  faces_.insert(vertex_split.removed_faces.begin(), vertex_split.removed_faces.end());
+}
+
+}  // namespace gfx
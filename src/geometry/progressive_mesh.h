@@ -0,0 +1,117 @@
+#ifndef GEOMETRY_PROGRESSIVE_MESH_H_
+#define GEOMETRY_PROGRESSIVE_MESH_H_
+
+#include <array>
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+namespace gfx {
+class MeshData;
+
+/**
+ * @brief A compact record of an edge contraction that can be replayed to coarsen a mesh or undone (i.e., applied as
+ *        a vertex split) to refine it.
+ */
+struct VertexSplit {
+  /** @brief A triangle face represented by vertex IDs in the same canonical order used by @c Face. */
+  using Face = std::array<int, 3>;
+
+  /** @brief The IDs of the two vertices collapsed by the edge contraction. */
+  std::array<int, 2> collapsed_vertices{};
+
+  /** @brief The ID of the vertex created by the edge contraction. */
+  int vertex = 0;
+
+  /** @brief The position of the vertex created by the edge contraction. */
+  glm::vec3 position{0.0f};
+
+  /** @brief Faces incident to the collapsed vertices which are removed by the edge contraction. */
+  std::vector<Face> removed_faces;
+
+  /** @brief Faces incident to the new vertex which are added by the edge contraction. */
+  std::vector<Face> added_faces;
+};
+
+/**
+ * @brief A triangle mesh represented by a full resolution mesh and an ordered sequence of edge contractions.
+ * @details Level of detail is controlled by a cursor into the sequence of recorded edge contractions. Moving the
+ *          cursor forward replays edge contractions and moving it backward undoes them as vertex splits. Because each
+ *          record only stores faces affected by a single edge contraction, moving between levels of detail takes time
+ *          proportional to the number of faces changed rather than the size of the mesh.
+ * @see "Progressive Meshes" by Hugues Hoppe (SIGGRAPH 1996).
+ */
+class ProgressiveMesh {
+public:
+  /** @brief A hash function for faces represented by vertex IDs. */
+  struct FaceHash {
+    std::size_t operator()(const VertexSplit::Face& face) const noexcept;
+  };
+
+  /**
+   * @brief Creates a progressive mesh with no recorded edge contractions.
+   * @param mesh The full resolution indexed triangle mesh. Vertices split at attribute seams are welded as they are
+   *             by @c HalfEdgeMesh and attributes are not preserved.
+   */
+  explicit ProgressiveMesh(const MeshData& mesh);
+
+  /** @brief Gets vertex positions indexed by vertex ID including vertices created by recorded edge contractions. */
+  [[nodiscard]] const std::vector<glm::vec3>& positions() const noexcept { return positions_; }
+
+  /** @brief Gets the faces in the current level of detail. */
+  [[nodiscard]] const std::unordered_set<VertexSplit::Face, FaceHash>& faces() const noexcept { return faces_; }
+
+  /** @brief Gets the affine transform to apply to the mesh in model space. */
+  [[nodiscard]] const glm::mat4& model_transform() const noexcept { return model_transform_; }
+
+  /** @brief Gets the recorded edge contractions ordered from the full resolution to the base mesh. */
+  [[nodiscard]] const std::vector<VertexSplit>& vertex_splits() const noexcept { return vertex_splits_; }
+
+  /** @brief Gets the number of recorded edge contractions applied to the current level of detail. */
+  [[nodiscard]] std::size_t collapse_count() const noexcept { return next_vertex_split_; }
+
+  /** @brief Gets the number of faces in the current level of detail. */
+  [[nodiscard]] std::size_t face_count() const noexcept { return faces_.size(); }
+
+  /**
+   * @brief Appends an edge contraction to the end of the recorded sequence.
+   * @param vertex_split The edge contraction to append. Its vertex ID must be one greater than any previous ID.
+   * @throw std::invalid_argument Thrown if the vertex ID does not immediately follow the last recorded vertex ID.
+   */
+  void Append(VertexSplit vertex_split);
+
+  /**
+   * @brief Moves to a level of detail.
+   * @param face_count The maximum number of triangles in the level of detail.
+   * @note The finest level of detail with at most @p face_count triangles is selected. If no such level of detail
+   *       was recorded, the base mesh is selected instead.
+   */
+  void SetFaceCount(std::size_t face_count);
+
+  /** @brief Gets the triangle mesh for the current level of detail. */
+  [[nodiscard]] MeshData ToMesh() const;
+
+  /**
+   * @brief Gets a triangle mesh at a specific level of detail.
+   * @param face_count The maximum number of triangles in the level of detail.
+   * @return The triangle mesh for the finest level of detail with at most @p face_count triangles.
+   */
+  [[nodiscard]] MeshData Extract(std::size_t face_count);
+
+private:
+  void Collapse(const VertexSplit& vertex_split);
+  void Split(const VertexSplit& vertex_split);
+
+  std::vector<glm::vec3> positions_;
+  std::vector<VertexSplit> vertex_splits_;
+  std::unordered_set<VertexSplit::Face, FaceHash> faces_;
+  std::size_t next_vertex_split_ = 0;
+  glm::mat4 model_transform_;
+};
+
+}  // namespace gfx
+
+#endif  // GEOMETRY_PROGRESSIVE_MESH_H_
@@ -0,0 +1,317 @@
+#include "geometry/simplification_cache.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include "geometry/binary_stream.h"
+
+namespace gfx {
+
+namespace {
+
+/** @brief Identifies a file as a simplification cache entry. */
+constexpr std::array kEntryMagic{'G', 'F', 'X', 'S', 'I', 'M', 'P', '\0'};
+
+/**
+ * @brief The version of the cache entry format and of the simplification algorithm. This must be incremented when
+ *        either changes so that results produced by an earlier version are no longer found.
+ */
+constexpr std::uint32_t kEntryVersion = 2;
+
+/** @brief The file extension of cache entries. */
+constexpr std::string_view kEntryExtension = ".simplified";
+
+/** @brief The kinds of simplification results which are hashed so that their keys are always distinct. */
+enum class EntryKind : std::uint8_t { kMesh, kLods };
+
+/**
+ * @brief Computes a 128-bit FNV-1a hash incrementally.
+ * @details Keys are not verified against the input they were computed from when an entry is found, so the hash is
+ *          wide enough that distinct simplifications sharing a key is not a practical concern for any cache size.
+ * @see http://www.isthe.com/chongo/tech/comp/fnv/
+ */
+class Fnv1aHash {
+public:
+  /** @brief Hashes the object representation of a trivially copyable value. */
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  void Update(const T& value) noexcept {
+    Update(std::as_bytes(std::span{&value, 1}));
+  }
+
+  /** @brief Hashes a contiguous sequence of values preceded by its size so that adjacent sequences are distinct. */
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  void UpdateArray(const std::span<const T> values) noexcept {
+    Update<std::uint64_t>(values.size());
+    Update(std::as_bytes(values));
+  }
+
+  void Update(const std::span<const std::byte> bytes) noexcept {
+    for (const auto byte : bytes) {
+      low_ ^= static_cast<std::uint64_t>(byte);
+      Multiply();
+    }
+  }
+
+  /** @brief Gets the most and least significant 64 bits of the hash. */
+  [[nodiscard]] std::array<std::uint64_t, 2> value() const noexcept { return {high_, low_}; }
+
+private:
+  /**
+   * @brief Multiplies the hash by the FNV prime 2^88 + 0x13b modulo 2^128.
+   * @details The product is computed with 64-bit arithmetic since not every supported compiler has a 128-bit integer.
+   */
+  void Multiply() noexcept {
+    constexpr std::uint64_t kLowMask = 0xffffffff;
+    const auto low_product = (low_ & kLowMask) * kPrimeLow;  // each partial product is less than 2^41
+    const auto middle_product = (low_ >> 32u) * kPrimeLow + (low_product >> 32u);
+    high_ = high_ * kPrimeLow + (middle_product >> 32u) + (low_ << (kPrimeShift - 64u));
+    low_ = (middle_product << 32u) | (low_product & kLowMask);
+  }
+
+  static constexpr std::uint64_t kPrimeLow = 0x13b;
+  static constexpr std::uint64_t kPrimeShift = 88;
+
+  std::uint64_t high_ = 0x6c62272e07bb0142;
+  std::uint64_t low_ = 0x62b821756295c58d;
+};
+
+/**
+ * @brief Gets a path beside a cache entry to write it to before it is renamed into place.
+ * @details The path has a random suffix so that processes and threads inserting the same key concurrently never write
+ *          to the same file. Its extension is not the entry extension so that it is never found or evicted.
+ */
+std::filesystem::path GetTemporaryPath(const std::filesystem::path& entry_path) {
+  thread_local std::mt19937_64 generator{std::random_device{}()};
+  auto temporary_path = entry_path;
+  temporary_path += std::format(".{:016x}.tmp", generator());
+  return temporary_path;
+}
+
+/**
+ * @brief Hashes a mesh and every simplifier option that affects the result of simplification.
+ * @param mesh The mesh to simplify.
+ * @param options Options that control how the mesh is simplified.
+ * @return A hash to which the simplification target is added.
+ */
+Fnv1aHash HashSimplification(const MeshData& mesh, const SimplifierOptions& options) {
+  Fnv1aHash hash;
+  hash.Update(kEntryVersion);
+
+  hash.UpdateArray<glm::vec3>(mesh.positions());
+  hash.UpdateArray<glm::vec3>(mesh.normals());
+  hash.UpdateArray<glm::vec2>(mesh.texcoords());
+  hash.UpdateArray<std::uint32_t>(mesh.indices());
+  hash.Update(mesh.model_transform());
+
+  hash.Update(options.virtual_pair_distance);
+  hash.Update(options.remove_virtual_pair_components);
+  hash.Update<std::uint64_t>(options.poses.size());
+  for (const auto& pose : options.poses) hash.UpdateArray<glm::vec3>(pose);
+  hash.Update(options.lock_boundary);
+  hash.UpdateArray(options.locked_vertices);
+  hash.Update<std::uint64_t>(options.approximate_queue_samples);
+  hash.Update(options.texcoord_weight);
+  hash.Update(options.normal_weight);
+  hash.Update(options.max_deviation);
+
+  return hash;
+}
+
+/** @brief Gets the fixed-width hexadecimal representation of a hash used as a cache key. */
+std::string ToKey(const Fnv1aHash& hash) {
+  const auto [high, low] = hash.value();
+  return std::format("{:016x}{:016x}", high, low);
+}
+
+/** @brief Writes a level of detail to a binary stream. */
+void WriteLod(std::ostream& os, const mesh::LevelOfDetail& lod) {
+  binary::Write<std::uint64_t>(os, lod.face_count);
+  binary::Write(os, lod.max_error);
+  binary::Write(os, lod.mesh.model_transform());
+  binary::WriteArray<glm::vec3>(os, lod.mesh.positions());
+  binary::WriteArray<glm::vec3>(os, lod.mesh.normals());
+  binary::WriteArray<glm::vec2>(os, lod.mesh.texcoords());
+  binary::WriteArray<std::uint32_t>(os, lod.mesh.indices());
+}
+
+/** @brief Reads a level of detail previously written to a binary stream by @c WriteLod. */
+mesh::LevelOfDetail ReadLod(std::istream& is) {
+  const auto face_count = binary::Read<std::uint64_t>(is);
+  const auto max_error = binary::Read<float>(is);
+  const auto model_transform = binary::Read<glm::mat4>(is);
+  auto positions = binary::ReadArray<glm::vec3>(is);
+  auto normals = binary::ReadArray<glm::vec3>(is);
+  auto texcoords = binary::ReadArray<glm::vec2>(is);
+  auto indices = binary::ReadArray<std::uint32_t>(is);
+  return mesh::LevelOfDetail{.mesh = MeshData{std::move(positions),
+                                              std::move(normals),
+                                              std::move(texcoords),
+                                              std::move(indices),
+                                              model_transform},
+                             .face_count = static_cast<std::size_t>(face_count),
+                             .max_error = max_error};
+}
+
+/** @brief Inserts a simplification result into a cache reporting rather than propagating a failure to write it. */
+void TryInsert(const SimplificationCache& cache,
+               const std::string& key,
+               const std::span<const mesh::LevelOfDetail> lods) {
+  try {
+    cache.Insert(key, lods);
+  } catch (const std::exception& e) {
+    std::clog << std::format("Unable to cache simplification {}: {}\n", key, e.what());
+  }
+}
+
+}  // namespace
+
+SimplificationCache::SimplificationCache(std::filesystem::path directory, const std::uintmax_t max_size)
+    : directory_{std::move(directory)}, max_size_{max_size} {
+  std::filesystem::create_directories(directory_);
+}
+
+std::string SimplificationCache::GetKey(const MeshData& mesh, const float rate, const SimplifierOptions& options) {
+  auto hash = HashSimplification(mesh, options);
+  hash.Update(EntryKind::kMesh);
+  hash.Update(rate);
+  return ToKey(hash);
+}
+
+std::string SimplificationCache::GetKey(const MeshData& mesh,
+                                        const std::span<const mesh::LodTarget> targets,
+                                        const SimplifierOptions& options) {
+  auto hash = HashSimplification(mesh, options);
+  hash.Update(EntryKind::kLods);
+  hash.Update<std::uint64_t>(targets.size());
+  for (const auto& [rate, max_error] : targets) {
+    hash.Update(rate);
+    hash.Update(max_error);
+  }
+  return ToKey(hash);
+}
+
+std::optional<std::vector<mesh::LevelOfDetail>> SimplificationCache::Find(const std::string& key) const {
+  const auto entry_path = GetEntryPath(key);
+  std::ifstream ifs{entry_path, std::ios::binary};
+  if (!ifs.good()) return std::nullopt;
+
+  try {
+    std::array<char, kEntryMagic.size()> magic{};
+    ifs.read(magic.data(), magic.size());
+    if (magic != kEntryMagic || binary::Read<std::uint32_t>(ifs) != kEntryVersion) return std::nullopt;
+
+    std::vector<mesh::LevelOfDetail> lods;
+    for (auto lod_count = binary::Read<std::uint64_t>(ifs); lod_count > 0; --lod_count) lods.push_back(ReadLod(ifs));
+
+    std::error_code error_code;  // the entry may have been evicted by another process after it was read
+    std::filesystem::last_write_time(entry_path, std::filesystem::file_time_type::clock::now(), error_code);
+    return lods;
+  } catch (const std::exception& e) {
+    std::clog << std::format("Ignoring simplification cache entry {}: {}\n", entry_path.generic_string(), e.what());
+    return std::nullopt;
+  }
+}
+
+void SimplificationCache::Insert(const std::string& key, const std::span<const mesh::LevelOfDetail> lods) const {
+  const auto entry_path = GetEntryPath(key);
+
+  // make the entry visible only once it is complete so that a concurrent process never reads a partial entry
+  const auto temporary_path = GetTemporaryPath(entry_path);
+
+  {
+    std::ofstream ofs{temporary_path, std::ios::binary};
+    if (!ofs.good()) throw std::runtime_error{std::format("Unable to open {}", temporary_path.string())};
+
+    ofs.write(kEntryMagic.data(), kEntryMagic.size());
+    binary::Write(ofs, kEntryVersion);
+    binary::Write<std::uint64_t>(ofs, lods.size());
+    for (const auto& lod : lods) WriteLod(ofs, lod);
+
+    if (!ofs.flush()) throw std::runtime_error{std::format("Unable to write {}", temporary_path.string())};
+  }
+
+  std::filesystem::rename(temporary_path, entry_path);
+  Evict();
+}
+
+std::filesystem::path SimplificationCache::GetEntryPath(const std::string& key) const {
+  return directory_ / (key + std::string{kEntryExtension});
+}
+
+void SimplificationCache::Evict() const {
+  struct Entry {
+    std::filesystem::path path;
+    std::uintmax_t size = 0;
+    std::filesystem::file_time_type last_used_time;
+  };
+
+  // entries may be removed concurrently by another process in which case they no longer count toward the budget
+  std::vector<Entry> entries;
+  std::uintmax_t total_size = 0;
+  std::error_code error_code;
+  for (const auto& directory_entry : std::filesystem::directory_iterator{directory_, error_code}) {
+    if (directory_entry.path().extension() != kEntryExtension) continue;
+    const auto size = directory_entry.file_size(error_code);
+    if (error_code) continue;
+    const auto last_used_time = directory_entry.last_write_time(error_code);
+    if (error_code) continue;
+    entries.push_back(Entry{.path = directory_entry.path(), .size = size, .last_used_time = last_used_time});
+    total_size += size;
+  }
+
+  std::ranges::sort(entries, {}, &Entry::last_used_time);
+  for (auto entry = entries.begin(); total_size > max_size_ && entry != entries.end(); ++entry) {
+    std::filesystem::remove(entry->path, error_code);
+    total_size -= entry->size;
+  }
+}
+
+MeshData mesh::Simplify(const MeshData& mesh,
+                        const float rate,
+                        const SimplificationCache& cache,
+                        const SimplifierOptions& options) {
+  const auto key = SimplificationCache::GetKey(mesh, rate, options);
+  if (auto lods = cache.Find(key); lods.has_value() && lods->size() == 1) return std::move(lods->front().mesh);
+
+  std::array lods{LevelOfDetail{.mesh = Simplify(mesh, rate, nullptr, options), .face_count = 0, .max_error = 0.0f}};
+  lods.front().face_count = lods.front().mesh.indices().size() / 3;
+  TryInsert(cache, key, lods);
+  return std::move(lods.front().mesh);
+}
+
+std::vector<mesh::LevelOfDetail> mesh::SimplifyLods(const MeshData& mesh,
+                                                    const std::span<const LodTarget> targets,
+                                                    const SimplificationCache& cache,
+                                                    const SimplifierOptions& options) {
+  const auto key = SimplificationCache::GetKey(mesh, targets, options);
+  if (auto lods = cache.Find(key); lods.has_value() && lods->size() == targets.size()) return std::move(*lods);
+
+  auto lods = SimplifyLods(mesh, targets, options);
+  TryInsert(cache, key, lods);
+  return lods;
+}
+
+}  // namespace gfx
@@ -0,0 +1,122 @@
+#ifndef GEOMETRY_SIMPLIFICATION_CACHE_H_
+#define GEOMETRY_SIMPLIFICATION_CACHE_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "geometry/mesh_simplifier.h"
+
+namespace gfx {
+
+/**
+ * @brief A size-bounded directory of simplified meshes addressed by a 128-bit hash of their input mesh and every
+ *        parameter that affects the result of simplification.
+ * @details Each entry is stored in its own file named by its key. Finding an entry marks it as recently used by
+ *          updating its modification time, and inserting an entry removes the least recently used entries until the
+ *          directory fits in its size budget. Entries are written to a temporary file that is renamed once complete
+ *          so that a directory can be shared by concurrent processes.
+ */
+class SimplificationCache {
+public:
+  /**
+   * @brief Opens a simplification cache directory, creating it if it does not exist.
+   * @param directory The directory to store cache entries in.
+   * @param max_size The maximum total size in bytes of all cache entries.
+   * @throw std::filesystem::filesystem_error Thrown if the directory cannot be created.
+   */
+  SimplificationCache(std::filesystem::path directory, std::uintmax_t max_size);
+
+  /**
+   * @brief Gets the key of a mesh simplified by @c mesh::Simplify.
+   * @param mesh The mesh to simplify.
+   * @param rate The percentage of triangles to be removed.
+   * @param options Options that control how the mesh is simplified. Checkpoint options do not affect the key.
+   * @return A hexadecimal digest of the vertex attributes, indices, and model transform of @p mesh, @p rate, and
+   *         @p options.
+   */
+  [[nodiscard]] static std::string GetKey(const MeshData& mesh, float rate, const SimplifierOptions& options = {});
+
+  /**
+   * @brief Gets the key of a level of detail chain generated by @c mesh::SimplifyLods.
+   * @param mesh The mesh to simplify.
+   * @param targets The criteria for each level of detail.
+   * @param options Options that control how the mesh is simplified. Checkpoint options do not affect the key.
+   * @return A hexadecimal digest of @p mesh, @p targets, and @p options distinct from every key returned for a single
+   *         simplification rate.
+   */
+  [[nodiscard]] static std::string GetKey(const MeshData& mesh,
+                                          std::span<const mesh::LodTarget> targets,
+                                          const SimplifierOptions& options = {});
+
+  /**
+   * @brief Finds a cache entry and marks it as the most recently used.
+   * @param key The key of the entry to find.
+   * @return The levels of detail stored for @p key or an empty optional if no valid entry exists. A simplified mesh
+   *         is stored as a single level of detail.
+   */
+  [[nodiscard]] std::optional<std::vector<mesh::LevelOfDetail>> Find(const std::string& key) const;
+
+  /**
+   * @brief Inserts or replaces a cache entry and evicts the least recently used entries that exceed the size budget.
+   * @param key The key of the entry to insert.
+   * @param lods The levels of detail to store.
+   * @throw std::runtime_error Thrown if the entry cannot be written.
+   */
+  void Insert(const std::string& key, std::span<const mesh::LevelOfDetail> lods) const;
+
+  /** @brief Gets the directory cache entries are stored in. */
+  [[nodiscard]] const std::filesystem::path& directory() const noexcept { return directory_; }
+
+  /** @brief Gets the maximum total size in bytes of all cache entries. */
+  [[nodiscard]] std::uintmax_t max_size() const noexcept { return max_size_; }
+
+private:
+  [[nodiscard]] std::filesystem::path GetEntryPath(const std::string& key) const;
+  void Evict() const;
+
+  std::filesystem::path directory_;
+  std::uintmax_t max_size_;
+};
+
+namespace mesh {
+
+/**
+ * @brief Reduces the number of triangles in a mesh unless an identical simplification is in a cache.
+ * @details The result is identical to @c mesh::Simplify for the same arguments. A result that is not found is
+ *          inserted into @p cache, and failing to write it is reported without failing the simplification.
+ * @param mesh The mesh to simplify.
+ * @param rate The percentage of triangles to be removed (e.g., .95 indicates 95% of triangles should be removed).
+ * @param cache The cache to find and store the simplified mesh in.
+ * @param options Options that control how the mesh is simplified.
+ * @return A triangle mesh with @p rate percent of triangles removed from @p mesh.
+ * @throw std::invalid_argument Thrown if the simplification rate is not in the interval [0,1].
+ */
+MeshData Simplify(const MeshData& mesh,
+                  float rate,
+                  const SimplificationCache& cache,
+                  const SimplifierOptions& options = {});
+
+/**
+ * @brief Generates a chain of progressively simplified meshes unless an identical chain is in a cache.
+ * @details The result is identical to @c mesh::SimplifyLods for the same arguments and is cached as a single entry.
+ * @param mesh The mesh to simplify.
+ * @param targets The criteria for each level of detail ordered from the finest to the coarsest level of detail.
+ * @param cache The cache to find and store the level of detail chain in.
+ * @param options Options that control how the mesh is simplified.
+ * @return A level of detail for each target in @p targets.
+ * @throw std::invalid_argument Thrown if a simplification rate is not in the interval [0,1] or if an error
+ *                              threshold is negative.
+ */
+std::vector<LevelOfDetail> SimplifyLods(const MeshData& mesh,
+                                        std::span<const LodTarget> targets,
+                                        const SimplificationCache& cache,
+                                        const SimplifierOptions& options = {});
+
+}  // namespace mesh
+}  // namespace gfx
+
+#endif  // GEOMETRY_SIMPLIFICATION_CACHE_H_
@@ -0,0 +1,424 @@
+#include "geometry/streaming_simplifier.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/hash.hpp>
+
+#include "geometry/mesh_data.h"
+#include "geometry/mesh_simplifier.h"
+#include "io/obj_loader.h"
+#include "io/obj_writer.h"
+
+namespace gfx {
+
+namespace {
+
+/** @brief A triangle whose vertex positions are stored inline so that it can be processed independently. */
+using Triangle = std::array<glm::vec3, 3>;
+
+/** @brief A triangle represented by zero-based vertex position indices. */
+using TriangleIndices = std::array<std::uint32_t, 3>;
+
+/** @brief The number of records read from or written to an intermediate file at once. */
+constexpr std::size_t kChunkSize = std::size_t{1} << 16u;
+
+/**
+ * @brief A conservative estimate of the memory required to simplify a single triangle, which includes its half-edges,
+ *        vertices, error quadrics, and edge contraction candidates.
+ */
+constexpr std::size_t kBytesPerFace = 1024;
+
+/** @brief The maximum depth of the octree used to partition triangles into cells. */
+constexpr auto kMaxDepth = 16;
+
+/** @brief An axis-aligned bounding box. */
+struct Bounds {
+  glm::vec3 min{std::numeric_limits<float>::max()};
+  glm::vec3 max{std::numeric_limits<float>::lowest()};
+};
+
+/** @brief A uniquely named directory for intermediate files which is removed with its contents when destroyed. */
+class TemporaryDirectory {
+public:
+  explicit TemporaryDirectory(const std::filesystem::path& parent) {
+    for (std::random_device random_device;;) {
+      path_ = parent / std::format("mesh_simplification_{:08x}", random_device());
+      if (std::filesystem::create_directories(path_)) break;
+    }
+  }
+
+  TemporaryDirectory(const TemporaryDirectory&) = delete;
+  TemporaryDirectory(TemporaryDirectory&&) noexcept = delete;
+
+  TemporaryDirectory& operator=(const TemporaryDirectory&) = delete;
+  TemporaryDirectory& operator=(TemporaryDirectory&&) noexcept = delete;
+
+  ~TemporaryDirectory() noexcept {
+    std::error_code error_code;
+    std::filesystem::remove_all(path_, error_code);
+  }
+
+  /** @brief Gets a path for a new intermediate file in this directory. */
+  [[nodiscard]] std::filesystem::path CreateFilepath() { return path_ / std::format("{}.bin", file_count_++); }
+
+private:
+  std::filesystem::path path_;
+  std::size_t file_count_ = 0;
+};
+
+/** @brief Opens a file stream and ensures it is ready for use. */
+template <typename T>
+T Open(const std::filesystem::path& filepath, const std::ios::openmode mode = std::ios::binary) {
+  if (T fs{filepath, mode}; fs.good()) return fs;
+  throw std::runtime_error{std::format("Unable to open {}", filepath.generic_string())};
+}
+
+/** @brief Writes a contiguous sequence of trivially copyable records to a binary file. */
+template <typename T>
+void Write(std::ofstream& ofs, const std::span<const T> records) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  ofs.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size_bytes()));
+}
+
+/**
+ * @brief Reads a chunk of trivially copyable records from a binary file.
+ * @param ifs The file stream to read from.
+ * @param records The vector to read records into which is resized to the number of records read.
+ * @param count The maximum number of records to read.
+ * @return @c true if at least one record was read, otherwise @c false.
+ */
+template <typename T>
+bool Read(std::ifstream& ifs, std::vector<T>& records, const std::size_t count = kChunkSize) {
+  records.resize(count);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  ifs.read(reinterpret_cast<char*>(records.data()), static_cast<std::streamsize>(sizeof(T) * count));
+  records.resize(static_cast<std::size_t>(ifs.gcount()) / sizeof(T));
+  return !records.empty();
+}
+
+/** @brief Gets the centroid of a triangle which determines the octree cell it is assigned to. */
+glm::vec3 GetCentroid(const Triangle& triangle) { return (triangle[0] + triangle[1] + triangle[2]) / 3.0f; }
+
+/** @brief The state of an .obj file being written one cell at a time. */
+struct ObjWriter {
+  std::ofstream ofs;
+  std::size_t vertex_count = 0;
+  std::size_t face_count = 0;
+
+  // locked vertices may be shared with cells that have not yet been written
+  std::unordered_map<glm::vec3, std::uint32_t> locked_vertices;
+
+  /** @brief Appends the vertices and faces of a simplified cell. */
+  void Append(const HalfEdgeMesh& half_edge_mesh) {
+    std::unordered_map<int, std::uint32_t> vertex_indices;
+    vertex_indices.reserve(half_edge_mesh.vertices().size());
+    std::vector<glm::vec3> positions;
+    positions.reserve(half_edge_mesh.vertices().size());
+
+    for (const auto& [vertex_id, vertex] : half_edge_mesh.vertices()) {
+      const auto& position = vertex->position();
+      const auto vertex_index = static_cast<std::uint32_t>(vertex_count + positions.size());
+      if (half_edge_mesh.IsLocked(*vertex)) {
+        if (const auto [iterator, inserted] = locked_vertices.try_emplace(position, vertex_index); !inserted) {
+          vertex_indices.emplace(vertex_id, iterator->second);
+          continue;
+        }
+      }
+      positions.push_back(position);
+      vertex_indices.emplace(vertex_id, vertex_index);
+    }
+
+    std::vector<std::uint32_t> indices;
+    indices.reserve(3 * half_edge_mesh.faces().size());
+    for (const auto& face : half_edge_mesh.faces() | std::views::values) {
+      for (const auto& vertex : {face->v0(), face->v1(), face->v2()}) {
+        indices.push_back(vertex_indices.at(vertex->id()));
+      }
+    }
+
+    // format lines exactly as obj_writer does so that streamed and in-core output round-trip the same values
+    const auto lines = obj_writer::FormatPart(positions, indices, vertex_count);
+    ofs.write(lines.data(), static_cast<std::streamsize>(lines.size()));
+    vertex_count += positions.size();
+    face_count += half_edge_mesh.faces().size();
+  }
+};
+
+/**
+ * @brief Streams an .obj file into binary files of vertex positions and triangle indices.
+ * @return The number of vertices and the number of triangles.
+ */
+std::pair<std::size_t, std::size_t> Stream(const std::filesystem::path& input_filepath,
+                                           const std::filesystem::path& positions_filepath,
+                                           const std::filesystem::path& faces_filepath) {
+  auto positions_ofs = Open<std::ofstream>(positions_filepath);
+  auto faces_ofs = Open<std::ofstream>(faces_filepath);
+  std::vector<glm::vec3> positions;
+  std::vector<TriangleIndices> faces;
+  std::size_t vertex_count = 0, face_count = 0;
+  std::int64_t max_index = -1;
+
+  obj_loader::ReadTriangles(
+      input_filepath,
+      [&](const glm::vec3& position) {
+        positions.push_back(position);
+        if (++vertex_count; positions.size() == kChunkSize) {
+          Write<glm::vec3>(positions_ofs, positions);
+          positions.clear();
+        }
+      },
+      [&](const std::array<int, 3>& face) {
+        for (const auto index : face) {
+          if (index < 0) throw std::invalid_argument{std::format("Invalid face vertex index {}", index + 1)};
+          max_index = std::max<std::int64_t>(max_index, index);
+        }
+        faces.push_back(TriangleIndices{static_cast<std::uint32_t>(face[0]),
+                                        static_cast<std::uint32_t>(face[1]),
+                                        static_cast<std::uint32_t>(face[2])});
+        if (++face_count; faces.size() == kChunkSize) {
+          Write<TriangleIndices>(faces_ofs, faces);
+          faces.clear();
+        }
+      });
+
+  Write<glm::vec3>(positions_ofs, positions);
+  Write<TriangleIndices>(faces_ofs, faces);
+
+  if (std::cmp_greater_equal(max_index, vertex_count)) {
+    throw std::invalid_argument{std::format("Face references vertex {} of {}", max_index + 1, vertex_count)};
+  }
+  return std::pair{vertex_count, face_count};
+}
+
+/**
+ * @brief Resolves the vertex positions of each triangle into a triangle soup.
+ * @details Vertex positions are loaded in blocks that fit in the memory budget. Each block requires one pass over the
+ *          triangles which fills in every vertex position referenced from that block.
+ * @return The path of the triangle soup file and the bounding box of all triangle centroids.
+ */
+std::pair<std::filesystem::path, Bounds> Dereference(const std::filesystem::path& positions_filepath,
+                                                     const std::filesystem::path& faces_filepath,
+                                                     const std::size_t vertex_count,
+                                                     const std::size_t memory_budget,
+                                                     TemporaryDirectory& temporary_directory) {
+  const auto block_size = std::max<std::size_t>(memory_budget / sizeof(glm::vec3), 1);
+  auto positions_ifs = Open<std::ifstream>(positions_filepath);
+  std::filesystem::path triangles_filepath;
+  Bounds bounds;
+
+  std::vector<glm::vec3> positions;
+  std::vector<TriangleIndices> faces;
+  std::vector<Triangle> triangles;
+
+  for (std::size_t block_begin = 0; block_begin < vertex_count; block_begin += block_size) {
+    Read(positions_ifs, positions, std::min(block_size, vertex_count - block_begin));
+    const auto block_end = block_begin + positions.size();
+    const auto is_last_block = block_end == vertex_count;
+
+    auto faces_ifs = Open<std::ifstream>(faces_filepath);
+    std::ifstream triangles_ifs;
+    if (block_begin > 0) triangles_ifs = Open<std::ifstream>(triangles_filepath);
+    const auto next_triangles_filepath = temporary_directory.CreateFilepath();
+    auto triangles_ofs = Open<std::ofstream>(next_triangles_filepath);
+
+    while (Read(faces_ifs, faces)) {
+      if (block_begin > 0) {
+        Read(triangles_ifs, triangles, faces.size());
+      } else {
+        triangles.assign(faces.size(), Triangle{});
+      }
+
+      for (std::size_t i = 0; i < faces.size(); ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+          if (const auto index = faces[i][j]; index >= block_begin && index < block_end) {
+            triangles[i][j] = positions[index - block_begin];
+          }
+        }
+        if (is_last_block) {
+          const auto centroid = GetCentroid(triangles[i]);
+          bounds.min = glm::min(bounds.min, centroid);
+          bounds.max = glm::max(bounds.max, centroid);
+        }
+      }
+      Write<Triangle>(triangles_ofs, triangles);
+    }
+
+    if (block_begin > 0) {
+      triangles_ifs.close();
+      std::filesystem::remove(triangles_filepath);
+    }
+    triangles_filepath = next_triangles_filepath;
+  }
+
+  return std::pair{triangles_filepath, bounds};
+}
+
+/**
+ * @brief Simplifies the triangles in a cell and appends them to the output file.
+ * @param triangles_filepath The path of the triangle soup file containing the cell.
+ * @param rate The percentage of triangles to be removed.
+ * @param obj_writer The output file writer.
+ */
+void SimplifyCell(const std::filesystem::path& triangles_filepath, const float rate, ObjWriter& obj_writer) {
+  std::vector<glm::vec3> positions;
+  std::vector<std::uint32_t> indices;
+  std::unordered_map<glm::vec3, std::uint32_t> position_indices;
+
+  // weld identical positions to recover the connectivity of the cell while skipping degenerate triangles
+  auto triangles_ifs = Open<std::ifstream>(triangles_filepath);
+  for (std::vector<Triangle> triangles; Read(triangles_ifs, triangles);) {
+    for (const auto& triangle : triangles) {
+      if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[2] == triangle[0]) continue;
+      for (const auto& position : triangle) {
+        const auto index = static_cast<std::uint32_t>(positions.size());
+        const auto [iterator, inserted] = position_indices.try_emplace(position, index);
+        if (inserted) positions.push_back(position);
+        indices.push_back(iterator->second);
+      }
+    }
+  }
+  if (indices.empty()) return;
+
+  const auto face_count = indices.size() / 3;
+  const MeshData mesh{std::move(positions), {}, {}, std::move(indices)};
+  position_indices.clear();
+
+  SimplifierOptions options;
+  options.lock_boundary = true;
+  MeshSimplifier mesh_simplifier{mesh, nullptr, options};
+  mesh_simplifier.Simplify(static_cast<std::size_t>((1.0f - rate) * static_cast<float>(face_count)));
+  obj_writer.Append(mesh_simplifier.half_edge_mesh());
+}
+
+/**
+ * @brief Recursively partitions a cell into octants until each cell fits in the memory budget and simplifies it.
+ * @param triangles_filepath The path of the triangle soup file containing the cell. It is removed once processed.
+ * @param face_count The number of triangles in the cell.
+ * @param bounds The bounding box of the centroids of triangles in the cell.
+ * @param depth The depth of the cell in the octree.
+ * @param rate The percentage of triangles to be removed.
+ * @param memory_budget The maximum number of bytes of mesh data to hold in memory.
+ * @param temporary_directory The directory to create intermediate files in.
+ * @param obj_writer The output file writer.
+ */
+void ProcessCell(const std::filesystem::path& triangles_filepath,
+                 const std::size_t face_count,
+                 const Bounds& bounds,
+                 const int depth,
+                 const float rate,
+                 const std::size_t memory_budget,
+                 TemporaryDirectory& temporary_directory,
+                 ObjWriter& obj_writer) {
+  if (face_count * kBytesPerFace <= memory_budget || depth == kMaxDepth || bounds.min == bounds.max) {
+    SimplifyCell(triangles_filepath, rate, obj_writer);
+    std::filesystem::remove(triangles_filepath);
+    return;
+  }
+
+  std::array<std::filesystem::path, 8> octant_filepaths;
+  std::array<std::size_t, 8> octant_face_counts{};
+  std::array<Bounds, 8> octant_bounds;
+
+  {
+    std::array<std::ofstream, 8> octant_ofs;
+    for (std::size_t i = 0; i < octant_ofs.size(); ++i) {
+      octant_filepaths[i] = temporary_directory.CreateFilepath();
+      octant_ofs[i] = Open<std::ofstream>(octant_filepaths[i]);
+    }
+
+    const auto center = (bounds.min + bounds.max) / 2.0f;
+    auto triangles_ifs = Open<std::ifstream>(triangles_filepath);
+    for (std::vector<Triangle> triangles; Read(triangles_ifs, triangles);) {
+      for (const auto& triangle : triangles) {
+        const auto centroid = GetCentroid(triangle);
+        const auto octant = static_cast<std::size_t>(centroid.x >= center.x)
+                            | static_cast<std::size_t>(centroid.y >= center.y) << 1u
+                            | static_cast<std::size_t>(centroid.z >= center.z) << 2u;
+        Write<Triangle>(octant_ofs[octant], std::span{&triangle, 1});
+        ++octant_face_counts[octant];
+        octant_bounds[octant].min = glm::min(octant_bounds[octant].min, centroid);
+        octant_bounds[octant].max = glm::max(octant_bounds[octant].max, centroid);
+      }
+    }
+  }
+  std::filesystem::remove(triangles_filepath);
+
+  for (std::size_t i = 0; i < octant_filepaths.size(); ++i) {
+    if (octant_face_counts[i] == 0) {
+      std::filesystem::remove(octant_filepaths[i]);
+      continue;
+    }
+    ProcessCell(octant_filepaths[i],
+                octant_face_counts[i],
+                octant_bounds[i],
+                depth + 1,
+                rate,
+                memory_budget,
+                temporary_directory,
+                obj_writer);
+  }
+}
+
+}  // namespace
+
+std::size_t mesh::SimplifyOutOfCore(const std::filesystem::path& input_filepath,
+                                    const std::filesystem::path& output_filepath,
+                                    const float rate,
+                                    const StreamingOptions& options) {
+  if (rate < 0.0f || rate > 1.0f) {
+    throw std::invalid_argument{std::format("Invalid mesh simplification rate: {}", rate)};
+  }
+
+  const auto start_time = std::chrono::high_resolution_clock::now();
+  TemporaryDirectory temporary_directory{options.temp_directory.empty() ? std::filesystem::temp_directory_path()
+                                                                         : options.temp_directory};
+
+  const auto positions_filepath = temporary_directory.CreateFilepath();
+  const auto faces_filepath = temporary_directory.CreateFilepath();
+  const auto [vertex_count, face_count] = Stream(input_filepath, positions_filepath, faces_filepath);
+
+  const auto [triangles_filepath, bounds] =
+      Dereference(positions_filepath, faces_filepath, vertex_count, options.memory_budget, temporary_directory);
+  std::filesystem::remove(positions_filepath);
+  std::filesystem::remove(faces_filepath);
+
+  ObjWriter obj_writer;
+  obj_writer.ofs = Open<std::ofstream>(output_filepath, std::ios::out);
+  if (face_count > 0) {
+    ProcessCell(triangles_filepath,
+                face_count,
+                bounds,
+                0,
+                rate,
+                options.memory_budget,
+                temporary_directory,
+                obj_writer);
+  }
+
+  std::clog << std::format(
+      "Mesh simplified out-of-core from {} to {} triangles in {} second\n",
+      face_count,
+      obj_writer.face_count,
+      std::chrono::duration<float>{std::chrono::high_resolution_clock::now() - start_time}.count());
+
+  return obj_writer.face_count;
+}
+
+}  // namespace gfx
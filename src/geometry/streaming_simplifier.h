@@ -0,0 +1,47 @@
+#ifndef GEOMETRY_STREAMING_SIMPLIFIER_H_
+#define GEOMETRY_STREAMING_SIMPLIFIER_H_
+
+#include <cstddef>
+#include <filesystem>
+
+namespace gfx {
+
+/** @brief Options that control out-of-core mesh simplification. */
+struct StreamingOptions {
+  /** @brief The approximate maximum number of bytes of mesh data to hold in memory at once. */
+  std::size_t memory_budget = std::size_t{1} << 30u;
+
+  /** @brief The directory to store intermediate files in. The system temporary directory is used when empty. */
+  std::filesystem::path temp_directory;
+};
+
+namespace mesh {
+
+/**
+ * @brief Reduces the number of triangles in an .obj file which may be too large to fit in memory.
+ * @details The input is streamed to disk as a triangle soup which is recursively partitioned into spatially
+ *          coherent octree cells until each cell fits in the memory budget. Cells are then loaded and simplified one
+ *          at a time with the same quadric error metric used by @c mesh::Simplify while vertices on each cell
+ *          boundary are locked so that adjacent cells stitch together without cracks. Each finished cell is appended
+ *          to the output file before the next cell is loaded and vertices shared between cells are written once.
+ * @param input_filepath The path to the .obj file to simplify.
+ * @param output_filepath The path to write the simplified .obj file to.
+ * @param rate The percentage of triangles to be removed (e.g., .95 indicates 95% of triangles should be removed).
+ * @param options Options that control memory use and where intermediate files are stored.
+ * @return The number of triangles written to @p output_filepath.
+ * @throw std::invalid_argument Thrown if the simplification rate is not in the interval [0,1], if the input file
+ *                              format is unsupported, or if a face references a vertex that does not exist.
+ * @throw std::runtime_error Thrown if a file cannot be opened.
+ * @note Besides the memory budget, only vertices on cell boundaries are kept in memory for the duration of the run.
+ *       Vertices on cell boundaries are never removed so the output retains the input resolution along them.
+ *       Texture coordinates and normals are not preserved.
+ */
+std::size_t SimplifyOutOfCore(const std::filesystem::path& input_filepath,
+                              const std::filesystem::path& output_filepath,
+                              float rate,
+                              const StreamingOptions& options = {});
+
+}  // namespace mesh
+}  // namespace gfx
+
+#endif  // GEOMETRY_STREAMING_SIMPLIFIER_H_
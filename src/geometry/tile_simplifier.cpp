@@ -0,0 +1,171 @@
+#include "geometry/tile_simplifier.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <istream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <glm/gtx/hash.hpp>
+
+#include "geometry/half_edge_mesh.h"
+#include "geometry/mesh_data.h"
+#include "geometry/mesh_simplifier.h"
+#include "geometry/vertex.h"
+#include "io/obj_loader.h"
+
+namespace gfx {
+
+namespace {
+
+/** @brief Ensures a simplification rate is in the interval [0,1]. */
+void ValidateRate(const std::filesystem::path& filepath, const float rate) {
+  if (rate < 0.0f || rate > 1.0f) {
+    throw std::invalid_argument{
+        std::format("Invalid mesh simplification rate for {}: {}", filepath.generic_string(), rate)};
+  }
+}
+
+/**
+ * @brief Parses a tiling manifest.
+ * @param is The input stream containing the manifest.
+ * @param directory The directory tile paths are relative to.
+ * @return The tiles and seam positions described by the manifest.
+ */
+TileManifest ParseTileManifest(std::istream& is, const std::filesystem::path& directory) {
+  TileManifest manifest;
+
+  for (std::string line; std::getline(is, line);) {
+    std::istringstream line_stream{line};
+    std::string directive;
+    if (!(line_stream >> directive) || directive.starts_with('#')) continue;
+
+    if (directive == "tile") {
+      std::string filepath;
+      if (auto rate = 0.0f; line_stream >> filepath >> rate && (line_stream >> std::ws).eof()) {
+        ValidateRate(filepath, rate);
+        manifest.tiles.push_back(Tile{.filepath = directory / filepath, .rate = rate});
+        continue;
+      }
+    } else if (directive == "seam") {
+      if (glm::vec3 position{0.0f}; line_stream >> position.x >> position.y >> position.z
+                                    && (line_stream >> std::ws).eof()) {
+        manifest.seam_positions.push_back(position);
+        continue;
+      }
+    }
+
+    throw std::invalid_argument{std::format("Unsupported tiling manifest line: {}", line)};
+  }
+
+  return manifest;
+}
+
+/**
+ * @brief Simplifies a tile while locking vertices shared with adjacent tiles.
+ * @param half_edge_mesh The tile to simplify.
+ * @param rate The percentage of triangles to be removed from the tile.
+ * @param seam_positions The positions of vertices shared with adjacent tiles in addition to boundary vertices.
+ * @param mesh_simplifier The mesh simplifier to create and run.
+ */
+void SimplifyTile(HalfEdgeMesh half_edge_mesh,
+                  const float rate,
+                  const std::unordered_set<glm::vec3>& seam_positions,
+                  std::optional<MeshSimplifier>& mesh_simplifier) {
+  // vertices welded at an attribute seam share the position of the vertex they were welded into
+  std::vector<int> locked_vertices;
+  for (const auto& [vertex_id, vertex] : half_edge_mesh.vertices()) {
+    if (seam_positions.contains(vertex->position())) locked_vertices.push_back(vertex_id);
+  }
+
+  const auto face_count = half_edge_mesh.faces().size();
+  const auto target_face_count = static_cast<std::size_t>((1.0f - rate) * static_cast<float>(face_count));
+
+  SimplifierOptions options;
+  options.lock_boundary = true;
+  options.locked_vertices = locked_vertices;
+  mesh_simplifier.emplace(std::move(half_edge_mesh), options);
+  mesh_simplifier->Simplify(target_face_count);
+}
+
+}  // namespace
+
+TileManifest mesh::LoadTileManifest(const std::filesystem::path& filepath) {
+  if (std::ifstream ifs{filepath}; ifs.good()) {
+    return ParseTileManifest(ifs, filepath.parent_path());
+  }
+  throw std::runtime_error{std::format("Unable to open {}", filepath.generic_string())};
+}
+
+std::vector<MeshData> mesh::SimplifyTiles(const TileManifest& manifest, const std::size_t thread_count) {
+  const auto& tiles = manifest.tiles;
+  for (const auto& [filepath, rate] : tiles) ValidateRate(filepath, rate);
+
+  const auto start_time = std::chrono::high_resolution_clock::now();
+
+  const std::unordered_set<glm::vec3> seam_positions{manifest.seam_positions.begin(), manifest.seam_positions.end()};
+  std::vector<std::optional<MeshData>> simplified_meshes(tiles.size());
+  std::vector<std::size_t> initial_face_counts(tiles.size(), 0), face_counts(tiles.size(), 0);
+  std::vector<std::exception_ptr> exceptions(tiles.size());
+  std::atomic<std::size_t> next_tile = 0;
+
+  {
+    // each tile is loaded, simplified, and converted back to mesh data on the same worker thread
+    std::vector<std::jthread> workers;
+    const auto worker_count = std::clamp<std::size_t>(thread_count, 1, std::max<std::size_t>(tiles.size(), 1));
+    workers.reserve(worker_count);
+
+    for (std::size_t i = 0; i < worker_count; ++i) {
+      workers.emplace_back([&] {
+        for (auto j = next_tile++; j < tiles.size(); j = next_tile++) {
+          try {
+            // tiles are already loaded concurrently so each is parsed on a single thread
+            auto half_edge_mesh = obj_loader::LoadHalfEdgeMesh(tiles[j].filepath, 1);
+            initial_face_counts[j] = half_edge_mesh.faces().size();
+            std::optional<MeshSimplifier> mesh_simplifier;
+            SimplifyTile(std::move(half_edge_mesh), tiles[j].rate, seam_positions, mesh_simplifier);
+            face_counts[j] = mesh_simplifier->face_count();
+            simplified_meshes[j].emplace(static_cast<MeshData>(mesh_simplifier->half_edge_mesh()));
+          } catch (...) {
+            exceptions[j] = std::current_exception();
+          }
+        }
+      });
+    }
+  }
+
+  for (const auto& exception : exceptions) {
+    if (exception != nullptr) std::rethrow_exception(exception);
+  }
+
+  std::size_t initial_face_count = 0, face_count = 0;
+  std::vector<MeshData> meshes;
+  meshes.reserve(tiles.size());
+
+  for (std::size_t i = 0; i < tiles.size(); ++i) {
+    initial_face_count += initial_face_counts[i];
+    face_count += face_counts[i];
+    meshes.push_back(std::move(*simplified_meshes[i]));
+  }
+
+  std::clog << std::format(
+      "{} tiles simplified from {} to {} triangles in {} second\n",
+      tiles.size(),
+      initial_face_count,
+      face_count,
+      std::chrono::duration<float>{std::chrono::high_resolution_clock::now() - start_time}.count());
+
+  return meshes;
+}
+
+}  // namespace gfx
@@ -0,0 +1,68 @@
+#ifndef GEOMETRY_TILE_SIMPLIFIER_H_
+#define GEOMETRY_TILE_SIMPLIFIER_H_
+
+#include <cstddef>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+namespace gfx {
+class MeshData;
+
+/** @brief A tile in a tiled dataset. */
+struct Tile {
+  /** @brief The path to the .obj file containing the tile. */
+  std::filesystem::path filepath;
+
+  /** @brief The percentage of triangles to be removed from the tile (e.g., .95 indicates 95%). */
+  float rate = 0.0f;
+};
+
+/** @brief Describes a dataset comprised of adjacent tiles which share vertices along their seams. */
+struct TileManifest {
+  /** @brief The tiles in the dataset. */
+  std::vector<Tile> tiles;
+
+  /**
+   * @brief Positions of vertices shared between tiles that are not on a tile boundary (e.g., where a tile seam runs
+   *        through the interior of a tile). Vertices on a tile boundary are always shared.
+   */
+  std::vector<glm::vec3> seam_positions;
+};
+
+namespace mesh {
+
+/**
+ * @brief Loads a tiling manifest.
+ * @details Each line of the manifest is blank, a comment beginning with '#', or one of the following directives:
+ *          - <tt>tile \<path\> \<rate\></tt> adds a tile whose path is relative to the manifest directory.
+ *          - <tt>seam \<x\> \<y\> \<z\></tt> adds the position of a vertex shared between tiles.
+ * @param filepath The path to the manifest file.
+ * @return The tiles and seam positions described by the manifest.
+ * @throw std::invalid_argument Thrown if the manifest contains an unsupported line or invalid simplification rate.
+ * @throw std::runtime_error Thrown if the file cannot be opened.
+ */
+TileManifest LoadTileManifest(const std::filesystem::path& filepath);
+
+/**
+ * @brief Reduces the number of triangles in each tile of a tiled dataset.
+ * @details Vertices on the boundary of each tile and vertices at a seam position are locked so that each tile can be
+ *          simplified independently of its neighbors while still producing identical vertices along shared seams.
+ *          Tiles are loaded directly into half-edge meshes, simplified, and converted back to mesh data on worker
+ *          threads.
+ * @param manifest The tiles to simplify.
+ * @param thread_count The maximum number of worker threads used to simplify tiles concurrently.
+ * @return A simplified mesh for each tile in @p manifest in the same order.
+ * @throw std::invalid_argument Thrown if a tile cannot be loaded or its simplification rate is not in the interval
+ *                              [0,1].
+ * @throw std::runtime_error Thrown if a tile file cannot be opened.
+ */
+std::vector<MeshData> SimplifyTiles(const TileManifest& manifest,
+                                    std::size_t thread_count = std::thread::hardware_concurrency());
+
+}  // namespace mesh
+}  // namespace gfx
+
+#endif  // GEOMETRY_TILE_SIMPLIFIER_H_
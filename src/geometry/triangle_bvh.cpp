@@ -0,0 +1,188 @@
+#include "geometry/triangle_bvh.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace gfx {
+
+namespace {
+
+/** @brief The maximum number of triangles in a leaf node. */
+constexpr std::uint32_t kMaxLeafSize = 4;
+
+/** @brief The maximum number of pending nodes during a query which bounds the depth of the hierarchy. */
+constexpr std::size_t kMaxStackSize = 64;
+
+/** @brief Gets the squared distance between two points. */
+float GetSquaredDistance(const glm::vec3& p0, const glm::vec3& p1) noexcept {
+  const auto d = p1 - p0;
+  return glm::dot(d, d);
+}
+
+/** @brief Gets the squared distance from a point to an axis-aligned bounding box or zero if the point is inside it. */
+float GetSquaredDistance(const glm::vec3& point, const glm::vec3& min, const glm::vec3& max) noexcept {
+  const auto d = glm::max(glm::max(min - point, point - max), glm::vec3{0.0f});
+  return glm::dot(d, d);
+}
+
+/** @brief Gets the closest point on a line segment to a point. */
+glm::vec3 GetClosestSegmentPoint(const glm::vec3& point, const glm::vec3& p0, const glm::vec3& p1) noexcept {
+  const auto d = p1 - p0;
+  const auto length2 = glm::dot(d, d);
+  if (length2 == 0.0f) return p0;
+  return p0 + std::clamp(glm::dot(point - p0, d) / length2, 0.0f, 1.0f) * d;
+}
+
+}  // namespace
+
+TriangleBvh::TriangleBvh(std::vector<Triangle> triangles) : triangles_{std::move(triangles)} {
+  if (triangles_.empty()) return;
+
+  std::vector<glm::vec3> centroids;
+  centroids.reserve(triangles_.size());
+  for (const auto& [p0, p1, p2] : triangles_) centroids.push_back((p0 + p1 + p2) / 3.0f);
+
+  // partition triangle indices in place so that each node refers to a contiguous range of them
+  std::vector<std::uint32_t> order(triangles_.size());
+  std::iota(order.begin(), order.end(), 0);
+
+  nodes_.push_back(Node{.offset = 0, .count = static_cast<std::uint32_t>(triangles_.size())});
+  std::vector<std::size_t> pending_nodes{0};
+
+  while (!pending_nodes.empty()) {
+    const auto node_index = pending_nodes.back();
+    pending_nodes.pop_back();
+    const auto begin = nodes_[node_index].offset;
+    const auto end = begin + nodes_[node_index].count;
+
+    glm::vec3 min{std::numeric_limits<float>::max()}, max{std::numeric_limits<float>::lowest()};
+    glm::vec3 centroid_min = min, centroid_max = max;
+    for (auto i = begin; i < end; ++i) {
+      for (const auto& position : triangles_[order[i]]) {
+        min = glm::min(min, position);
+        max = glm::max(max, position);
+      }
+      centroid_min = glm::min(centroid_min, centroids[order[i]]);
+      centroid_max = glm::max(centroid_max, centroids[order[i]]);
+    }
+    nodes_[node_index].min = min;
+    nodes_[node_index].max = max;
+
+    // triangles with coincident centroids cannot be separated and remain in a larger leaf
+    const auto extent = centroid_max - centroid_min;
+    const auto axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : extent.y >= extent.z ? 1 : 2;
+    if (end - begin <= kMaxLeafSize || extent[axis] == 0.0f) continue;
+
+    const auto middle = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin,
+                     order.begin() + middle,
+                     order.begin() + end,
+                     [&](const auto i, const auto j) { return centroids[i][axis] < centroids[j][axis]; });
+
+    const auto child_index = nodes_.size();
+    nodes_[node_index].offset = static_cast<std::uint32_t>(child_index);
+    nodes_[node_index].count = 0;
+    nodes_.push_back(Node{.offset = begin, .count = middle - begin});
+    nodes_.push_back(Node{.offset = middle, .count = end - middle});
+    pending_nodes.insert(pending_nodes.end(), {child_index, child_index + 1});
+  }
+
+  std::vector<Triangle> ordered_triangles;
+  ordered_triangles.reserve(triangles_.size());
+  for (const auto i : order) ordered_triangles.push_back(triangles_[i]);
+  triangles_ = std::move(ordered_triangles);
+}
+
+glm::vec3 TriangleBvh::GetClosestPoint(const glm::vec3& point, const Triangle& triangle) noexcept {
+  const auto& [a, b, c] = triangle;
+  const auto ab = b - a;
+  const auto ac = c - a;
+
+  // classify the point by the Voronoi region of the triangle it lies in
+  const auto ap = point - a;
+  const auto d1 = glm::dot(ab, ap);
+  const auto d2 = glm::dot(ac, ap);
+  if (d1 <= 0.0f && d2 <= 0.0f) return a;
+
+  const auto bp = point - b;
+  const auto d3 = glm::dot(ab, bp);
+  const auto d4 = glm::dot(ac, bp);
+  if (d3 >= 0.0f && d4 <= d3) return b;
+
+  const auto vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) return a + d1 / (d1 - d3) * ab;
+
+  const auto cp = point - c;
+  const auto d5 = glm::dot(ab, cp);
+  const auto d6 = glm::dot(ac, cp);
+  if (d6 >= 0.0f && d5 <= d6) return c;
+
+  const auto vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) return a + d2 / (d2 - d6) * ac;
+
+  const auto va = d3 * d6 - d5 * d4;
+  if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f) return b + (d4 - d3) / ((d4 - d3) + (d5 - d6)) * (c - b);
+
+  // a degenerate triangle has no interior so the closest point lies on one of its edges
+  if (va + vb + vc <= 0.0f) {
+    const std::array candidates{
+        GetClosestSegmentPoint(point, a, b), GetClosestSegmentPoint(point, b, c), GetClosestSegmentPoint(point, c, a)};
+    return *std::ranges::min_element(candidates, {}, [&](const auto& candidate) {
+      return GetSquaredDistance(point, candidate);
+    });
+  }
+
+  const auto denominator = 1.0f / (va + vb + vc);
+  return a + ab * (vb * denominator) + ac * (vc * denominator);
+}
+
+const TriangleBvh::Triangle* TriangleBvh::FindClosestTriangle(const glm::vec3& point,
+                                                              const float max_distance) const {
+  if (nodes_.empty()) return nullptr;
+
+  const Triangle* closest_triangle = nullptr;
+  auto min_distance2 = max_distance * max_distance;
+  std::array<std::uint32_t, kMaxStackSize> stack{};
+  std::size_t stack_size = 0;
+  stack[stack_size++] = 0;
+
+  while (stack_size > 0) {
+    const auto& node = nodes_[stack[--stack_size]];
+    if (GetSquaredDistance(point, node.min, node.max) >= min_distance2) continue;
+
+    if (node.count > 0) {
+      for (auto i = node.offset; i < node.offset + node.count; ++i) {
+        if (const auto distance2 = GetSquaredDistance(point, GetClosestPoint(point, triangles_[i]));
+            distance2 < min_distance2) {
+          min_distance2 = distance2;
+          closest_triangle = &triangles_[i];
+        }
+      }
+      continue;
+    }
+
+    // visit the closer child first so that the farther child is more likely to be pruned
+    auto near_child = node.offset, far_child = node.offset + 1;
+    const auto near_distance2 = GetSquaredDistance(point, nodes_[near_child].min, nodes_[near_child].max);
+    const auto far_distance2 = GetSquaredDistance(point, nodes_[far_child].min, nodes_[far_child].max);
+    if (far_distance2 < near_distance2) std::swap(near_child, far_child);
+    stack[stack_size++] = far_child;
+    stack[stack_size++] = near_child;
+  }
+
+  return closest_triangle;
+}
+
+float TriangleBvh::GetDistance(const glm::vec3& point, const float max_distance) const {
+  const auto* const closest_triangle = FindClosestTriangle(point, max_distance);
+  return closest_triangle != nullptr ? glm::distance(point, GetClosestPoint(point, *closest_triangle)) : max_distance;
+}
+
+}  // namespace gfx
@@ -0,0 +1,76 @@
+#ifndef GEOMETRY_TRIANGLE_BVH_H_
+#define GEOMETRY_TRIANGLE_BVH_H_
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+namespace gfx {
+
+/**
+ * @brief A bounding volume hierarchy over a fixed set of triangles used to find the distance from a point to the
+ *        closest triangle without testing every triangle.
+ * @details Triangles are recursively partitioned at the median of their centroids along the longest axis of their
+ *          bounds. Queries descend into the closest child first and prune every node whose bounding box is farther
+ *          than the closest triangle found so far.
+ */
+class TriangleBvh {
+public:
+  /** @brief The positions of a triangle's vertices. */
+  using Triangle = std::array<glm::vec3, 3>;
+
+  /**
+   * @brief Creates a bounding volume hierarchy.
+   * @param triangles The triangles to partition.
+   */
+  explicit TriangleBvh(std::vector<Triangle> triangles);
+
+  /**
+   * @brief Gets the closest point on a triangle to a point.
+   * @param point The point to query.
+   * @param triangle The triangle to find the closest point on.
+   * @return The point on @p triangle with the smallest distance to @p point.
+   * @see "Real-Time Collision Detection" by Christer Ericson (2004), section 5.1.5.
+   */
+  [[nodiscard]] static glm::vec3 GetClosestPoint(const glm::vec3& point, const Triangle& triangle) noexcept;
+
+  /** @brief Gets the triangles in the order they are stored in the leaves of the hierarchy. */
+  [[nodiscard]] const std::vector<Triangle>& triangles() const noexcept { return triangles_; }
+
+  /**
+   * @brief Finds the closest triangle to a point.
+   * @param point The point to query.
+   * @param max_distance The distance beyond which triangles are not searched. Smaller values prune more of the
+   *                     hierarchy.
+   * @return The closest triangle to @p point or null if no triangle is closer than @p max_distance.
+   */
+  [[nodiscard]] const Triangle* FindClosestTriangle(const glm::vec3& point,
+                                                    float max_distance = std::numeric_limits<float>::infinity()) const;
+
+  /**
+   * @brief Gets the distance from a point to the closest triangle.
+   * @param point The point to query.
+   * @param max_distance The distance beyond which triangles are not searched.
+   * @return The distance from @p point to the closest triangle or @p max_distance if no triangle is closer.
+   */
+  [[nodiscard]] float GetDistance(const glm::vec3& point,
+                                  float max_distance = std::numeric_limits<float>::infinity()) const;
+
+private:
+  /** @brief A node in the hierarchy. Interior nodes have no triangles and store their two children consecutively. */
+  struct Node {
+    glm::vec3 min{0.0f}, max{0.0f};
+    std::uint32_t offset = 0;  // the first triangle of a leaf or the first child of an interior node
+    std::uint32_t count = 0;   // the number of triangles in a leaf
+  };
+
+  std::vector<Triangle> triangles_;
+  std::vector<Node> nodes_;
+};
+
+}  // namespace gfx
+
+#endif  // GEOMETRY_TRIANGLE_BVH_H_
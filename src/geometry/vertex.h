@@ -2,6 +2,7 @@
 #define GEOMETRY_VERTEX_H_
 
 #include <cassert>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -59,26 +60,27 @@ public:
 
   /** @brief Gets the hash value for a vertex pair. */
   friend std::size_t hash_value(const Vertex& v0, const Vertex& v1) noexcept {
-    // NOLINTBEGIN(*-magic-numbers)
-    std::size_t seed = 0x32C95994;
-    seed ^= (seed << 6u) + (seed >> 2u) + 0x3FA612CEu + hash_value(v0);
-    seed ^= (seed << 6u) + (seed >> 2u) + 0x197685C2u + hash_value(v1);
-    // NOLINTEND(*-magic-numbers)
-    return seed;
+    // pack both IDs into a single value so that distinct vertex pairs can never produce the same hash key
+    static_assert(sizeof(std::size_t) >= 2 * sizeof(std::uint32_t));
+    return static_cast<std::size_t>(static_cast<std::uint32_t>(v0.id())) << 32u
+           | static_cast<std::uint32_t>(v1.id());  // NOLINT(*-magic-numbers)
   }
 
   /** @brief Gets the hash value for vertex triple. */
   friend std::size_t hash_value(const Vertex& v0, const Vertex& v1, const Vertex& v2) noexcept {
+    return Mix(Mix(hash_value(v0, v1)) ^ hash_value(v2));
+  }
+
+private:
+  /** @brief Scrambles the bits of a hash value using the SplitMix64 finalizer. */
+  static constexpr std::size_t Mix(std::size_t seed) noexcept {
     // NOLINTBEGIN(*-magic-numbers)
-    std::size_t seed = 0x230402B5;
-    seed ^= (seed << 6u) + (seed >> 2u) + 0x72C2C6EBu + hash_value(v0);
-    seed ^= (seed << 6u) + (seed >> 2u) + 0x16E199E4u + hash_value(v1);
-    seed ^= (seed << 6u) + (seed >> 2u) + 0x6F89F2A8u + hash_value(v2);
+    seed = (seed ^ (seed >> 30u)) * 0xBF58476D1CE4E5B9u;
+    seed = (seed ^ (seed >> 27u)) * 0x94D049BB133111EBu;
+    return seed ^ (seed >> 31u);
     // NOLINTEND(*-magic-numbers)
-    return seed;
   }
 
-private:
   std::optional<int> id_;
   glm::vec3 position_;
   std::weak_ptr<const HalfEdge> edge_;
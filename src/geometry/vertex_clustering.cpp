@@ -0,0 +1,101 @@
+#include "geometry/vertex_clustering.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/hash.hpp>
+
+#include "geometry/mesh_data.h"
+
+namespace gfx {
+
+namespace {
+
+/** @brief Gets a key which uniquely identifies a directed edge between two vertices. */
+std::uint64_t GetEdgeKey(const std::uint32_t v0, const std::uint32_t v1) noexcept {
+  return static_cast<std::uint64_t>(v0) << 32u | v1;  // NOLINT(*-magic-numbers)
+}
+
+/** @brief Computes the total surface area of a triangle mesh. */
+float ComputeSurfaceArea(const std::vector<glm::vec3>& positions, const std::vector<std::uint32_t>& indices) {
+  auto area = 0.0f;
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    const auto& p0 = positions[indices[i]];
+    const auto& p1 = positions[indices[i + 1]];
+    const auto& p2 = positions[indices[i + 2]];
+    area += glm::length(glm::cross(p1 - p0, p2 - p0)) / 2.0f;
+  }
+  return area;
+}
+
+}  // namespace
+
+MeshData mesh::ClusterVertices(const MeshData& mesh, const std::size_t vertex_count) {
+  if (vertex_count == 0) throw std::invalid_argument{"Unable to cluster a mesh into zero vertices"};
+
+  const auto& positions = mesh.positions();
+  const auto& indices = mesh.indices();
+  const auto surface_area = ComputeSurfaceArea(positions, indices);
+  if (surface_area == 0.0f) return MeshData{positions, {}, {}, indices, mesh.model_transform()};
+
+  // assign each vertex to the grid cell containing it
+  const auto cell_size = std::sqrt(surface_area / static_cast<float>(vertex_count));
+  std::unordered_map<glm::ivec3, std::uint32_t> cell_clusters;
+  std::vector<std::uint32_t> vertex_clusters;
+  vertex_clusters.reserve(positions.size());
+
+  for (const auto& position : positions) {
+    const glm::ivec3 cell{glm::floor(position / cell_size)};
+    const auto [iterator, _] = cell_clusters.try_emplace(cell, static_cast<std::uint32_t>(cell_clusters.size()));
+    vertex_clusters.push_back(iterator->second);
+  }
+
+  // reconnect triangles between clusters while discarding triangles that cannot be represented by a half-edge mesh
+  std::vector<std::uint32_t> cluster_indices;
+  std::unordered_set<std::uint64_t> edges;
+
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    const std::array face{
+        vertex_clusters[indices[i]], vertex_clusters[indices[i + 1]], vertex_clusters[indices[i + 2]]};
+    if (face[0] == face[1] || face[1] == face[2] || face[2] == face[0]) continue;
+
+    const std::array face_edges{
+        GetEdgeKey(face[0], face[1]), GetEdgeKey(face[1], face[2]), GetEdgeKey(face[2], face[0])};
+    if (edges.contains(face_edges[0]) || edges.contains(face_edges[1]) || edges.contains(face_edges[2])) continue;
+
+    edges.insert(face_edges.begin(), face_edges.end());
+    cluster_indices.insert(cluster_indices.end(), face.begin(), face.end());
+  }
+
+  // represent each cluster referenced by a triangle by the average position of its vertices
+  std::vector<glm::vec3> cluster_positions(cell_clusters.size(), glm::vec3{0.0f});
+  std::vector<int> cluster_sizes(cell_clusters.size(), 0);
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    cluster_positions[vertex_clusters[i]] += positions[i];
+    ++cluster_sizes[vertex_clusters[i]];
+  }
+
+  std::vector<std::uint32_t> compact_indices(cell_clusters.size(), 0);
+  std::vector<bool> referenced(cell_clusters.size(), false);
+  for (const auto cluster : cluster_indices) referenced[cluster] = true;
+
+  std::vector<glm::vec3> compact_positions;
+  for (std::size_t i = 0; i < cluster_positions.size(); ++i) {
+    if (referenced[i]) {
+      compact_indices[i] = static_cast<std::uint32_t>(compact_positions.size());
+      compact_positions.push_back(cluster_positions[i] / static_cast<float>(cluster_sizes[i]));
+    }
+  }
+  for (auto& cluster : cluster_indices) cluster = compact_indices[cluster];
+
+  return MeshData{std::move(compact_positions), {}, {}, std::move(cluster_indices), mesh.model_transform()};
+}
+
+}  // namespace gfx
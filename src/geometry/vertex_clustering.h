@@ -0,0 +1,30 @@
+#ifndef GEOMETRY_VERTEX_CLUSTERING_H_
+#define GEOMETRY_VERTEX_CLUSTERING_H_
+
+#include <cstddef>
+
+namespace gfx {
+class MeshData;
+
+namespace mesh {
+
+/**
+ * @brief Reduces the number of vertices in a mesh by merging all vertices that fall in the same cell of a uniform grid.
+ * @details The grid cell size is chosen so that the surface area in each cell approximates the surface area per
+ *          vertex in the result. Each cluster is represented by the average position of its vertices. Triangles that
+ *          degenerate or would share a directed edge with a previously kept triangle are discarded so that the result
+ *          can be represented by a half-edge mesh, although it may contain boundaries and non-manifold vertices.
+ *          Clustering takes time linear in the size of the mesh regardless of the reduction, but it does not
+ *          preserve features as well as edge contraction.
+ * @param mesh The mesh to cluster.
+ * @param vertex_count The approximate number of vertices in the clustered mesh.
+ * @return A mesh with approximately @p vertex_count vertices.
+ * @throw std::invalid_argument Thrown if @p vertex_count is zero.
+ * @see "Multi-resolution 3D Approximations for Rendering Complex Scenes" by Jarek Rossignac and Paul Borrel (1993).
+ */
+MeshData ClusterVertices(const MeshData& mesh, std::size_t vertex_count);
+
+}  // namespace mesh
+}  // namespace gfx
+
+#endif  // GEOMETRY_VERTEX_CLUSTERING_H_
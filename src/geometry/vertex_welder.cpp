@@ -0,0 +1,445 @@
+#include "geometry/vertex_welder.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/hash.hpp>
+
+#include "geometry/parallel_for.h"
+
+namespace gfx {
+
+namespace {
+
+/**
+ * @brief The minimum size of a grid cell as a fraction of the length of the bounding box diagonal which bounds the
+ *        number of cells along each axis when positions are welded with a small tolerance.
+ */
+constexpr float kMinCellSize = 1.0f / static_cast<float>(1u << 20u);
+
+/** @brief How the vertices of a triangle are assigned after welding. */
+enum class TriangleCorners : std::uint8_t {
+  kWelded,    // each corner refers to the vertex it was welded to
+  kOriginal,  // each corner keeps its original vertex because welding would duplicate a directed edge
+  kDiscarded  // the triangle degenerates when welded
+};
+
+/** @brief Gets a key which uniquely identifies a directed edge between two vertices. */
+std::uint64_t GetEdgeKey(const std::uint32_t v0, const std::uint32_t v1) noexcept {
+  return static_cast<std::uint64_t>(v0) << 32u | v1;  // NOLINT(*-magic-numbers)
+}
+
+/** @brief Splits a range of indices into contiguous subranges that are processed concurrently. */
+class Ranges {
+public:
+  Ranges(const std::size_t size, const std::size_t thread_count)
+      : size_{size}, count_{std::min(std::max<std::size_t>(thread_count, 1) * 4, size)} {}
+
+  [[nodiscard]] std::size_t count() const noexcept { return count_; }
+
+  [[nodiscard]] std::pair<std::size_t, std::size_t> operator[](const std::size_t i) const noexcept {
+    return {size_ * i / count_, size_ * (i + 1) / count_};
+  }
+
+private:
+  std::size_t size_;
+  std::size_t count_;
+};
+
+/**
+ * @brief Lists the vertices of each grid cell partitioned by hash across worker threads so that each worker builds
+ *        its own hash table without synchronization.
+ */
+class SpatialHash {
+public:
+  SpatialHash(std::vector<glm::ivec3> cells, const std::size_t thread_count)
+      : cells_{std::move(cells)}, partitions_(std::max<std::size_t>(thread_count, 1)) {
+    const Ranges ranges{cells_.size(), thread_count};
+    std::vector<std::size_t> hashes(cells_.size());
+    ParallelFor(ranges.count(), thread_count, [&](const std::size_t i) {
+      for (auto [j, end] = ranges[i]; j < end; ++j) hashes[j] = std::hash<glm::ivec3>{}(cells_[j]);
+    });
+
+    // vertices are appended in index order so that each cell lists its vertices in ascending order
+    ParallelFor(partitions_.size(), thread_count, [&](const std::size_t partition) {
+      for (std::size_t i = 0; i < cells_.size(); ++i) {
+        if (hashes[i] % partitions_.size() == partition) {
+          partitions_[partition][cells_[i]].push_back(static_cast<std::uint32_t>(i));
+        }
+      }
+    });
+  }
+
+  /** @brief Gets the cell that contains a vertex. */
+  [[nodiscard]] const glm::ivec3& cell(const std::size_t vertex) const noexcept { return cells_[vertex]; }
+
+  /** @brief Gets the vertices in a cell in ascending order or @c nullptr if the cell is empty. */
+  [[nodiscard]] const std::vector<std::uint32_t>* Find(const glm::ivec3& cell) const {
+    const auto& partition = partitions_[std::hash<glm::ivec3>{}(cell) % partitions_.size()];
+    const auto iterator = partition.find(cell);
+    return iterator == partition.end() ? nullptr : &iterator->second;
+  }
+
+private:
+  std::vector<glm::ivec3> cells_;
+  std::vector<std::unordered_map<glm::ivec3, std::vector<std::uint32_t>>> partitions_;
+};
+
+/** @brief The preceding vertices within the position tolerance of each vertex in a range. */
+struct Neighbors {
+  std::vector<std::uint32_t> offsets{0};
+  std::vector<std::uint32_t> vertices;
+};
+
+/**
+ * @brief Assigns each vertex to the first preceding cluster representative within the position tolerance.
+ * @details Neighbor queries are performed concurrently, but representatives are assigned in a single pass in index
+ *          order so that every vertex in a cluster is within the tolerance of its representative and clusters do not
+ *          grow by chaining vertices that are each within the tolerance of the previous one.
+ * @return The index of the representative of each vertex which precedes or equals it.
+ */
+std::vector<std::uint32_t> GetPositionRepresentatives(const std::span<const glm::vec3> positions,
+                                                      const float position_tolerance,
+                                                      const std::size_t thread_count) {
+  const Ranges ranges{positions.size(), thread_count};
+  std::vector<std::pair<glm::vec3, glm::vec3>> range_bounds(ranges.count());
+  ParallelFor(ranges.count(), thread_count, [&](const std::size_t i) {
+    auto& [min, max] = range_bounds[i];
+    min = glm::vec3{std::numeric_limits<float>::max()};
+    max = glm::vec3{std::numeric_limits<float>::lowest()};
+    for (auto [j, end] = ranges[i]; j < end; ++j) {
+      min = glm::min(min, positions[j]);
+      max = glm::max(max, positions[j]);
+    }
+  });
+  auto [min, max] = range_bounds.front();
+  for (const auto& [range_min, range_max] : range_bounds) {
+    min = glm::min(min, range_min);
+    max = glm::max(max, range_max);
+  }
+
+  const auto diagonal = glm::distance(min, max);
+  const auto tolerance = position_tolerance * diagonal;
+  const auto cell_size = diagonal > 0.0f ? std::max(tolerance, kMinCellSize * diagonal) : 1.0f;
+
+  // cells are offset from the bounding box minimum so that cell coordinates are bounded by 1 / kMinCellSize
+  std::vector<glm::ivec3> cells(positions.size());
+  ParallelFor(ranges.count(), thread_count, [&](const std::size_t i) {
+    for (auto [j, end] = ranges[i]; j < end; ++j) {
+      cells[j] = glm::ivec3{glm::floor((positions[j] - min) / cell_size)};
+    }
+  });
+  const SpatialHash spatial_hash{std::move(cells), thread_count};
+
+  std::vector<Neighbors> range_neighbors(ranges.count());
+  ParallelFor(ranges.count(), thread_count, [&](const std::size_t i) {
+    auto& [offsets, vertices] = range_neighbors[i];
+    for (auto [j, end] = ranges[i]; j < end; ++j) {
+      const auto begin = vertices.size();
+      const auto& cell = spatial_hash.cell(j);
+      for (auto dz = -1; dz <= 1; ++dz) {
+        for (auto dy = -1; dy <= 1; ++dy) {
+          for (auto dx = -1; dx <= 1; ++dx) {
+            const auto* const cell_vertices = spatial_hash.Find(cell + glm::ivec3{dx, dy, dz});
+            if (cell_vertices == nullptr) continue;
+            for (const auto k : *cell_vertices) {
+              if (k >= j) break;
+              if (glm::distance(positions[j], positions[k]) <= tolerance) vertices.push_back(k);
+            }
+          }
+        }
+      }
+      std::ranges::sort(vertices.begin() + static_cast<std::ptrdiff_t>(begin), vertices.end());
+      offsets.push_back(static_cast<std::uint32_t>(vertices.size()));
+    }
+  });
+
+  std::vector<std::uint32_t> representatives(positions.size());
+  for (std::size_t i = 0; i < ranges.count(); ++i) {
+    const auto& [offsets, vertices] = range_neighbors[i];
+    const auto begin = ranges[i].first;
+    for (auto [j, end] = ranges[i]; j < end; ++j) {
+      const auto first = offsets[j - begin];
+      const auto neighbors = std::span{vertices}.subspan(first, offsets[j - begin + 1] - first);
+      const auto iterator = std::ranges::find_if(neighbors, [&](const auto k) { return representatives[k] == k; });
+      representatives[j] = iterator == neighbors.end() ? static_cast<std::uint32_t>(j) : *iterator;
+    }
+  }
+  return representatives;
+}
+
+/**
+ * @brief Merges welded vertices whose attributes agree.
+ * @details Each cluster of welded vertices is processed independently so clusters are distributed across worker
+ *          threads. Within a cluster, each vertex is merged into the first preceding vertex whose attributes agree
+ *          that was not itself merged.
+ * @return The index of the vertex each vertex is merged into which precedes or equals it.
+ */
+std::vector<std::uint32_t> GetVertexRepresentatives(const std::span<const glm::vec3> normals,
+                                                    const std::span<const glm::vec2> texcoords,
+                                                    const std::vector<std::uint32_t>& position_representatives,
+                                                    const WeldOptions& options,
+                                                    const std::size_t thread_count) {
+  if (normals.empty() && texcoords.empty()) return position_representatives;
+
+  // list the vertices of each cluster in ascending order
+  const auto vertex_count = position_representatives.size();
+  std::vector<std::uint32_t> cluster_offsets(vertex_count + 1, 0);
+  for (const auto representative : position_representatives) ++cluster_offsets[representative + 1];
+  for (std::size_t i = 0; i < vertex_count; ++i) cluster_offsets[i + 1] += cluster_offsets[i];
+  std::vector<std::uint32_t> cluster_vertices(vertex_count);
+  std::vector<std::uint32_t> cluster_ends(cluster_offsets.begin(), cluster_offsets.end() - 1);
+  for (std::uint32_t i = 0; std::cmp_less(i, vertex_count); ++i) {
+    cluster_vertices[cluster_ends[position_representatives[i]]++] = i;
+  }
+
+  const auto min_normal_cosine = std::cos(options.normal_angle);
+  const auto agree = [&](const std::uint32_t i, const std::uint32_t j) {
+    if (!normals.empty()) {
+      const auto length_product = glm::length(normals[i]) * glm::length(normals[j]);
+      if (length_product == 0.0f ? normals[i] != normals[j]
+                                 : glm::dot(normals[i], normals[j]) < min_normal_cosine * length_product) {
+        return false;
+      }
+    }
+    return texcoords.empty() || glm::distance(texcoords[i], texcoords[j]) <= options.texcoord_tolerance;
+  };
+
+  std::vector<std::uint32_t> representatives(vertex_count);
+  const Ranges ranges{vertex_count, thread_count};
+  ParallelFor(ranges.count(), thread_count, [&](const std::size_t i) {
+    std::vector<std::uint32_t> cluster_representatives;
+    for (auto [j, end] = ranges[i]; j < end; ++j) {
+      if (position_representatives[j] != j) continue;
+      cluster_representatives.clear();
+      for (auto k = cluster_offsets[j]; k < cluster_offsets[j + 1]; ++k) {
+        const auto vertex = cluster_vertices[k];
+        const auto iterator = std::ranges::find_if(cluster_representatives, [&](const auto representative) {
+          return agree(vertex, representative);
+        });
+        if (iterator == cluster_representatives.end()) {
+          cluster_representatives.push_back(vertex);
+          representatives[vertex] = vertex;
+        } else {
+          representatives[vertex] = *iterator;
+        }
+      }
+    }
+  });
+  return representatives;
+}
+
+/**
+ * @brief Splits clusters of welded positions whose triangles form more than one fan.
+ * @details Triangles at a vertex belong to the same fan if they are connected by edges incident to that vertex. Parts
+ *          of a mesh within the position tolerance of each other are welded into a vertex with a fan for each part
+ *          which cannot be represented by a half-edge mesh. Each fan after the first becomes a cluster of its own
+ *          represented by its first vertex unless one of its vertices also has corners in another fan, which only
+ *          occurs if the mesh was not manifold before welding.
+ * @param indices Element indices where consecutive triples define a triangle face in the mesh.
+ * @param triangle_corners How the vertices of each triangle are assigned after welding.
+ * @param position_representatives The index of the cluster representative of each vertex which is updated in place.
+ */
+void SplitFans(const std::span<const std::uint32_t> indices,
+               const std::vector<TriangleCorners>& triangle_corners,
+               std::vector<std::uint32_t>& position_representatives) {
+  const auto get_vertex = [&](const std::size_t corner) {
+    const auto index = indices[corner];
+    return triangle_corners[corner / 3] == TriangleCorners::kWelded ? position_representatives[index] : index;
+  };
+
+  std::vector<std::size_t> parents(indices.size());
+  std::iota(parents.begin(), parents.end(), 0);
+  const auto find_root = [&](std::size_t corner) {
+    while (parents[corner] != corner) corner = parents[corner] = parents[parents[corner]];
+    return corner;
+  };
+
+  // corners at the same vertex are in the same fan if their triangles share an edge incident to that vertex
+  std::unordered_map<std::uint64_t, std::size_t> spoke_corners;
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    if (triangle_corners[i / 3] == TriangleCorners::kDiscarded) continue;
+    const auto face = i - i % 3;
+    for (const auto j : {face + (i + 1) % 3, face + (i + 2) % 3}) {
+      if (const auto [iterator, inserted] = spoke_corners.try_emplace(GetEdgeKey(get_vertex(i), get_vertex(j)), i);
+          !inserted) {
+        parents[find_root(i)] = find_root(iterator->second);
+      }
+    }
+  }
+
+  std::unordered_map<std::size_t, std::vector<std::size_t>> fans;
+  std::map<std::uint32_t, std::vector<std::size_t>> vertex_fans;
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    if (triangle_corners[i / 3] == TriangleCorners::kDiscarded) continue;
+    const auto [iterator, inserted] = fans.try_emplace(find_root(i));
+    if (inserted) vertex_fans[get_vertex(i)].push_back(iterator->first);
+    iterator->second.push_back(i);
+  }
+
+  for (const auto& [vertex, roots] : vertex_fans) {
+    if (roots.size() < 2) continue;
+
+    // the fan containing the cluster representative keeps it and a vertex in more than one fan cannot be split
+    std::unordered_map<std::uint32_t, std::size_t> vertex_fan_indices;
+    std::vector<bool> is_splittable(roots.size(), true);
+    auto first_fan_index = std::size_t{0};
+    for (std::size_t i = 0; i < roots.size(); ++i) {
+      for (const auto corner : fans.at(roots[i])) {
+        const auto index = indices[corner];
+        if (index == vertex) first_fan_index = i;
+        if (const auto [iterator, inserted] = vertex_fan_indices.try_emplace(index, i);
+            !inserted && iterator->second != i) {
+          is_splittable[i] = is_splittable[iterator->second] = false;
+        }
+      }
+    }
+
+    for (std::size_t i = 0; i < roots.size(); ++i) {
+      if (i == first_fan_index || !is_splittable[i]) continue;
+      const auto& corners = fans.at(roots[i]);
+      const auto representative =
+          std::ranges::min(corners | std::views::transform([&](const auto corner) { return indices[corner]; }));
+      if (vertex_fans.contains(representative)) continue;  // the vertex is already used by an unwelded triangle
+      for (const auto corner : corners) position_representatives[indices[corner]] = representative;
+    }
+  }
+}
+
+}  // namespace
+
+vertex_welder::WeldedMesh vertex_welder::Weld(const std::span<const glm::vec3> positions,
+                                              const std::span<const glm::vec3> normals,
+                                              const std::span<const glm::vec2> texcoords,
+                                              const std::span<const std::uint32_t> indices,
+                                              const WeldOptions& options,
+                                              const std::size_t thread_count) {
+  if (indices.size() % 3 != 0) {
+    throw std::invalid_argument{std::format("Invalid number of triangle indices: {}", indices.size())};
+  }
+  if (const auto iterator = std::ranges::find_if(indices, [&](const auto index) { return index >= positions.size(); });
+      iterator != indices.end()) {
+    throw std::invalid_argument{std::format("Triangle index {} refers to a vertex that does not exist", *iterator)};
+  }
+  if ((!normals.empty() && normals.size() != positions.size())
+      || (!texcoords.empty() && texcoords.size() != positions.size())) {
+    throw std::invalid_argument{"Vertex attributes must align with position data"};
+  }
+  if (options.position_tolerance < 0.0f || options.normal_angle < 0.0f || options.texcoord_tolerance < 0.0f) {
+    throw std::invalid_argument{"Weld tolerances must be nonnegative"};
+  }
+  if (positions.empty()) return WeldedMesh{};
+
+  auto position_representatives = GetPositionRepresentatives(positions, options.position_tolerance, thread_count);
+
+  // discard triangles that degenerate and keep the original vertices of triangles that would duplicate a directed
+  // edge since neither can be represented by a half-edge mesh
+  const auto triangle_count = indices.size() / 3;
+  std::vector<TriangleCorners> triangle_corners(triangle_count, TriangleCorners::kWelded);
+  std::unordered_set<std::uint64_t> edges;
+  edges.reserve(indices.size());
+
+  for (std::size_t i = 0; i < triangle_count; ++i) {
+    const auto* const triangle = indices.data() + 3 * i;
+    std::array face{position_representatives[triangle[0]],
+                    position_representatives[triangle[1]],
+                    position_representatives[triangle[2]]};
+    if (face[0] == face[1] || face[1] == face[2] || face[2] == face[0]) {
+      triangle_corners[i] = TriangleCorners::kDiscarded;
+      continue;
+    }
+    if (edges.contains(GetEdgeKey(face[0], face[1])) || edges.contains(GetEdgeKey(face[1], face[2]))
+        || edges.contains(GetEdgeKey(face[2], face[0]))) {
+      triangle_corners[i] = TriangleCorners::kOriginal;
+      face = {triangle[0], triangle[1], triangle[2]};
+    }
+    edges.insert({GetEdgeKey(face[0], face[1]), GetEdgeKey(face[1], face[2]), GetEdgeKey(face[2], face[0])});
+  }
+
+  SplitFans(indices, triangle_corners, position_representatives);
+  const auto vertex_representatives =
+      GetVertexRepresentatives(normals, texcoords, position_representatives, options, thread_count);
+
+  std::vector<bool> has_original_corner(positions.size(), false);
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    if (const auto index = indices[i]; triangle_corners[i / 3] == TriangleCorners::kOriginal) {
+      has_original_corner[index] = has_original_corner[index] || position_representatives[index] != index;
+    }
+  }
+
+  // count the new vertices in each range to find where they begin in the welded mesh
+  const Ranges vertex_ranges{positions.size(), thread_count};
+  std::vector<std::uint32_t> vertex_offsets(vertex_ranges.count() + 1, 0);
+  ParallelFor(vertex_ranges.count(), thread_count, [&](const std::size_t i) {
+    for (auto [j, end] = vertex_ranges[i]; j < end; ++j) {
+      vertex_offsets[i + 1] += (vertex_representatives[j] == j) + has_original_corner[j];
+    }
+  });
+  for (std::size_t i = 0; i < vertex_ranges.count(); ++i) vertex_offsets[i + 1] += vertex_offsets[i];
+
+  // welded vertices take the position of their cluster representative so that attribute seams share a position
+  WeldedMesh welded_mesh;
+  welded_mesh.positions.resize(vertex_offsets.back());
+  if (!normals.empty()) welded_mesh.normals.resize(vertex_offsets.back());
+  if (!texcoords.empty()) welded_mesh.texcoords.resize(vertex_offsets.back());
+  std::vector<std::uint32_t> welded_indices(positions.size()), original_indices(positions.size());
+
+  ParallelFor(vertex_ranges.count(), thread_count, [&](const std::size_t i) {
+    auto index = vertex_offsets[i];
+    const auto add_vertex = [&](const std::size_t vertex, const glm::vec3& position) {
+      welded_mesh.positions[index] = position;
+      if (!normals.empty()) welded_mesh.normals[index] = normals[vertex];
+      if (!texcoords.empty()) welded_mesh.texcoords[index] = texcoords[vertex];
+      return index++;
+    };
+    for (auto [j, end] = vertex_ranges[i]; j < end; ++j) {
+      if (vertex_representatives[j] == j) welded_indices[j] = add_vertex(j, positions[position_representatives[j]]);
+      if (has_original_corner[j]) original_indices[j] = add_vertex(j, positions[j]);
+    }
+  });
+
+  const Ranges triangle_ranges{triangle_count, thread_count};
+  std::vector<std::size_t> triangle_offsets(triangle_ranges.count() + 1, 0);
+  ParallelFor(triangle_ranges.count(), thread_count, [&](const std::size_t i) {
+    for (auto [j, end] = triangle_ranges[i]; j < end; ++j) {
+      triangle_offsets[i + 1] += triangle_corners[j] != TriangleCorners::kDiscarded;
+    }
+  });
+  for (std::size_t i = 0; i < triangle_ranges.count(); ++i) triangle_offsets[i + 1] += triangle_offsets[i];
+
+  welded_mesh.indices.resize(triangle_offsets.back() * 3);
+  ParallelFor(triangle_ranges.count(), thread_count, [&](const std::size_t i) {
+    auto* it = welded_mesh.indices.data() + triangle_offsets[i] * 3;
+    for (auto [j, end] = triangle_ranges[i]; j < end; ++j) {
+      if (triangle_corners[j] == TriangleCorners::kDiscarded) continue;
+      for (std::size_t k = 3 * j; k < 3 * j + 3; ++k) {
+        const auto index = indices[k];
+        if (triangle_corners[j] == TriangleCorners::kWelded) {
+          *it++ = welded_indices[vertex_representatives[index]];
+        } else {
+          *it++ = position_representatives[index] == index ? welded_indices[index] : original_indices[index];
+        }
+      }
+    }
+  });
+
+  return welded_mesh;
+}
+
+}  // namespace gfx
@@ -0,0 +1,76 @@
+#ifndef GEOMETRY_VERTEX_WELDER_H_
+#define GEOMETRY_VERTEX_WELDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+namespace gfx {
+
+/** @brief Options that control which vertices are welded together. */
+struct WeldOptions {
+  /**
+   * @brief The maximum distance between welded positions as a fraction of the length of the bounding box diagonal.
+   *        Only identical positions are welded when this value is zero.
+   */
+  float position_tolerance = 1.0e-6f;
+
+  /** @brief The maximum angle in radians between the normals of vertices that are merged into a single vertex. */
+  float normal_angle = 1.0e-2f;
+
+  /** @brief The maximum distance between the texture coordinates of vertices that are merged into a single vertex. */
+  float texcoord_tolerance = 1.0e-6f;
+};
+
+namespace vertex_welder {
+
+/** @brief Vertex attributes and triangle indices of a welded mesh. */
+struct WeldedMesh {
+  std::vector<glm::vec3> positions;
+  std::vector<glm::vec3> normals;    // empty if the input mesh does not have normals
+  std::vector<glm::vec2> texcoords;  // empty if the input mesh does not have texture coordinates
+  std::vector<std::uint32_t> indices;
+};
+
+/**
+ * @brief Welds mesh vertices whose positions are within a tolerance of each other.
+ * @details Meshes exported with per-face normals or texture seams duplicate each position once for every attribute
+ *          combination, and positions written with limited precision may no longer be identical. Vertices are hashed
+ *          into a uniform grid whose cells are at least as large as the position tolerance, and each vertex is
+ *          welded to the first preceding cluster representative within the tolerance in one of its 27 neighboring
+ *          cells. Welded vertices are then merged into a single vertex if their normals and texture coordinates also
+ *          agree, otherwise they remain separate vertices that share the exact position of their representative so
+ *          that a @c HalfEdgeMesh welds them into one vertex with a wedge for each attribute combination. Grid
+ *          construction and neighbor queries are partitioned across worker threads, and the result is identical
+ *          regardless of the number of threads.
+ * @param positions The mesh vertex positions.
+ * @param normals The mesh normals or empty if the mesh does not have normals.
+ * @param texcoords The mesh texture coordinates or empty if the mesh does not have texture coordinates.
+ * @param indices Element indices where consecutive triples define a triangle face in the mesh.
+ * @param options Options that control which vertices are welded.
+ * @param thread_count The maximum number of worker threads.
+ * @return A mesh with a vertex for each welded attribute combination in the order it first appears. Triangles that
+ *         degenerate are removed, and triangles that would share a directed edge with a preceding triangle keep their
+ *         original vertices so that the result can be represented by a half-edge mesh. For the same reason, a cluster
+ *         whose triangles form more than one fan (e.g., where two surfaces touch within the position tolerance) is
+ *         split into a cluster for each fan.
+ * @throw std::invalid_argument Thrown if the number of indices is not a multiple of 3, an index refers to a vertex
+ *                              that does not exist, an attribute is not specified for every vertex, or a tolerance is
+ *                              negative.
+ */
+[[nodiscard]] WeldedMesh Weld(std::span<const glm::vec3> positions,
+                              std::span<const glm::vec3> normals,
+                              std::span<const glm::vec2> texcoords,
+                              std::span<const std::uint32_t> indices,
+                              const WeldOptions& options = {},
+                              std::size_t thread_count = std::thread::hardware_concurrency());
+
+}  // namespace vertex_welder
+}  // namespace gfx
+
+#endif  // GEOMETRY_VERTEX_WELDER_H_
@@ -1,8 +1,8 @@
 #ifndef GRAPHICS_MESH_H_
 #define GRAPHICS_MESH_H_
 
+#include <cstddef>
 #include <span>
-#include <utility>
 #include <vector>
 
 #include <GL/gl3w.h>
@@ -11,59 +11,72 @@
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 
+#include "geometry/mesh_data.h"
+
 namespace gfx {
 
 /** @brief A renderable triangle mesh. */
 class Mesh {
 public:
   /**
-   * @brief Creates a triangle mesh.
-   * @param positions The mesh vertex positions.
-   * @param normals The mesh normals.
-   * @param texcoords The mesh texture coordinates.
-   * @param indices Element indices where consecutive triples define a triangle face in the mesh.
-   * @param model_transform A 4x4 matrix representing an affine transform to apply to the mesh in model space.
-   * @throw std::invalid_argument Indicates the provided arguments do not represent a valid triangle mesh.
-   * @note If @p indices is non-empty, it must define a valid triangle mesh (i.e., its size must be a nonzero multiple
-   *       of 3). Otherwise, triangles are interpreted as sequential triples in @p positions which requires alignment
-   *       with @normals and @texcoords if specified.
+   * @brief Creates a renderable triangle mesh by uploading mesh data to the GPU.
+   * @param mesh_data The mesh to render which is moved into the mesh without copying its vertex attributes.
+   * @note The calling thread must have a current OpenGL context.
    */
-  explicit Mesh(std::span<const glm::vec3> positions,
-                std::span<const glm::vec3> normals = {},
-                std::span<const glm::vec2> texcoords = {},
-                std::span<const GLuint> indices = {},
-                const glm::mat4& model_transform = glm::mat4{1.0f});
+  explicit Mesh(MeshData mesh_data);
 
   Mesh(const Mesh&) = delete;
   Mesh& operator=(const Mesh&) = delete;
 
-  Mesh(Mesh&& mesh) noexcept { *this = std::move(mesh); }
+  Mesh(Mesh&& mesh) noexcept;
   Mesh& operator=(Mesh&& mesh) noexcept;
 
   ~Mesh() noexcept;
 
+  /** @brief Gets the mesh data rendered by the mesh. */
+  [[nodiscard]] const MeshData& data() const noexcept { return data_; }
+
   /** @brief Gets the mesh vertex positions. */
-  [[nodiscard]] const std::vector<glm::vec3>& positions() const noexcept { return positions_; }
+  [[nodiscard]] const std::vector<glm::vec3>& positions() const noexcept { return data_.positions(); }
 
   /** @brief Gets the mesh normals. */
-  [[nodiscard]] const std::vector<glm::vec3>& normals() const noexcept { return normals_; }
+  [[nodiscard]] const std::vector<glm::vec3>& normals() const noexcept { return data_.normals(); }
 
   /** @brief Gets the mesh texture coordinates. */
-  [[nodiscard]] const std::vector<glm::vec2>& texcoords() const noexcept { return texcoords_; }
+  [[nodiscard]] const std::vector<glm::vec2>& texcoords() const noexcept { return data_.texcoords(); }
 
   /** @brief Gets the mesh indices corresponding to a triangle face for every three consecutive integers. */
-  [[nodiscard]] const std::vector<GLuint>& indices() const noexcept { return indices_; }
+  [[nodiscard]] const std::vector<GLuint>& indices() const noexcept { return data_.indices(); }
+
+  /**
+   * @brief Resizes the number of element indices to render.
+   * @param size The new number of indices. Indices added by growing the mesh are zero-initialized.
+   * @throw std::invalid_argument Thrown if @p size is not a multiple of 3 or exceeds the number of indices the mesh
+   *                              was created with (i.e., the element buffer capacity).
+   */
+  void ResizeIndices(std::size_t size);
+
+  /**
+   * @brief Overwrites a contiguous range of element indices and streams them to the element buffer.
+   * @param offset The position of the first index to overwrite.
+   * @param indices The new element indices.
+   * @throw std::out_of_range Thrown if the range exceeds the current number of indices.
+   */
+  void UpdateIndices(std::size_t offset, std::span<const GLuint> indices);
 
   /** @brief Gets the affine transform to apply to the mesh in model space. */
-  [[nodiscard]] const glm::mat4& model_transform() const noexcept { return model_transform_; }
+  [[nodiscard]] const glm::mat4& model_transform() const noexcept { return data_.model_transform(); }
+
+  /** @brief Sets the affine transform to apply to the mesh in model space. */
+  void set_model_transform(const glm::mat4& model_transform) noexcept { data_.set_model_transform(model_transform); }
 
   /** @brief Renders the mesh to the current render target. */
   void Render() const noexcept {
     glBindVertexArray(vertex_array_);
     if (element_buffer_ != 0) {
-      glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices_.size()), GL_UNSIGNED_INT, nullptr);
+      glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices().size()), GL_UNSIGNED_INT, nullptr);
     } else {
-      glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(positions_.size()));
+      glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(positions().size()));
     }
     glBindVertexArray(0);
   }
@@ -72,7 +85,7 @@ public:
    * @brief Scales the mesh in local object space.
    * @param scale The x,y,z directions to scale the mesh.
    */
-  void Scale(const glm::vec3& scale) { model_transform_ = glm::scale(model_transform_, scale); }
+  void Scale(const glm::vec3& scale) { set_model_transform(glm::scale(model_transform(), scale)); }
 
   /**
    * @brief Rotates the mesh in local object space.
@@ -80,22 +93,21 @@ public:
    * @param angle The rotation angle specified in radians.
    */
   void Rotate(const glm::vec3& axis, const GLfloat angle) {
-    model_transform_ = glm::rotate(model_transform_, angle, axis);
+    set_model_transform(glm::rotate(model_transform(), angle, axis));
   }
 
   /**
    * @brief Translates the mesh in local object space.
    * @param translation The x,y,z directions to translate the mesh.
    */
-  void Translate(const glm::vec3& translation) { model_transform_ = glm::translate(model_transform_, translation); }
+  void Translate(const glm::vec3& translation) { set_model_transform(glm::translate(model_transform(), translation)); }
 
 private:
+  void Release() noexcept;
+
+  MeshData data_;
   GLuint vertex_array_ = 0, vertex_buffer_ = 0, element_buffer_ = 0;
-  std::vector<glm::vec3> positions_;
-  std::vector<glm::vec3> normals_;
-  std::vector<glm::vec2> texcoords_;
-  std::vector<GLuint> indices_;
-  glm::mat4 model_transform_{0.0f};
+  std::size_t index_capacity_ = 0;
 };
 }  // namespace gfx
 
@@ -7,11 +7,12 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 #include "geometry/mesh_simplifier.h"
+#include "geometry/progressive_mesh.h"
 #include "graphics/arcball.h"
 #include "graphics/material.h"
-#include "graphics/obj_loader.h"
 #include "graphics/shader_program.h"
 #include "graphics/window.h"
+#include "io/obj_loader.h"
 
 namespace gfx {
 
@@ -82,13 +83,16 @@ void SetPointLights(const ShaderProgram& shader_program) {
   }
 }
 
+glm::mat4 GetProjectionTransform(const float aspect_ratio) {
+  const auto [field_of_view_y, z_near, z_far] = kViewFrustum;
+  return glm::perspective(field_of_view_y, aspect_ratio, z_near, z_far);
+}
+
 void SetViewTransforms(const Window& window, const Mesh& mesh, const ShaderProgram& shader_program) {
   static auto prev_aspect_ratio = 0.0f;
 
   if (const auto aspect_ratio = window.GetAspectRatio(); prev_aspect_ratio != aspect_ratio && aspect_ratio > 0.0f) {
-    const auto [field_of_view_y, z_near, z_far] = kViewFrustum;
-    const auto projection_transform = glm::perspective(field_of_view_y, aspect_ratio, z_near, z_far);
-    shader_program.SetUniform("projection_transform", projection_transform);
+    shader_program.SetUniform("projection_transform", GetProjectionTransform(aspect_ratio));
     prev_aspect_ratio = aspect_ratio;
   }
 
@@ -138,7 +142,25 @@ Scene::Scene(Window* const window)
     }
     if (key_code == GLFW_KEY_S) {
       static constexpr auto kDefaultSimplificationRate = 0.5f;
-      mesh_ = mesh::Simplify(mesh_, kDefaultSimplificationRate);
+      // resume the same simplification session so error quadrics and queued edge contractions are preserved
+      if (!mesh_simplifier_.has_value()) mesh_simplifier_.emplace(mesh_.data());
+      auto mesh = mesh::Simplify(*mesh_simplifier_, kDefaultSimplificationRate);
+      mesh.set_model_transform(mesh_.model_transform());
+      mesh_ = Mesh{std::move(mesh)};
+      view_dependent_mesh_ = std::nullopt;
+      return;
+    }
+    if (key_code == GLFW_KEY_V) {
+      if (view_dependent_mesh_.has_value()) {
+        view_dependent_mesh_ = std::nullopt;
+        return;
+      }
+      // record edge contractions down to a coarse base mesh which is then refined each frame for the current view
+      static constexpr auto kBaseMeshSimplificationRate = 0.99f;
+      ProgressiveMesh progressive_mesh{mesh_.data()};
+      mesh::Simplify(mesh_.data(), kBaseMeshSimplificationRate, &progressive_mesh);
+      progressive_mesh.SetFaceCount(0);
+      view_dependent_mesh_.emplace(progressive_mesh);
     }
   });
 
@@ -166,6 +188,16 @@ void Scene::Render(const float delta_time) {
   HandleMouseInput(*window_, mesh_, delta_time);
   SetViewTransforms(*window_, mesh_, shader_program_);
 
+  if (const auto aspect_ratio = window_->GetAspectRatio(); view_dependent_mesh_.has_value() && aspect_ratio > 0.0f) {
+    // the view-dependent mesh shares vertex positions with the source mesh so its model transform is reused
+    const auto [_, height] = window_->GetSize();
+    view_dependent_mesh_->Update(kCamera.view_transform * mesh_.model_transform(),
+                                 GetProjectionTransform(aspect_ratio),
+                                 static_cast<float>(height));
+    view_dependent_mesh_->Render();
+    return;
+  }
+
   mesh_.Render();
 }
 
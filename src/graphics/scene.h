@@ -1,8 +1,12 @@
 #ifndef GRAPHICS_SCENE_H_
 #define GRAPHICS_SCENE_H_
 
+#include <optional>
+
+#include "geometry/mesh_simplifier.h"
 #include "graphics/mesh.h"
 #include "graphics/shader_program.h"
+#include "graphics/view_dependent_mesh.h"
 
 namespace gfx {
 class Window;
@@ -25,6 +29,8 @@ public:
 private:
   Window* window_;
   Mesh mesh_;
+  std::optional<MeshSimplifier> mesh_simplifier_;
+  std::optional<ViewDependentMesh> view_dependent_mesh_;
   ShaderProgram shader_program_;
 };
 
@@ -0,0 +1,368 @@
+#include "graphics/view_dependent_mesh.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include <glm/geometric.hpp>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_access.hpp>
+
+#include "geometry/mesh_data.h"
+#include "geometry/progressive_mesh.h"
+
+namespace gfx {
+
+namespace {
+
+/**
+ * @brief Gets the faces of the full resolution mesh by undoing recorded edge contractions.
+ * @param progressive_mesh The progressive mesh to evaluate.
+ * @return The faces of @p progressive_mesh before any recorded edge contraction has been applied.
+ */
+std::vector<VertexSplit::Face> GetFullResolutionFaces(const ProgressiveMesh& progressive_mesh) {
+  auto faces = progressive_mesh.faces();
+  const auto& vertex_splits = progressive_mesh.vertex_splits();
+
+  for (auto i = progressive_mesh.collapse_count(); i > 0; --i) {
+    const auto& [_, vertex, position, removed_faces, added_faces] = vertex_splits[i - 1];
+    for (const auto& face : added_faces) faces.erase(face);
+    faces.insert(removed_faces.begin(), removed_faces.end());
+  }
+
+  return std::vector(faces.begin(), faces.end());
+}
+
+/**
+ * @brief Computes a face normal scaled by twice the face area.
+ * @param positions Vertex positions indexed by vertex ID.
+ * @param face The face vertex IDs in counter-clockwise order.
+ * @return The area weighted face normal.
+ */
+glm::vec3 ComputeWeightedFaceNormal(const std::vector<glm::vec3>& positions, const VertexSplit::Face& face) {
+  const auto& [v0, v1, v2] = face;
+  return glm::cross(positions[v1] - positions[v0], positions[v2] - positions[v0]);
+}
+
+/**
+ * @brief Creates a renderable mesh containing every vertex in a progressive mesh.
+ * @param progressive_mesh The progressive mesh to create the renderable mesh from.
+ * @return A mesh whose vertex buffer is indexed by vertex ID and whose element buffer can store every face in the
+ *         full resolution mesh (i.e., the level of detail with the most faces).
+ * @note Vertices in the full resolution mesh are assigned normals from their incident faces in the full resolution
+ *       mesh. Vertices created by an edge contraction are assigned normals from the faces added by that contraction.
+ */
+Mesh CreateMesh(const ProgressiveMesh& progressive_mesh) {
+  const auto& positions = progressive_mesh.positions();
+  const auto full_resolution_faces = GetFullResolutionFaces(progressive_mesh);
+  std::vector normals(positions.size(), glm::vec3{0.0f});
+
+  for (const auto& face : full_resolution_faces) {
+    const auto normal = ComputeWeightedFaceNormal(positions, face);
+    for (const auto vertex_id : face) normals[vertex_id] += normal;
+  }
+
+  for (const auto& vertex_split : progressive_mesh.vertex_splits()) {
+    for (const auto& face : vertex_split.added_faces) {
+      normals[vertex_split.vertex] += ComputeWeightedFaceNormal(positions, face);
+    }
+  }
+
+  for (auto& normal : normals) {
+    if (const auto length = glm::length(normal); length > 0.0f) normal /= length;
+  }
+
+  std::vector<std::uint32_t> indices(full_resolution_faces.size() * 3, 0);
+  return Mesh{MeshData{positions, std::move(normals), {}, std::move(indices), progressive_mesh.model_transform()}};
+}
+
+/** @brief Gets the angle in radians between two unit vectors. */
+float GetAngle(const glm::vec3& u, const glm::vec3& v) { return std::acos(std::clamp(glm::dot(u, v), -1.0f, 1.0f)); }
+
+}  // namespace
+
+ViewDependentMesh::ViewDependentMesh(const ProgressiveMesh& progressive_mesh, const RefinementOptions& options)
+    : options_{options}, mesh_{CreateMesh(progressive_mesh)} {
+  const auto& positions = progressive_mesh.positions();
+  const auto& vertex_splits = progressive_mesh.vertex_splits();
+  const auto& normals = mesh_.normals();
+
+  std::unordered_map<VertexSplit::Face, int, ProgressiveMesh::FaceHash> face_ids;
+  const auto get_face_id = [&](const VertexSplit::Face& face) {
+    const auto [iterator, inserted] = face_ids.try_emplace(face, static_cast<int>(faces_.size()));
+    if (inserted) {
+      faces_.push_back(face);
+      face_creators_.push_back(-1);
+      face_removers_.push_back(-1);
+    }
+    return iterator->second;
+  };
+
+  // register faces in the current level of detail first since faces no recorded edge contraction touched are absent
+  // from every vertex split but must still be rendered and bound the normal cones of their vertices
+  for (const auto& face : progressive_mesh.faces()) get_face_id(face);
+
+  // build the vertex hierarchy and the dependencies between recorded edge contractions
+  vertices_.resize(positions.size());
+  vertex_splits_.reserve(vertex_splits.size());
+
+  for (auto i = 0; std::cmp_less(i, vertex_splits.size()); ++i) {
+    const auto& [collapsed_vertices, vertex, position, removed_faces, added_faces] = vertex_splits[i];
+    VertexSplitNode vertex_split_node{.collapsed_vertices = collapsed_vertices,
+                                      .vertex = vertex,
+                                      .removed_faces = {},
+                                      .added_faces = {},
+                                      .applied = std::cmp_less(i, progressive_mesh.collapse_count())};
+
+    for (const auto& face : removed_faces) {
+      const auto face_id = get_face_id(face);
+      face_removers_[face_id] = i;
+      vertex_split_node.removed_faces.push_back(face_id);
+    }
+    for (const auto& face : added_faces) {
+      const auto face_id = get_face_id(face);
+      face_creators_[face_id] = i;
+      vertex_split_node.added_faces.push_back(face_id);
+    }
+
+    vertices_[vertex].vertex_split = i;
+    for (const auto vertex_id : collapsed_vertices) vertices_[vertex_id].parent = i;
+    vertex_splits_.push_back(std::move(vertex_split_node));
+  }
+
+  // compute normal cones for vertices in the full resolution mesh from their incident faces
+  std::vector<glm::vec3> face_normals;
+  face_normals.reserve(faces_.size());
+  for (const auto& face : faces_) {
+    const auto normal = ComputeWeightedFaceNormal(positions, face);
+    const auto length = glm::length(normal);
+    face_normals.push_back(length > 0.0f ? normal / length : normal);
+  }
+
+  for (auto i = 0; std::cmp_less(i, faces_.size()); ++i) {
+    if (face_creators_[i] != -1) continue;
+    for (const auto vertex_id : faces_[i]) {
+      auto& vertex_node = vertices_[vertex_id];
+      vertex_node.normal = normals[vertex_id];
+      vertex_node.cone_angle = std::max(vertex_node.cone_angle, GetAngle(vertex_node.normal, face_normals[i]));
+    }
+  }
+
+  // propagate bounding spheres and normal cones up the vertex hierarchy in the order vertices were created
+  for (const auto& [collapsed_vertices, vertex_id, removed_faces, added_faces, applied] : vertex_splits_) {
+    auto& vertex_node = vertices_[vertex_id];
+    vertex_node.normal = normals[vertex_id];
+
+    for (const auto face_id : added_faces) {
+      vertex_node.cone_angle = std::max(vertex_node.cone_angle, GetAngle(vertex_node.normal, face_normals[face_id]));
+    }
+    for (const auto child_id : collapsed_vertices) {
+      const auto& child_node = vertices_[child_id];
+      const auto child_distance = glm::distance(positions[vertex_id], positions[child_id]);
+      const auto child_angle = GetAngle(vertex_node.normal, child_node.normal) + child_node.cone_angle;
+      vertex_node.radius = std::max(vertex_node.radius, child_distance + child_node.radius);
+      vertex_node.cone_angle = std::min(std::max(vertex_node.cone_angle, child_angle), std::numbers::pi_v<float>);
+    }
+  }
+
+  // initialize active vertices and faces from the current level of detail of the progressive mesh
+  active_vertex_positions_.resize(vertices_.size(), -1);
+  for (auto i = 0; std::cmp_less(i, vertices_.size()); ++i) {
+    const auto& [vertex_split, parent, radius, normal, cone_angle] = vertices_[i];
+    if ((vertex_split == -1 || vertex_splits_[vertex_split].applied)
+        && (parent == -1 || !vertex_splits_[parent].applied)) {
+      ActivateVertex(i);
+    }
+  }
+
+  face_slots_.resize(faces_.size(), -1);
+  for (const auto& face : progressive_mesh.faces()) {
+    AddFace(face_ids.at(face));
+  }
+  UploadIndices();
+}
+
+void ViewDependentMesh::Update(const glm::mat4& model_view_transform,
+                               const glm::mat4& projection_transform,
+                               const float viewport_height) {
+  View view{.eye = glm::inverse(model_view_transform) * glm::vec4{0.0f, 0.0f, 0.0f, 1.0f},
+            .pixel_scale = 0.5f * viewport_height * projection_transform[1][1]};
+
+  // extract view frustum planes in model space from the model-view-projection transform
+  const auto clip_transform = projection_transform * model_view_transform;
+  const auto w = glm::row(clip_transform, 3);
+  for (auto i = 0; i < 3; ++i) {
+    const auto row = glm::row(clip_transform, i);
+    view.frustum_planes[2 * i] = w + row;
+    view.frustum_planes[2 * i + 1] = w - row;
+  }
+  for (auto& plane : view.frustum_planes) {
+    plane /= glm::length(glm::vec3{plane});
+  }
+
+  // evaluate active vertices in round-robin order to bound the amount of work performed each frame
+  operation_count_ = 0;
+  for (std::size_t i = 0; i < options_.max_vertex_visits && operation_count_ < options_.max_operations; ++i) {
+    if (active_vertices_.empty()) break;
+    if (next_active_vertex_ >= active_vertices_.size()) next_active_vertex_ = 0;
+
+    const auto vertex_id = active_vertices_[next_active_vertex_++];
+    if (const auto& [vertex_split, parent, radius, normal, cone_angle] = vertices_[vertex_id];
+        vertex_split != -1 && ShouldRefine(vertex_id, view)) {
+      Split(vertex_split);
+    } else if (parent != -1 && !ShouldRefine(vertex_splits_[parent].vertex, view)) {
+      Collapse(parent, view);
+    }
+  }
+
+  UploadIndices();
+}
+
+bool ViewDependentMesh::ShouldRefine(const int vertex_id, const View& view) const {
+  const auto& position = mesh_.positions()[vertex_id];
+  const auto& [vertex_split, parent, radius, normal, cone_angle] = vertices_[vertex_id];
+
+  // coarsen regions outside the view frustum
+  for (const auto& plane : view.frustum_planes) {
+    if (glm::dot(glm::vec3{plane}, position) + plane.w < -radius) return false;
+  }
+
+  const auto view_direction = position - view.eye;
+  const auto distance = glm::length(view_direction);
+  if (distance <= radius) return true;
+
+  // use the normal cone to determine if the region faces away from the camera or lies near the silhouette
+  auto tolerance = options_.screen_space_tolerance;
+  if (const auto angle = cone_angle + std::asin(radius / distance); angle < std::numbers::pi_v<float> / 2.0f) {
+    const auto cos_view_angle = glm::dot(normal, view_direction / distance);
+    const auto sin_angle = std::sin(angle);
+    if (cos_view_angle > sin_angle) return false;
+    if (std::abs(cos_view_angle) <= sin_angle) tolerance = options_.silhouette_tolerance;
+  } else {
+    tolerance = options_.silhouette_tolerance;
+  }
+
+  return radius / distance * view.pixel_scale > tolerance;
+}
+
+bool ViewDependentMesh::Split(const int vertex_split_index) {
+  auto& vertex_split = vertex_splits_[vertex_split_index];
+  if (!vertex_split.applied) return true;
+
+  // faces added by the edge contraction must be active which may require splitting vertices created later
+  for (const auto face_id : vertex_split.added_faces) {
+    if (const auto remover = face_removers_[face_id]; remover != -1 && vertex_splits_[remover].applied) {
+      if (!Split(remover)) return false;
+    }
+  }
+  if (operation_count_ >= options_.max_operations) return false;
+  ++operation_count_;
+
+  for (const auto face_id : vertex_split.added_faces) RemoveFace(face_id);
+  for (const auto face_id : vertex_split.removed_faces) AddFace(face_id);
+
+  DeactivateVertex(vertex_split.vertex);
+  for (const auto vertex_id : vertex_split.collapsed_vertices) ActivateVertex(vertex_id);
+
+  vertex_split.applied = false;
+  return true;
+}
+
+bool ViewDependentMesh::Collapse(const int vertex_split_index, const View& view) {
+  auto& vertex_split = vertex_splits_[vertex_split_index];
+  if (vertex_split.applied) return true;
+
+  // collapsed vertices and faces removed by the edge contraction must be active which may require contracting edges
+  // recorded earlier provided the vertices they create are also coarse enough for the current view
+  const auto collapse_dependency = [&](const int dependency) {
+    return dependency != -1 && !ShouldRefine(vertex_splits_[dependency].vertex, view) && Collapse(dependency, view);
+  };
+  for (const auto vertex_id : vertex_split.collapsed_vertices) {
+    if (active_vertex_positions_[vertex_id] == -1 && !collapse_dependency(vertices_[vertex_id].vertex_split)) {
+      return false;
+    }
+  }
+  for (const auto face_id : vertex_split.removed_faces) {
+    if (face_slots_[face_id] == -1 && !collapse_dependency(face_creators_[face_id])) return false;
+  }
+  if (operation_count_ >= options_.max_operations) return false;
+  ++operation_count_;
+
+  for (const auto face_id : vertex_split.removed_faces) RemoveFace(face_id);
+  for (const auto face_id : vertex_split.added_faces) AddFace(face_id);
+
+  for (const auto vertex_id : vertex_split.collapsed_vertices) DeactivateVertex(vertex_id);
+  ActivateVertex(vertex_split.vertex);
+
+  vertex_split.applied = true;
+  return true;
+}
+
+void ViewDependentMesh::ActivateVertex(const int vertex_id) {
+  assert(active_vertex_positions_[vertex_id] == -1);
+  active_vertex_positions_[vertex_id] = static_cast<int>(active_vertices_.size());
+  active_vertices_.push_back(vertex_id);
+}
+
+void ViewDependentMesh::DeactivateVertex(const int vertex_id) {
+  const auto position = active_vertex_positions_[vertex_id];
+  assert(position != -1);
+
+  const auto last_vertex_id = active_vertices_.back();
+  active_vertices_[position] = last_vertex_id;
+  active_vertex_positions_[last_vertex_id] = position;
+  active_vertices_.pop_back();
+  active_vertex_positions_[vertex_id] = -1;
+}
+
+void ViewDependentMesh::AddFace(const int face_id) {
+  assert(face_slots_[face_id] == -1);
+  const auto slot = slot_faces_.size();
+  face_slots_[face_id] = static_cast<int>(slot);
+  slot_faces_.push_back(face_id);
+  for (const auto vertex_id : faces_[face_id]) indices_.push_back(static_cast<std::uint32_t>(vertex_id));
+
+  dirty_begin_ = std::min(dirty_begin_, slot);
+  dirty_end_ = std::max(dirty_end_, slot + 1);
+}
+
+void ViewDependentMesh::RemoveFace(const int face_id) {
+  const auto slot = static_cast<std::size_t>(face_slots_[face_id]);
+  assert(face_slots_[face_id] != -1);
+
+  // keep active faces contiguous by moving the last face into the vacated slot
+  if (const auto last_slot = slot_faces_.size() - 1; slot != last_slot) {
+    const auto last_face_id = slot_faces_[last_slot];
+    slot_faces_[slot] = last_face_id;
+    face_slots_[last_face_id] = static_cast<int>(slot);
+    std::copy_n(indices_.begin() + static_cast<std::ptrdiff_t>(3 * last_slot), 3,
+                indices_.begin() + static_cast<std::ptrdiff_t>(3 * slot));
+    dirty_begin_ = std::min(dirty_begin_, slot);
+    dirty_end_ = std::max(dirty_end_, slot + 1);
+  }
+
+  slot_faces_.pop_back();
+  indices_.resize(indices_.size() - 3);
+  face_slots_[face_id] = -1;
+}
+
+void ViewDependentMesh::UploadIndices() {
+  mesh_.ResizeIndices(indices_.size());
+
+  // only stream the range of indices changed since the last upload
+  if (dirty_end_ = std::min(dirty_end_, slot_faces_.size()); dirty_begin_ < dirty_end_) {
+    const auto offset = 3 * dirty_begin_;
+    mesh_.UpdateIndices(offset, std::span{indices_}.subspan(offset, 3 * (dirty_end_ - dirty_begin_)));
+  }
+
+  dirty_begin_ = std::numeric_limits<std::size_t>::max();
+  dirty_end_ = 0;
+}
+
+}  // namespace gfx
@@ -0,0 +1,119 @@
+#ifndef GRAPHICS_VIEW_DEPENDENT_MESH_H_
+#define GRAPHICS_VIEW_DEPENDENT_MESH_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+#include "graphics/mesh.h"
+
+namespace gfx {
+class ProgressiveMesh;
+
+/** @brief Options that control how a view-dependent mesh is refined each frame. */
+struct RefinementOptions {
+  /** @brief The maximum projected size in pixels of a vertex's bounding sphere before it is refined. */
+  float screen_space_tolerance = 2.0f;
+
+  /** @brief The tolerance used instead of @c screen_space_tolerance for vertices near the mesh silhouette. */
+  float silhouette_tolerance = 0.5f;
+
+  /** @brief The maximum number of active vertices evaluated per frame. */
+  std::size_t max_vertex_visits = 8192;
+
+  /** @brief The maximum number of vertex splits and edge contractions performed per frame. */
+  std::size_t max_operations = 1024;
+};
+
+/**
+ * @brief A renderable mesh whose level of detail is selectively refined each frame based on the camera position,
+ *        view frustum, and mesh silhouette.
+ * @details Each recorded edge contraction in a progressive mesh is a node in a vertex hierarchy. A recorded edge
+ *          contraction may only be replayed when every face it removes is active and may only be undone as a vertex
+ *          split when every face it adds is active. These dependencies are resolved on demand by forcing additional
+ *          vertex splits or edge contractions and guarantee the mesh remains consistent regardless of the order in
+ *          which regions are refined. Faces are stored in a compact element buffer and only the range of indices
+ *          changed during a frame is streamed to the GPU.
+ * @see "View-Dependent Refinement of Progressive Meshes" by Hugues Hoppe (SIGGRAPH 1997).
+ */
+class ViewDependentMesh {
+public:
+  /**
+   * @brief Creates a view-dependent mesh.
+   * @param progressive_mesh The progressive mesh containing recorded edge contractions. The current level of detail
+   *                         of the progressive mesh is used as the initial level of detail.
+   * @param options Options that control how the mesh is refined each frame.
+   */
+  explicit ViewDependentMesh(const ProgressiveMesh& progressive_mesh, const RefinementOptions& options = {});
+
+  /** @brief Gets the renderable mesh for the current level of detail. */
+  [[nodiscard]] const Mesh& mesh() const noexcept { return mesh_; }
+
+  /** @brief Gets the number of triangles in the current level of detail. */
+  [[nodiscard]] std::size_t face_count() const noexcept { return slot_faces_.size(); }
+
+  /**
+   * @brief Refines or coarsens the mesh for the current view.
+   * @param model_view_transform The transform from model space to camera space.
+   * @param projection_transform The transform from camera space to clip space.
+   * @param viewport_height The height of the viewport in pixels.
+   */
+  void Update(const glm::mat4& model_view_transform, const glm::mat4& projection_transform, float viewport_height);
+
+  /** @brief Renders the mesh to the current render target. */
+  void Render() const noexcept { mesh_.Render(); }
+
+private:
+  struct VertexNode {
+    int vertex_split = -1;  // the recorded edge contraction that created this vertex
+    int parent = -1;        // the recorded edge contraction that collapses this vertex
+    float radius = 0.0f;    // the radius of a sphere bounding all full resolution vertices collapsed into this vertex
+    glm::vec3 normal{0.0f};
+    float cone_angle = 0.0f;  // the maximum angle between the vertex normal and normals of faces it represents
+  };
+
+  struct VertexSplitNode {
+    std::array<int, 2> collapsed_vertices{};
+    int vertex = 0;
+    std::vector<int> removed_faces;
+    std::vector<int> added_faces;
+    bool applied = false;
+  };
+
+  struct View {
+    glm::vec3 eye{0.0f};
+    std::array<glm::vec4, 6> frustum_planes{};
+    float pixel_scale = 0.0f;
+  };
+
+  [[nodiscard]] bool ShouldRefine(int vertex_id, const View& view) const;
+  bool Split(int vertex_split_index);
+  bool Collapse(int vertex_split_index, const View& view);
+  void ActivateVertex(int vertex_id);
+  void DeactivateVertex(int vertex_id);
+  void AddFace(int face_id);
+  void RemoveFace(int face_id);
+  void UploadIndices();
+
+  RefinementOptions options_;
+  Mesh mesh_;
+  std::vector<std::array<int, 3>> faces_;
+  std::vector<int> face_creators_, face_removers_;
+  std::vector<VertexNode> vertices_;
+  std::vector<VertexSplitNode> vertex_splits_;
+  std::vector<int> active_vertices_, active_vertex_positions_;
+  std::vector<int> face_slots_, slot_faces_;
+  std::vector<std::uint32_t> indices_;
+  std::size_t next_active_vertex_ = 0, operation_count_ = 0;
+  std::size_t dirty_begin_ = std::numeric_limits<std::size_t>::max(), dirty_end_ = 0;
+};
+
+}  // namespace gfx
+
+#endif  // GRAPHICS_VIEW_DEPENDENT_MESH_H_
@@ -0,0 +1,589 @@
+#include "io/batch_io.h"
+
+#include <exception>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/parallel_for.h"
+#include "io/mapped_file.h"
+
+#ifdef __linux__
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <semaphore>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace gfx {
+
+namespace {
+
+/** @brief Verifies that batch I/O options are valid. */
+void ValidateOptions(const BatchIoOptions& options) {
+  if (options.queue_depth == 0) throw std::invalid_argument{"Invalid batch I/O queue depth: 0"};
+}
+
+#ifdef __linux__
+
+/** @brief The maximum number of submission queue entries requested for an io_uring instance. */
+constexpr std::size_t kMaxRingEntries = 4096;
+
+/** @brief The maximum number of bytes Linux transfers in a single read or write. */
+constexpr std::size_t kMaxTransferSize = 0x7ffff000;
+
+/**
+ * @brief A minimal io_uring instance accessed through system calls so that no additional library is required.
+ * @details Only the thread that owns the instance submits operations and reaps their completions, so the shared
+ *          ring indices only need to be synchronized with the kernel.
+ * @see https://kernel.dk/io_uring.pdf
+ */
+class IoUring {
+public:
+  /**
+   * @brief Creates an io_uring instance.
+   * @param entries The minimum number of operations that can be in flight at once.
+   * @throw std::runtime_error Thrown if the kernel does not support io_uring or the rings cannot be mapped.
+   */
+  explicit IoUring(unsigned entries);
+
+  IoUring(const IoUring&) = delete;
+  IoUring& operator=(const IoUring&) = delete;
+
+  ~IoUring() noexcept { Release(); }
+
+  /** @brief Gets the maximum number of operations that can be queued for submission at once. */
+  [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+  /**
+   * @brief Queues a vectored read or write for submission.
+   * @param opcode The operation to perform which is either @c IORING_OP_READV or @c IORING_OP_WRITEV.
+   * @param file_descriptor The file to read or write.
+   * @param io_vector The buffer to transfer which must remain valid until the operation completes.
+   * @param offset The offset in the file to transfer the buffer at.
+   * @param user_data A value returned with the completion of the operation.
+   */
+  void Prepare(std::uint8_t opcode,
+               int file_descriptor,
+               const iovec& io_vector,
+               std::uint64_t offset,
+               std::uint64_t user_data) noexcept;
+
+  /**
+   * @brief Submits every queued operation and waits for at least one operation to complete.
+   * @throw std::runtime_error Thrown if operations cannot be submitted.
+   */
+  void SubmitAndWait();
+
+  /**
+   * @brief Reaps every available completion.
+   * @param on_complete Invoked with the user data and result of each completed operation.
+   */
+  template <typename F>
+  void ForEachCompletion(const F& on_complete) noexcept {
+    auto head = *cq_head_;  // only the owning thread advances the head
+    const auto tail = std::atomic_ref{*cq_tail_}.load(std::memory_order_acquire);
+    for (; head != tail; ++head) {
+      const auto& completion = cqes_[head & *cq_mask_];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      --submitted_count_;
+      on_complete(completion.user_data, completion.res);
+    }
+    std::atomic_ref{*cq_head_}.store(head, std::memory_order_release);
+  }
+
+  /**
+   * @brief Discards queued operations and waits for every submitted operation to complete without reporting it.
+   * @details This must be called before releasing the buffers of operations that may still be in flight (e.g., when
+   *          an exception is thrown) since the kernel continues to access them until each operation completes. The
+   *          program is terminated if the kernel cannot be waited on because the buffers can then never be released.
+   */
+  void Drain() noexcept;
+
+private:
+  void Release() noexcept;
+
+  int ring_file_descriptor_ = -1;
+  std::size_t capacity_ = 0;
+  unsigned pending_count_ = 0;
+  std::size_t submitted_count_ = 0;
+
+  void* sq_ring_ = MAP_FAILED;
+  std::size_t sq_ring_size_ = 0;
+  void* cq_ring_ = MAP_FAILED;
+  std::size_t cq_ring_size_ = 0;
+  io_uring_sqe* sqes_ = nullptr;
+  std::size_t sqes_size_ = 0;
+
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_mask_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned* cq_mask_ = nullptr;
+  io_uring_cqe* cqes_ = nullptr;
+};
+
+/** @brief Gets a pointer to a ring field at a byte offset given by the kernel. */
+template <typename T>
+T* GetRingField(void* const ring, const std::uint32_t offset) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+
+IoUring::IoUring(const unsigned entries) {
+  io_uring_params params{};
+  ring_file_descriptor_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+  if (ring_file_descriptor_ == -1) {
+    throw std::runtime_error{std::format("Unable to create an io_uring instance: {}", std::strerror(errno))};
+  }
+  capacity_ = params.sq_entries;
+
+  // kernels with a single mapping for both rings require it to be large enough for either ring
+  sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  const auto is_single_mapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (is_single_mapping) sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+
+  const auto map_ring = [this](const std::size_t size, const std::uint64_t offset) {
+    return mmap(nullptr,
+                size,
+                PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE,
+                ring_file_descriptor_,
+                static_cast<off_t>(offset));
+  };
+  sq_ring_ = map_ring(sq_ring_size_, IORING_OFF_SQ_RING);
+  if (sq_ring_ != MAP_FAILED) cq_ring_ = is_single_mapping ? sq_ring_ : map_ring(cq_ring_size_, IORING_OFF_CQ_RING);
+  if (cq_ring_ != MAP_FAILED) {
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    if (auto* const sqes = map_ring(sqes_size_, IORING_OFF_SQES); sqes != MAP_FAILED) {
+      sqes_ = static_cast<io_uring_sqe*>(sqes);
+    }
+  }
+  if (sqes_ == nullptr) {
+    const auto error = errno;
+    Release();
+    throw std::runtime_error{std::format("Unable to map io_uring queues: {}", std::strerror(error))};
+  }
+
+  sq_tail_ = GetRingField<unsigned>(sq_ring_, params.sq_off.tail);
+  sq_mask_ = GetRingField<unsigned>(sq_ring_, params.sq_off.ring_mask);
+  sq_array_ = GetRingField<unsigned>(sq_ring_, params.sq_off.array);
+  cq_head_ = GetRingField<unsigned>(cq_ring_, params.cq_off.head);
+  cq_tail_ = GetRingField<unsigned>(cq_ring_, params.cq_off.tail);
+  cq_mask_ = GetRingField<unsigned>(cq_ring_, params.cq_off.ring_mask);
+  cqes_ = GetRingField<io_uring_cqe>(cq_ring_, params.cq_off.cqes);
+}
+
+void IoUring::Prepare(const std::uint8_t opcode,
+                      const int file_descriptor,
+                      const iovec& io_vector,
+                      const std::uint64_t offset,
+                      const std::uint64_t user_data) noexcept {
+  const auto tail = *sq_tail_;  // only the owning thread advances the tail
+  const auto index = tail & *sq_mask_;
+
+  auto& sqe = sqes_[index];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  sqe = io_uring_sqe{};
+  sqe.opcode = opcode;
+  sqe.fd = file_descriptor;
+  sqe.off = offset;
+  sqe.addr = reinterpret_cast<std::uint64_t>(&io_vector);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  sqe.len = 1;
+  sqe.user_data = user_data;
+
+  sq_array_[index] = index;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  std::atomic_ref{*sq_tail_}.store(tail + 1, std::memory_order_release);
+  ++pending_count_;
+}
+
+void IoUring::SubmitAndWait() {
+  for (;;) {
+    // operations the kernel did not accept remain queued and are submitted by the next call
+    if (const auto submitted_count = syscall(
+            __NR_io_uring_enter, ring_file_descriptor_, pending_count_, 1u, IORING_ENTER_GETEVENTS, nullptr, 0);
+        submitted_count >= 0) {
+      pending_count_ -= static_cast<unsigned>(submitted_count);
+      submitted_count_ += static_cast<std::size_t>(submitted_count);
+      return;
+    }
+    if (errno != EINTR) {
+      throw std::runtime_error{std::format("Unable to submit io_uring operations: {}", std::strerror(errno))};
+    }
+  }
+}
+
+void IoUring::Drain() noexcept {
+  // the kernel only reads submission queue entries when they are submitted so queued entries can be withdrawn
+  std::atomic_ref{*sq_tail_}.store(*sq_tail_ - pending_count_, std::memory_order_release);
+  pending_count_ = 0;
+
+  for (;;) {
+    ForEachCompletion([](std::uint64_t, int) {});
+    if (submitted_count_ == 0) return;
+    if (syscall(__NR_io_uring_enter, ring_file_descriptor_, 0u, 1u, IORING_ENTER_GETEVENTS, nullptr, 0) == -1
+        && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+      std::terminate();  // the kernel may still write to buffers that are about to be released
+    }
+  }
+}
+
+void IoUring::Release() noexcept {
+  if (sqes_ != nullptr) munmap(sqes_, sqes_size_);
+  if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_) munmap(cq_ring_, cq_ring_size_);
+  if (sq_ring_ != MAP_FAILED) munmap(sq_ring_, sq_ring_size_);
+  if (ring_file_descriptor_ != -1) close(ring_file_descriptor_);
+  sqes_ = nullptr;
+  sq_ring_ = cq_ring_ = MAP_FAILED;
+  ring_file_descriptor_ = -1;
+}
+
+/**
+ * @brief Creates an io_uring instance for a batch of files.
+ * @param queue_depth The maximum number of files in flight at once.
+ * @return An io_uring instance or @c nullptr if io_uring is not supported in which case the batch should fall back to
+ *         worker threads.
+ */
+std::unique_ptr<IoUring> TryCreateIoUring(const std::size_t queue_depth) {
+  try {
+    return std::make_unique<IoUring>(static_cast<unsigned>(std::min(queue_depth, kMaxRingEntries)));
+  } catch (const std::runtime_error&) {
+    return nullptr;
+  }
+}
+
+/** @brief A file being read or written through io_uring. */
+struct FileTransfer {
+  std::size_t file_index = 0;
+  int file_descriptor = -1;
+  char* data = nullptr;
+  std::size_t size = 0;
+  std::size_t offset = 0;
+  iovec io_vector{};
+  std::unique_ptr<char[]> buffer;  // NOLINT(cppcoreguidelines-avoid-c-arrays): owns the data of a file being read
+};
+
+/** @brief Closes the file of a transfer if it is open. */
+void CloseFile(FileTransfer& file_transfer) noexcept {
+  if (file_transfer.file_descriptor != -1) close(file_transfer.file_descriptor);
+  file_transfer.file_descriptor = -1;
+}
+
+/**
+ * @brief Transfers a batch of files through io_uring.
+ * @param ring The io_uring instance to submit operations to.
+ * @param opcode The operation to perform which is either @c IORING_OP_READV or @c IORING_OP_WRITEV.
+ * @param filepaths The paths to the files to transfer.
+ * @param buffer_budget Acquired before each file is opened. It is released if the transfer fails, otherwise
+ *                      releasing it is the responsibility of @p finish.
+ * @param exceptions Set to the exception that caused the transfer of a file at the same index to fail.
+ * @param start Invoked with the path to a file and its transfer to open the file and set the data to transfer.
+ * @param finish Invoked with each transfer that completed successfully after its file is closed.
+ */
+template <typename Start, typename Finish>
+void TransferFiles(IoUring& ring,
+                   const std::uint8_t opcode,
+                   const std::span<const std::filesystem::path> filepaths,
+                   std::counting_semaphore<>& buffer_budget,
+                   std::vector<std::exception_ptr>& exceptions,
+                   const Start& start,
+                   const Finish& finish) {
+  std::vector<FileTransfer> file_transfers(ring.capacity());
+  std::vector<std::size_t> free_slots(file_transfers.size());
+  std::iota(free_slots.rbegin(), free_slots.rend(), 0);
+
+  // operations in flight refer to the buffers and io vectors of file transfers so they must complete before an
+  // exception releases them
+  struct DrainGuard {
+    IoUring& ring;
+    ~DrainGuard() noexcept { ring.Drain(); }
+  } drain_guard{ring};
+
+  const auto prepare = [&](const std::size_t slot) {
+    auto& file_transfer = file_transfers[slot];
+    const auto size = std::min(file_transfer.size - file_transfer.offset, kMaxTransferSize);
+    file_transfer.io_vector = iovec{.iov_base = file_transfer.data + file_transfer.offset, .iov_len = size};
+    ring.Prepare(opcode, file_transfer.file_descriptor, file_transfer.io_vector, file_transfer.offset, slot);
+  };
+
+  const auto complete = [&](const std::size_t slot, const int result) {
+    auto& file_transfer = file_transfers[slot];
+    try {
+      if (result < 0 || (result == 0 && file_transfer.offset < file_transfer.size)) {
+        throw std::runtime_error{std::format("Unable to {} {}: {}",
+                                             opcode == IORING_OP_READV ? "read" : "write",
+                                             filepaths[file_transfer.file_index].generic_string(),
+                                             result < 0 ? std::strerror(-result) : "Unexpected end of file")};
+      }
+      const auto file_descriptor = std::exchange(file_transfer.file_descriptor, -1);
+      if (close(file_descriptor) == -1) {
+        throw std::runtime_error{std::format("Unable to close {}: {}",
+                                             filepaths[file_transfer.file_index].generic_string(),
+                                             std::strerror(errno))};
+      }
+      finish(std::move(file_transfer));
+    } catch (...) {
+      exceptions[file_transfer.file_index] = std::current_exception();
+      buffer_budget.release();
+    }
+    CloseFile(file_transfer);
+    file_transfer = FileTransfer{};
+    free_slots.push_back(slot);
+  };
+
+  std::size_t next_file_index = 0;
+  std::size_t active_count = 0;
+  while (next_file_index < filepaths.size() || active_count > 0) {
+    // block for a buffer only when nothing is in flight, otherwise reap completions until one is available
+    while (next_file_index < filepaths.size() && !free_slots.empty()
+           && (active_count == 0 ? (buffer_budget.acquire(), true) : buffer_budget.try_acquire())) {
+      const auto slot = free_slots.back();
+      free_slots.pop_back();
+      auto& file_transfer = file_transfers[slot];
+      file_transfer.file_index = next_file_index++;
+      try {
+        start(filepaths[file_transfer.file_index], file_transfer);
+      } catch (...) {
+        exceptions[file_transfer.file_index] = std::current_exception();
+        buffer_budget.release();
+        CloseFile(file_transfer);
+        file_transfer = FileTransfer{};
+        free_slots.push_back(slot);
+        continue;
+      }
+      if (file_transfer.size == 0) {
+        complete(slot, 0);  // empty files do not require any operations
+      } else {
+        prepare(slot);
+        ++active_count;
+      }
+    }
+    if (active_count == 0) continue;
+
+    ring.SubmitAndWait();
+    ring.ForEachCompletion([&](const std::uint64_t user_data, const int result) {
+      const auto slot = static_cast<std::size_t>(user_data);
+      auto& file_transfer = file_transfers[slot];
+      if (result == -EINTR || result == -EAGAIN) {
+        prepare(slot);
+        return;
+      }
+      if (result > 0) {
+        file_transfer.offset += static_cast<std::size_t>(result);
+        if (file_transfer.offset < file_transfer.size) {  // resubmit the remainder of a short transfer
+          prepare(slot);
+          return;
+        }
+      }
+      --active_count;
+      complete(slot, result);
+    });
+  }
+}
+
+/**
+ * @brief Reads a batch of files through io_uring and passes their contents to worker threads.
+ * @see batch_io::ReadFiles
+ */
+void ReadFilesWithIoUring(IoUring& ring,
+                          const std::span<const std::filesystem::path> filepaths,
+                          const std::function<void(std::size_t, std::string_view)>& on_read,
+                          const std::size_t queue_depth,
+                          const std::size_t thread_count) {
+  std::vector<std::exception_ptr> exceptions(filepaths.size());
+  std::counting_semaphore<> buffer_budget{static_cast<std::ptrdiff_t>(queue_depth)};
+  std::mutex mutex;
+  std::condition_variable read_condition;
+  std::deque<FileTransfer> read_files;
+  auto is_done = false;
+
+  const auto parse = [&] {
+    for (;;) {
+      FileTransfer file_transfer;
+      {
+        std::unique_lock lock{mutex};
+        read_condition.wait(lock, [&] { return !read_files.empty() || is_done; });
+        if (read_files.empty()) return;
+        file_transfer = std::move(read_files.front());
+        read_files.pop_front();
+      }
+      try {
+        on_read(file_transfer.file_index, std::string_view{file_transfer.data, file_transfer.size});
+      } catch (...) {
+        exceptions[file_transfer.file_index] = std::current_exception();
+      }
+      file_transfer.buffer.reset();
+      buffer_budget.release();
+    }
+  };
+
+  {
+    std::vector<std::jthread> workers;
+    const auto worker_count = std::clamp<std::size_t>(thread_count, 1, filepaths.size());
+    workers.reserve(worker_count);
+    for (std::size_t i = 0; i < worker_count; ++i) workers.emplace_back(parse);
+
+    const auto stop_workers = [&] {
+      {
+        const std::scoped_lock lock{mutex};
+        is_done = true;
+      }
+      read_condition.notify_all();
+    };
+    try {
+      TransferFiles(
+          ring,
+          IORING_OP_READV,
+          filepaths,
+          buffer_budget,
+          exceptions,
+          [](const std::filesystem::path& filepath, FileTransfer& file_transfer) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+            file_transfer.file_descriptor = open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+            if (file_transfer.file_descriptor == -1) {
+              throw std::runtime_error{std::format("Unable to open {}", filepath.generic_string())};
+            }
+            struct stat file_status {};
+            if (fstat(file_transfer.file_descriptor, &file_status) == -1) {
+              throw std::runtime_error{std::format("Unable to read the size of {}", filepath.generic_string())};
+            }
+            file_transfer.size = static_cast<std::size_t>(file_status.st_size);
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+            file_transfer.buffer = std::make_unique_for_overwrite<char[]>(file_transfer.size);
+            file_transfer.data = file_transfer.buffer.get();
+          },
+          [&](FileTransfer&& file_transfer) {
+            {
+              const std::scoped_lock lock{mutex};
+              read_files.push_back(std::move(file_transfer));
+            }
+            read_condition.notify_one();
+          });
+    } catch (...) {
+      stop_workers();
+      throw;
+    }
+    stop_workers();
+  }
+
+  for (const auto& exception : exceptions) {
+    if (exception != nullptr) std::rethrow_exception(exception);
+  }
+}
+
+/**
+ * @brief Writes a batch of files through io_uring.
+ * @see batch_io::WriteFiles
+ */
+void WriteFilesWithIoUring(IoUring& ring,
+                           const std::span<const std::filesystem::path> filepaths,
+                           const std::span<const std::string_view> contents,
+                           const std::size_t queue_depth) {
+  std::vector<std::exception_ptr> exceptions(filepaths.size());
+  std::counting_semaphore<> buffer_budget{static_cast<std::ptrdiff_t>(queue_depth)};
+  TransferFiles(
+      ring,
+      IORING_OP_WRITEV,
+      filepaths,
+      buffer_budget,
+      exceptions,
+      [&](const std::filesystem::path& filepath, FileTransfer& file_transfer) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+        file_transfer.file_descriptor = open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (file_transfer.file_descriptor == -1) {
+          throw std::runtime_error{std::format("Unable to open {}", filepath.generic_string())};
+        }
+        const auto file_contents = contents[file_transfer.file_index];
+        // the kernel only reads from the buffer of a write
+        file_transfer.data = const_cast<char*>(file_contents.data());  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+        file_transfer.size = file_contents.size();
+      },
+      [&](FileTransfer&&) { buffer_budget.release(); });
+
+  for (const auto& exception : exceptions) {
+    if (exception != nullptr) std::rethrow_exception(exception);
+  }
+}
+
+#endif
+
+}  // namespace
+
+bool batch_io::IsIoUringSupported() {
+#ifdef __linux__
+  static const auto is_supported = TryCreateIoUring(1) != nullptr;
+  return is_supported;
+#else
+  return false;
+#endif
+}
+
+void batch_io::ReadFiles(const std::span<const std::filesystem::path> filepaths,
+                         const std::function<void(std::size_t, std::string_view)>& on_read,
+                         const BatchIoOptions& options,
+                         const std::size_t thread_count) {
+  ValidateOptions(options);
+  if (filepaths.empty()) return;
+
+#ifdef __linux__
+  if (options.use_io_uring) {
+    if (const auto ring = TryCreateIoUring(options.queue_depth); ring != nullptr) {
+      ReadFilesWithIoUring(*ring, filepaths, on_read, options.queue_depth, thread_count);
+      return;
+    }
+  }
+#endif
+
+  ParallelFor(filepaths.size(), thread_count, [&](const std::size_t i) {
+    const MappedFile mapped_file{filepaths[i]};
+    on_read(i, mapped_file.contents());
+  });
+}
+
+void batch_io::WriteFiles(const std::span<const std::filesystem::path> filepaths,
+                          const std::span<const std::string_view> contents,
+                          const BatchIoOptions& options,
+                          const std::size_t thread_count) {
+  if (filepaths.size() != contents.size()) {
+    throw std::invalid_argument{
+        std::format("Batch contains {} file paths and {} file contents", filepaths.size(), contents.size())};
+  }
+  ValidateOptions(options);
+  if (filepaths.empty()) return;
+
+#ifdef __linux__
+  if (options.use_io_uring) {
+    if (const auto ring = TryCreateIoUring(options.queue_depth); ring != nullptr) {
+      WriteFilesWithIoUring(*ring, filepaths, contents, options.queue_depth);
+      return;
+    }
+  }
+#endif
+
+  ParallelFor(filepaths.size(), thread_count, [&](const std::size_t i) {
+    std::ofstream ofs{filepaths[i], std::ios::binary};
+    if (!ofs.good()) throw std::runtime_error{std::format("Unable to open {}", filepaths[i].generic_string())};
+    ofs.write(contents[i].data(), static_cast<std::streamsize>(contents[i].size()));
+    if (!ofs.flush()) throw std::runtime_error{std::format("Unable to write {}", filepaths[i].generic_string())};
+  });
+}
+
+}  // namespace gfx
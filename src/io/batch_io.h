@@ -0,0 +1,76 @@
+#ifndef IO_BATCH_IO_H_
+#define IO_BATCH_IO_H_
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <string_view>
+#include <thread>
+
+namespace gfx {
+
+/** @brief Options that control how a batch of files is read or written. */
+struct BatchIoOptions {
+  /**
+   * @brief The maximum number of files in flight at once. When reading, this includes files whose contents have been
+   *        read but not yet passed to a parser, which bounds the memory used for buffers.
+   */
+  std::size_t queue_depth = 64;
+
+  /** @brief Indicates if io_uring should be used when the kernel supports it instead of a pool of worker threads. */
+  bool use_io_uring = true;
+};
+
+namespace batch_io {
+
+/**
+ * @brief Determines if io_uring can be used on this system.
+ * @return @c true if the operating system is Linux and the kernel allows an io_uring instance to be created.
+ */
+[[nodiscard]] bool IsIoUringSupported();
+
+/**
+ * @brief Reads the contents of a batch of files and passes each to a function as soon as it has been read.
+ * @details With io_uring, the calling thread opens each file and submits reads for up to @c queue_depth files at once
+ *          so that storage devices with deep command queues stay busy, resubmitting the remainder of short reads.
+ *          Each completed buffer is handed directly to a pool of worker threads which invoke @p on_read while the next
+ *          reads are in flight, and is released once @p on_read returns. Without io_uring, each worker thread maps a
+ *          file into memory and invokes @p on_read with its contents.
+ * @param filepaths The paths to the files to read.
+ * @param on_read Invoked on a worker thread with the index of a file in @p filepaths and its contents which are only
+ *                valid for the duration of the call. Invocations for different files may be concurrent and are not
+ *                ordered.
+ * @param options Options that control how the files are read.
+ * @param thread_count The maximum number of worker threads that invoke @p on_read.
+ * @throw std::invalid_argument Thrown if the queue depth is zero.
+ * @throw std::runtime_error Thrown if a file cannot be opened or read.
+ * @throw Rethrows the exception for the file with the lowest index after every other file has been processed so that
+ *        one failure does not prevent the rest of the batch from being read.
+ */
+void ReadFiles(std::span<const std::filesystem::path> filepaths,
+               const std::function<void(std::size_t, std::string_view)>& on_read,
+               const BatchIoOptions& options = {},
+               std::size_t thread_count = std::thread::hardware_concurrency());
+
+/**
+ * @brief Writes a batch of files, replacing any existing files.
+ * @details With io_uring, the calling thread opens each file and submits writes for up to @c queue_depth files at
+ *          once. Without io_uring, each worker thread writes one file at a time.
+ * @param filepaths The paths to write the files to.
+ * @param contents The contents of each file in @p filepaths.
+ * @param options Options that control how the files are written.
+ * @param thread_count The maximum number of worker threads used to write files without io_uring.
+ * @throw std::invalid_argument Thrown if the number of file paths and contents differ or the queue depth is zero.
+ * @throw std::runtime_error Thrown if a file cannot be opened or written.
+ * @throw Rethrows the exception for the file with the lowest index after every other file has been processed.
+ */
+void WriteFiles(std::span<const std::filesystem::path> filepaths,
+                std::span<const std::string_view> contents,
+                const BatchIoOptions& options = {},
+                std::size_t thread_count = std::thread::hardware_concurrency());
+
+}  // namespace batch_io
+}  // namespace gfx
+
+#endif  // IO_BATCH_IO_H_
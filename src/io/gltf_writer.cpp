@@ -0,0 +1,447 @@
+#include "io/gltf_writer.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include "geometry/mesh_data.h"
+
+namespace gfx {
+
+namespace {
+
+// binary glTF data is little-endian and vertex attributes are copied to the binary chunk in native byte order
+static_assert(std::endian::native == std::endian::little, "Binary glTF files require a little-endian platform");
+
+/** @brief Identifies a file as binary glTF ("glTF" in ASCII). */
+constexpr std::uint32_t kGlbMagic = 0x46546C67;
+
+/** @brief The binary glTF container version. */
+constexpr std::uint32_t kGlbVersion = 2;
+
+/** @brief The chunk type of the JSON document ("JSON" in ASCII). */
+constexpr std::uint32_t kJsonChunkType = 0x4E4F534A;
+
+/** @brief The chunk type of the binary buffer ("BIN\0" in ASCII). */
+constexpr std::uint32_t kBinaryChunkType = 0x004E4942;
+
+/** @brief The alignment of chunks and buffer views which satisfies the alignment of every accessor component type. */
+constexpr std::size_t kAlignment = 4;
+
+/**
+ * @brief The largest 16-bit integer which glTF reserves as the primitive restart value. Vertex indices stored as 16-bit
+ *        integers must be smaller so a mesh may have at most this many vertices to use them.
+ */
+constexpr std::uint32_t kMaxShortIndex = std::numeric_limits<std::uint16_t>::max();
+
+/** @brief The component types of glTF accessors. */
+enum class ComponentType : std::uint16_t {
+  kByte = 5120,
+  kUnsignedByte = 5121,
+  kShort = 5122,
+  kUnsignedShort = 5123,
+  kUnsignedInt = 5125,
+  kFloat = 5126
+};
+
+/** @brief The GPU buffer types glTF buffer views are intended to be bound to. */
+enum class BufferTarget : std::uint16_t { kArrayBuffer = 34962, kElementArrayBuffer = 34963 };
+
+/** @brief A position quantized to normalized 16-bit integers padded to the 4-byte alignment of vertex attributes. */
+using QuantizedPosition = std::array<std::uint16_t, 4>;
+
+/** @brief A normal quantized to normalized 8-bit integers padded to the 4-byte alignment of vertex attributes. */
+using QuantizedNormal = std::array<std::int8_t, 4>;
+
+/** @brief A texture coordinate in [0,1] quantized to normalized 16-bit integers. */
+using QuantizedTexcoord = std::array<std::uint16_t, 2>;
+
+/**
+ * @brief The transform from quantized positions in [0,1] to model space shared by a level of detail chain.
+ * @details Quantized positions are scaled uniformly so that the node transform that dequantizes them does not change
+ *          the direction of normals.
+ */
+struct PositionQuantization {
+  glm::vec3 offset{0.0f};
+  float scale = 1.0f;
+};
+
+/**
+ * @brief Formats a sequence of numbers as a JSON array.
+ * @throw std::invalid_argument Thrown if a value is infinite or NaN which JSON cannot represent.
+ */
+template <typename R>
+std::string ToJsonArray(const R& values) {
+  std::string json{"["};
+  for (auto is_first = true; const auto& value : values) {
+    if constexpr (std::is_floating_point_v<std::remove_cvref_t<decltype(value)>>) {
+      if (!std::isfinite(value)) {
+        throw std::invalid_argument{std::format("Unable to write non-finite value {} to a glTF file", value)};
+      }
+    }
+    if (!std::exchange(is_first, false)) json += ',';
+    json += std::format("{}", value);
+  }
+  return json + ']';
+}
+
+/** @brief Formats a sequence of JSON values as a JSON array. */
+std::string Join(const std::vector<std::string>& values) {
+  std::string json{"["};
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (i > 0) json += ',';
+    json += values[i];
+  }
+  return json + ']';
+}
+
+/**
+ * @brief Formats the "min" and "max" properties of an accessor.
+ * @tparam N The number of components of each value that are not padding.
+ * @param values The accessor values which must not be empty.
+ * @return The component-wise minimum and maximum of @p values as JSON object members.
+ */
+template <std::size_t N, typename T>
+std::string FormatBounds(const std::span<const T> values) {
+  using Component = std::remove_cvref_t<decltype(values[0][0])>;
+  std::array<Component, N> min{};
+  std::array<Component, N> max{};
+  min.fill(std::numeric_limits<Component>::max());
+  max.fill(std::numeric_limits<Component>::lowest());
+
+  for (const auto& value : values) {
+    for (auto i = 0; i < static_cast<int>(N); ++i) {
+      min[i] = std::min(min[i], value[i]);
+      max[i] = std::max(max[i], value[i]);
+    }
+  }
+
+  return std::format(R"("min":{},"max":{})", ToJsonArray(min), ToJsonArray(max));
+}
+
+/**
+ * @brief Gets the quantization of a level of detail chain from the bounding cube of every level of detail.
+ * @param meshes The levels of detail which share a quantization so that switching between them does not shift their
+ *               positions.
+ * @return The offset and scale that map quantized positions in [0,1] to model space.
+ */
+PositionQuantization GetPositionQuantization(const std::span<const MeshData* const> meshes) {
+  glm::vec3 min{std::numeric_limits<float>::max()};
+  glm::vec3 max{std::numeric_limits<float>::lowest()};
+  for (const auto* const mesh : meshes) {
+    for (const auto& position : mesh->positions()) {
+      min = glm::min(min, position);
+      max = glm::max(max, position);
+    }
+  }
+
+  const auto extent = max - min;
+  const auto scale = std::max({extent.x, extent.y, extent.z});
+  return PositionQuantization{.offset = min, .scale = scale > 0.0f ? scale : 1.0f};
+}
+
+/** @brief Quantizes a value in [0,1] to a normalized unsigned 16-bit integer. */
+std::uint16_t QuantizeUnorm16(const float value) {
+  static constexpr auto kMax = static_cast<float>(std::numeric_limits<std::uint16_t>::max());
+  return static_cast<std::uint16_t>(std::round(std::clamp(value, 0.0f, 1.0f) * kMax));
+}
+
+/** @brief Quantizes a value in [-1,1] to a normalized signed 8-bit integer. */
+std::int8_t QuantizeSnorm8(const float value) {
+  static constexpr auto kMax = static_cast<float>(std::numeric_limits<std::int8_t>::max());
+  return static_cast<std::int8_t>(std::round(std::clamp(value, -1.0f, 1.0f) * kMax));
+}
+
+/** @brief Accumulates the JSON document and binary buffer of a .glb file. */
+class GlbBuilder {
+public:
+  explicit GlbBuilder(const GltfOptions& options) noexcept : options_{options} {}
+
+  /**
+   * @brief Adds the nodes of a level of detail chain to the scene.
+   * @param meshes The levels of detail ordered from the finest to the coarsest. A chain of a single mesh is written as
+   *               a plain node.
+   */
+  void AddLodChain(const std::span<const MeshData* const> meshes) {
+    std::optional<PositionQuantization> position_quantization;
+    if (options_.quantize) position_quantization = GetPositionQuantization(meshes);
+
+    const auto base_node = static_cast<int>(nodes_.size());
+    scene_nodes_.push_back(base_node);
+
+    for (std::size_t i = 0; i < meshes.size(); ++i) {
+      const auto& mesh = *meshes[i];
+      auto node = std::format(R"({{"mesh":{})", AddMesh(mesh, position_quantization));
+
+      auto transform = mesh.model_transform();
+      if (position_quantization.has_value()) {
+        glm::mat4 dequantization{position_quantization->scale};
+        dequantization[3] = glm::vec4{position_quantization->offset, 1.0f};
+        transform = transform * dequantization;
+      }
+      if (transform != glm::mat4{1.0f}) {
+        std::vector<float> matrix;  // glTF matrices are column-major like glm
+        for (glm::length_t j = 0; j < 4; ++j) {
+          for (glm::length_t k = 0; k < 4; ++k) matrix.push_back(transform[j][k]);
+        }
+        node += std::format(R"(,"matrix":{})", ToJsonArray(matrix));
+      }
+
+      if (i == 0 && meshes.size() > 1) {
+        std::vector<int> lod_nodes(meshes.size() - 1);
+        for (std::size_t j = 0; j < lod_nodes.size(); ++j) lod_nodes[j] = base_node + static_cast<int>(j) + 1;
+        node += std::format(R"(,"extensions":{{"MSFT_lod":{{"ids":{}}}}})", ToJsonArray(lod_nodes));
+        has_lods_ = true;
+      }
+
+      nodes_.push_back(node + '}');
+    }
+  }
+
+  /**
+   * @brief Writes the .glb file.
+   * @param filepath The path to write the .glb file to.
+   * @throw std::runtime_error Thrown if the file cannot be written.
+   */
+  void Write(const std::filesystem::path& filepath) const {
+    std::vector<std::string> extensions_used;
+    if (has_lods_) extensions_used.emplace_back(R"("MSFT_lod")");
+    if (options_.quantize) extensions_used.emplace_back(R"("KHR_mesh_quantization")");
+
+    auto json = std::string{R"({"asset":{"version":"2.0","generator":"mesh_simplification"})"};
+    if (!extensions_used.empty()) json += std::format(R"(,"extensionsUsed":{})", Join(extensions_used));
+    if (options_.quantize) json += R"(,"extensionsRequired":["KHR_mesh_quantization"])";
+    json += std::format(R"(,"scene":0,"scenes":[{{"nodes":{}}}])", ToJsonArray(scene_nodes_));
+    json += std::format(R"(,"nodes":{},"meshes":{})", Join(nodes_), Join(meshes_));
+    json += std::format(R"(,"accessors":{},"bufferViews":{})", Join(accessors_), Join(buffer_views_));
+    json += std::format(R"(,"buffers":[{{"byteLength":{}}}]}})", buffer_.size());
+    json.resize(AlignUp(json.size()), ' ');  // JSON chunks are padded with spaces
+
+    std::vector<std::byte> buffer = buffer_;
+    buffer.resize(AlignUp(buffer.size()), std::byte{0});
+
+    static constexpr std::size_t kHeaderSize = 3 * sizeof(std::uint32_t);
+    static constexpr std::size_t kChunkHeaderSize = 2 * sizeof(std::uint32_t);
+    const auto file_size = kHeaderSize + kChunkHeaderSize + json.size() + kChunkHeaderSize + buffer.size();
+    if (file_size > std::numeric_limits<std::uint32_t>::max()) {
+      throw std::runtime_error{std::format("Unable to write {}: binary glTF files are limited to 4 GiB",
+                                           filepath.string())};
+    }
+
+    const std::array header{kGlbMagic,
+                            kGlbVersion,
+                            static_cast<std::uint32_t>(file_size),
+                            static_cast<std::uint32_t>(json.size()),
+                            kJsonChunkType};
+    const std::array binary_chunk_header{static_cast<std::uint32_t>(buffer.size()), kBinaryChunkType};
+
+    std::ofstream ofs{filepath, std::ios::binary};
+    if (!ofs.good()) throw std::runtime_error{std::format("Unable to open {}", filepath.string())};
+    WriteBytes(ofs, std::as_bytes(std::span{header}));
+    WriteBytes(ofs, std::as_bytes(std::span{json}));
+    WriteBytes(ofs, std::as_bytes(std::span{binary_chunk_header}));
+    WriteBytes(ofs, buffer);
+    if (!ofs.flush()) throw std::runtime_error{std::format("Unable to write {}", filepath.string())};
+  }
+
+private:
+  [[nodiscard]] static std::size_t AlignUp(const std::size_t size) noexcept {
+    return (size + kAlignment - 1) / kAlignment * kAlignment;
+  }
+
+  static void WriteBytes(std::ofstream& ofs, const std::span<const std::byte> bytes) {
+    ofs.write(reinterpret_cast<const char*>(bytes.data()),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              static_cast<std::streamsize>(bytes.size()));
+  }
+
+  /**
+   * @brief Adds a mesh with a single triangle primitive.
+   * @param mesh The mesh to add.
+   * @param position_quantization The quantization of the mesh positions if vertex attributes are quantized.
+   * @return The index of the glTF mesh.
+   */
+  int AddMesh(const MeshData& mesh, const std::optional<PositionQuantization>& position_quantization) {
+    const auto& positions = mesh.positions();
+    const auto& normals = mesh.normals();
+    const auto& texcoords = mesh.texcoords();
+    const auto& indices = mesh.indices();
+    if (positions.empty()) throw std::invalid_argument{"Unable to write a mesh without vertices to a glTF file"};
+
+    std::string attributes;
+    if (position_quantization.has_value()) {
+      const auto& [offset, scale] = *position_quantization;
+      std::vector<QuantizedPosition> quantized_positions;
+      quantized_positions.reserve(positions.size());
+      for (const auto& position : positions) {
+        const auto normalized_position = (position - offset) / scale;
+        quantized_positions.push_back(QuantizedPosition{QuantizeUnorm16(normalized_position.x),
+                                                        QuantizeUnorm16(normalized_position.y),
+                                                        QuantizeUnorm16(normalized_position.z),
+                                                        0});
+      }
+      attributes += std::format(
+          R"("POSITION":{})",
+          AddAccessor<QuantizedPosition>(quantized_positions,
+                                         BufferTarget::kArrayBuffer,
+                                         ComponentType::kUnsignedShort,
+                                         true,
+                                         "VEC3",
+                                         FormatBounds<3, QuantizedPosition>(quantized_positions)));
+    } else {
+      attributes += std::format(R"("POSITION":{})",
+                                AddAccessor<glm::vec3>(positions,
+                                                       BufferTarget::kArrayBuffer,
+                                                       ComponentType::kFloat,
+                                                       false,
+                                                       "VEC3",
+                                                       FormatBounds<3, glm::vec3>(positions)));
+    }
+
+    if (!normals.empty() && options_.quantize) {
+      std::vector<QuantizedNormal> quantized_normals;
+      quantized_normals.reserve(normals.size());
+      for (const auto& normal : normals) {
+        quantized_normals.push_back(
+            QuantizedNormal{QuantizeSnorm8(normal.x), QuantizeSnorm8(normal.y), QuantizeSnorm8(normal.z), 0});
+      }
+      attributes += std::format(
+          R"(,"NORMAL":{})",
+          AddAccessor<QuantizedNormal>(
+              quantized_normals, BufferTarget::kArrayBuffer, ComponentType::kByte, true, "VEC3", {}));
+    } else if (!normals.empty()) {
+      attributes += std::format(
+          R"(,"NORMAL":{})",
+          AddAccessor<glm::vec3>(normals, BufferTarget::kArrayBuffer, ComponentType::kFloat, false, "VEC3", {}));
+    }
+
+    const auto is_unit_texcoord = [](const glm::vec2& texcoord) {
+      return texcoord.x >= 0.0f && texcoord.x <= 1.0f && texcoord.y >= 0.0f && texcoord.y <= 1.0f;
+    };
+    if (!texcoords.empty() && options_.quantize && std::ranges::all_of(texcoords, is_unit_texcoord)) {
+      std::vector<QuantizedTexcoord> quantized_texcoords;
+      quantized_texcoords.reserve(texcoords.size());
+      for (const auto& texcoord : texcoords) {
+        quantized_texcoords.push_back(QuantizedTexcoord{QuantizeUnorm16(texcoord.x), QuantizeUnorm16(texcoord.y)});
+      }
+      attributes += std::format(
+          R"(,"TEXCOORD_0":{})",
+          AddAccessor<QuantizedTexcoord>(
+              quantized_texcoords, BufferTarget::kArrayBuffer, ComponentType::kUnsignedShort, true, "VEC2", {}));
+    } else if (!texcoords.empty()) {
+      attributes += std::format(
+          R"(,"TEXCOORD_0":{})",
+          AddAccessor<glm::vec2>(texcoords, BufferTarget::kArrayBuffer, ComponentType::kFloat, false, "VEC2", {}));
+    }
+
+    // meshes without indices are drawn as sequential triples of vertices which glTF also supports
+    auto primitive = std::format(R"({{"attributes":{{{}}})", attributes);
+    if (!indices.empty() && positions.size() <= kMaxShortIndex) {
+      const std::vector<std::uint16_t> short_indices{indices.begin(), indices.end()};
+      primitive += std::format(
+          R"(,"indices":{})",
+          AddAccessor<std::uint16_t>(
+              short_indices, BufferTarget::kElementArrayBuffer, ComponentType::kUnsignedShort, false, "SCALAR", {}));
+    } else if (!indices.empty()) {
+      primitive += std::format(
+          R"(,"indices":{})",
+          AddAccessor<std::uint32_t>(
+              indices, BufferTarget::kElementArrayBuffer, ComponentType::kUnsignedInt, false, "SCALAR", {}));
+    }
+
+    meshes_.push_back(std::format(R"({{"primitives":[{},"mode":4}}]}})", primitive));
+    return static_cast<int>(meshes_.size()) - 1;
+  }
+
+  /**
+   * @brief Copies values to their own buffer view and adds an accessor for them.
+   * @param values The values to copy which must not be empty.
+   * @param target The GPU buffer type the buffer view is bound to. Vertex attributes are given a byte stride equal
+   *               to the size of each value.
+   * @param component_type The type of each component of a value.
+   * @param normalized Indicates if integer components are normalized to [0,1] or [-1,1] when read.
+   * @param type The number of components of each value (e.g., "VEC3").
+   * @param bounds The optional "min" and "max" properties of the accessor.
+   * @return The index of the accessor.
+   */
+  template <typename T>
+  int AddAccessor(const std::span<const T> values,
+                  const BufferTarget target,
+                  const ComponentType component_type,
+                  const bool normalized,
+                  const std::string_view type,
+                  const std::string_view bounds) {
+    buffer_.resize(AlignUp(buffer_.size()), std::byte{0});
+    const auto byte_offset = buffer_.size();
+    const auto bytes = std::as_bytes(values);
+    buffer_.insert(buffer_.end(), bytes.begin(), bytes.end());
+
+    auto buffer_view = std::format(R"({{"buffer":0,"byteOffset":{},"byteLength":{})", byte_offset, bytes.size());
+    if (target == BufferTarget::kArrayBuffer) buffer_view += std::format(R"(,"byteStride":{})", sizeof(T));
+    buffer_views_.push_back(buffer_view + std::format(R"(,"target":{}}})", static_cast<int>(target)));
+
+    auto accessor = std::format(R"({{"bufferView":{},"componentType":{})",
+                                buffer_views_.size() - 1,
+                                static_cast<int>(component_type));
+    if (normalized) accessor += R"(,"normalized":true)";
+    accessor += std::format(R"(,"count":{},"type":"{}")", values.size(), type);
+    if (!bounds.empty()) accessor += std::format(",{}", bounds);
+    accessors_.push_back(accessor + '}');
+
+    return static_cast<int>(accessors_.size()) - 1;
+  }
+
+  GltfOptions options_;
+  bool has_lods_ = false;
+  std::vector<std::byte> buffer_;
+  std::vector<std::string> buffer_views_;
+  std::vector<std::string> accessors_;
+  std::vector<std::string> meshes_;
+  std::vector<std::string> nodes_;
+  std::vector<int> scene_nodes_;
+};
+
+}  // namespace
+
+void gltf_writer::WriteGlb(const std::filesystem::path& filepath,
+                           const std::span<const MeshData> meshes,
+                           const GltfOptions& options) {
+  if (meshes.empty()) throw std::invalid_argument{"Unable to write a glTF file without a mesh"};
+
+  GlbBuilder glb_builder{options};
+  for (const auto& mesh : meshes) glb_builder.AddLodChain(std::array{&mesh});
+  glb_builder.Write(filepath);
+}
+
+void gltf_writer::WriteGlb(const std::filesystem::path& filepath,
+                           const std::span<const mesh::LevelOfDetail> lods,
+                           const GltfOptions& options) {
+  if (lods.empty()) throw std::invalid_argument{"Unable to write a glTF file without a level of detail"};
+
+  std::vector<const MeshData*> meshes;
+  meshes.reserve(lods.size());
+  for (const auto& lod : lods) meshes.push_back(&lod.mesh);
+
+  GlbBuilder glb_builder{options};
+  glb_builder.AddLodChain(meshes);
+  glb_builder.Write(filepath);
+}
+
+}  // namespace gfx
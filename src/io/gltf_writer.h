@@ -0,0 +1,60 @@
+#ifndef IO_GLTF_WRITER_H_
+#define IO_GLTF_WRITER_H_
+
+#include <filesystem>
+#include <span>
+
+#include "geometry/mesh_simplifier.h"
+
+namespace gfx {
+class MeshData;
+
+/** @brief Options that control how meshes are encoded in a glTF file. */
+struct GltfOptions {
+  /**
+   * @brief Indicates if vertex attributes should be quantized using @c KHR_mesh_quantization. Positions are stored as
+   *        normalized 16-bit integers in the bounding cube of their level of detail chain and dequantized by the node
+   *        transform, normals as normalized 8-bit integers, and texture coordinates in [0,1] as normalized 16-bit
+   *        integers. Texture coordinates outside of [0,1] remain 32-bit floats.
+   */
+  bool quantize = false;
+};
+
+namespace gltf_writer {
+
+/**
+ * @brief Writes meshes to a binary glTF 2.0 (.glb) file with each mesh in its own scene node.
+ * @details Every vertex attribute and index array is stored in its own tightly packed buffer view of a single binary
+ *          chunk aligned to 4 bytes, so the file can be uploaded to the GPU without conversion. Indices use 16-bit
+ *          integers when every vertex can be addressed by them. Each mesh is transformed by its model transform.
+ * @param filepath The path to write the .glb file to.
+ * @param meshes The meshes to write.
+ * @param options Options that control how the meshes are encoded.
+ * @throw std::invalid_argument Thrown if @p meshes is empty, a mesh has no vertices, or a position or model transform
+ *                              is not finite.
+ * @throw std::runtime_error Thrown if the file cannot be written.
+ * @see https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html
+ */
+void WriteGlb(const std::filesystem::path& filepath, std::span<const MeshData> meshes, const GltfOptions& options = {});
+
+/**
+ * @brief Writes a level of detail chain to a binary glTF 2.0 (.glb) file.
+ * @details The finest level of detail is the only node in the scene and refers to a node for each coarser level of
+ *          detail through the @c MSFT_lod extension. Viewers without support for the extension render the finest
+ *          level of detail. Buffers are laid out as they are by the overload that writes individual meshes.
+ * @param filepath The path to write the .glb file to.
+ * @param lods The levels of detail ordered from the finest to the coarsest level of detail.
+ * @param options Options that control how the levels of detail are encoded.
+ * @throw std::invalid_argument Thrown if @p lods is empty, a level of detail has no vertices, or a position or model
+ *                              transform is not finite.
+ * @throw std::runtime_error Thrown if the file cannot be written.
+ * @see https://github.com/KhronosGroup/glTF/tree/main/extensions/2.0/Vendor/MSFT_lod
+ */
+void WriteGlb(const std::filesystem::path& filepath,
+              std::span<const mesh::LevelOfDetail> lods,
+              const GltfOptions& options = {});
+
+}  // namespace gltf_writer
+}  // namespace gfx
+
+#endif  // IO_GLTF_WRITER_H_
@@ -0,0 +1,104 @@
+#include "io/mapped_file.h"
+
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gfx {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::filesystem::path& filepath) {
+  file_handle_ = CreateFileW(
+      filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file_handle_ == INVALID_HANDLE_VALUE) {
+    file_handle_ = nullptr;
+    throw std::runtime_error{std::format("Unable to open {}", filepath.generic_string())};
+  }
+
+  LARGE_INTEGER size{};
+  if (!GetFileSizeEx(file_handle_, &size)) {
+    Unmap();
+    throw std::runtime_error{std::format("Unable to read the size of {}", filepath.generic_string())};
+  }
+  size_ = static_cast<std::size_t>(size.QuadPart);
+  if (size_ == 0) return;  // empty files cannot be mapped
+
+  mapping_handle_ = CreateFileMappingW(file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  data_ = mapping_handle_ != nullptr ? static_cast<const char*>(MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0))
+                                     : nullptr;
+  if (data_ == nullptr) {
+    Unmap();
+    throw std::runtime_error{std::format("Unable to map {}", filepath.generic_string())};
+  }
+}
+
+void MappedFile::Unmap() noexcept {
+  if (data_ != nullptr) UnmapViewOfFile(data_);
+  if (mapping_handle_ != nullptr) CloseHandle(mapping_handle_);
+  if (file_handle_ != nullptr) CloseHandle(file_handle_);
+  data_ = nullptr;
+  size_ = 0;
+  mapping_handle_ = file_handle_ = nullptr;
+}
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path& filepath) {
+  const auto file_descriptor = open(filepath.c_str(), O_RDONLY);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+  if (file_descriptor == -1) throw std::runtime_error{std::format("Unable to open {}", filepath.generic_string())};
+
+  // the mapping remains valid after the file descriptor is closed
+  struct stat file_status {};
+  if (fstat(file_descriptor, &file_status) == -1) {
+    close(file_descriptor);
+    throw std::runtime_error{std::format("Unable to read the size of {}", filepath.generic_string())};
+  }
+  size_ = static_cast<std::size_t>(file_status.st_size);
+
+  if (size_ > 0) {  // empty files cannot be mapped
+    auto* const data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (data == MAP_FAILED) {
+      close(file_descriptor);
+      throw std::runtime_error{std::format("Unable to map {}", filepath.generic_string())};
+    }
+    data_ = static_cast<const char*>(data);
+  }
+  close(file_descriptor);
+}
+
+void MappedFile::Unmap() noexcept {
+  if (data_ != nullptr) munmap(const_cast<char*>(data_), size_);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+  data_ = nullptr;
+  size_ = 0;
+}
+
+#endif
+
+MappedFile& MappedFile::operator=(MappedFile&& mapped_file) noexcept {
+  if (this != &mapped_file) {
+    Unmap();
+    data_ = std::exchange(mapped_file.data_, nullptr);
+    size_ = std::exchange(mapped_file.size_, 0);
+#ifdef _WIN32
+    file_handle_ = std::exchange(mapped_file.file_handle_, nullptr);
+    mapping_handle_ = std::exchange(mapped_file.mapping_handle_, nullptr);
+#endif
+  }
+  return *this;
+}
+
+MappedFile::~MappedFile() noexcept { Unmap(); }
+
+}  // namespace gfx
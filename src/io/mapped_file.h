@@ -0,0 +1,49 @@
+#ifndef IO_MAPPED_FILE_H_
+#define IO_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+#include <utility>
+
+namespace gfx {
+
+/**
+ * @brief A read-only view of a file mapped into memory.
+ * @details Pages are loaded by the operating system on first access so that large files can be read concurrently by
+ *          multiple threads without copying them into a buffer first.
+ */
+class MappedFile {
+public:
+  /**
+   * @brief Maps a file into memory.
+   * @param filepath The path to the file to map.
+   * @throw std::runtime_error Thrown if the file cannot be opened or mapped.
+   */
+  explicit MappedFile(const std::filesystem::path& filepath);
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& mapped_file) noexcept { *this = std::move(mapped_file); }
+  MappedFile& operator=(MappedFile&& mapped_file) noexcept;
+
+  ~MappedFile() noexcept;
+
+  /** @brief Gets the contents of the file. */
+  [[nodiscard]] std::string_view contents() const noexcept { return std::string_view{data_, size_}; }
+
+private:
+  void Unmap() noexcept;
+
+  const char* data_ = nullptr;
+  std::size_t size_ = 0;
+#ifdef _WIN32
+  void* file_handle_ = nullptr;
+  void* mapping_handle_ = nullptr;
+#endif
+};
+
+}  // namespace gfx
+
+#endif  // IO_MAPPED_FILE_H_
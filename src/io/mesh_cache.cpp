@@ -0,0 +1,175 @@
+#include "io/mesh_cache.h"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+namespace gfx {
+
+namespace {
+
+/** @brief Identifies a file as a mesh cache. */
+constexpr std::array kMeshCacheMagic{'G', 'F', 'X', 'M', 'E', 'S', 'H', '\0'};
+
+/** @brief The version of the mesh cache format which must be incremented when its layout changes. */
+constexpr std::uint32_t kMeshCacheVersion = 1;
+
+/** @brief A value whose bytes identify the byte order a mesh cache was written in. */
+constexpr std::uint32_t kByteOrderMark = 0x01020304;
+
+/** @brief The alignment of each array in a mesh cache which is a multiple of the alignment of every element type. */
+constexpr std::uint64_t kArrayAlignment = 64;
+
+/** @brief The location of an array in a mesh cache. */
+struct ArrayRecord {
+  std::uint64_t offset = 0;
+  std::uint64_t size = 0;
+};
+
+/** @brief The fixed-size header at the beginning of a mesh cache. */
+struct MeshCacheHeader {
+  std::array<char, kMeshCacheMagic.size()> magic{};
+  std::uint32_t version = 0;
+  std::uint32_t byte_order_mark = 0;
+  std::uint64_t source_size = 0;
+  std::int64_t source_write_time = 0;
+  ArrayRecord positions, normals, texcoords, indices;
+};
+
+// the header is written as raw bytes so it must not contain padding whose contents are indeterminate
+static_assert(std::has_unique_object_representations_v<MeshCacheHeader>);
+
+/** @brief Rounds an offset up to the next multiple of the array alignment. */
+constexpr std::uint64_t Align(const std::uint64_t offset) noexcept {
+  return (offset + kArrayAlignment - 1) / kArrayAlignment * kArrayAlignment;
+}
+
+/**
+ * @brief Gets a view of an array in a mapped mesh cache.
+ * @param contents The contents of the mesh cache.
+ * @param array_record The location of the array in @p contents.
+ * @param filepath The path to the mesh cache used in error messages.
+ * @return A view of the array in @p contents.
+ * @throw std::runtime_error Thrown if the array is misaligned or extends past the end of @p contents.
+ */
+template <typename T>
+std::span<const T> GetArray(const std::string_view contents,
+                            const ArrayRecord& array_record,
+                            const std::filesystem::path& filepath) {
+  if (array_record.size == 0) return {};
+  if (array_record.offset % kArrayAlignment != 0 || array_record.offset > contents.size()
+      || array_record.size > (contents.size() - array_record.offset) / sizeof(T)) {
+    throw std::runtime_error{std::format("Invalid mesh cache {}", filepath.generic_string())};
+  }
+  // mapped files are page aligned so the alignment of the offset is the alignment of the array in memory
+  return std::span{reinterpret_cast<const T*>(contents.data() + array_record.offset),  // NOLINT(*-reinterpret-cast)
+                   static_cast<std::size_t>(array_record.size)};
+}
+
+/** @brief Writes a contiguous sequence of values at an offset in a mesh cache padding the stream to reach it. */
+template <typename T>
+void WriteArray(std::ofstream& ofs, const ArrayRecord& array_record, const std::span<const T> values) {
+  static constexpr std::array<char, kArrayAlignment> kPadding{};
+  if (!ofs) return;  // the stream position is undefined after a failed write which is reported once flushed
+  const auto padding = array_record.offset - static_cast<std::uint64_t>(ofs.tellp());
+  ofs.write(kPadding.data(), static_cast<std::streamsize>(padding));
+  ofs.write(reinterpret_cast<const char*>(values.data()),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            static_cast<std::streamsize>(values.size_bytes()));
+}
+
+/** @brief Gets a path beside a mesh cache with a random suffix so that concurrent writers never share a file. */
+std::filesystem::path GetTemporaryPath(const std::filesystem::path& filepath) {
+  thread_local std::mt19937_64 generator{std::random_device{}()};
+  auto temporary_filepath = filepath;
+  temporary_filepath += std::format(".{:016x}.tmp", generator());
+  return temporary_filepath;
+}
+
+}  // namespace
+
+MeshCache::Source MeshCache::GetSource(const std::filesystem::path& filepath) {
+  std::error_code error_code;
+  const auto size = std::filesystem::file_size(filepath, error_code);
+  const auto write_time = error_code ? std::filesystem::file_time_type{} : last_write_time(filepath, error_code);
+  if (error_code) throw std::runtime_error{std::format("Unable to open {}", filepath.generic_string())};
+  return Source{.size = size, .write_time = static_cast<std::int64_t>(write_time.time_since_epoch().count())};
+}
+
+MeshCache::MeshCache(const std::filesystem::path& filepath) : mapped_file_{filepath} {
+  const auto contents = mapped_file_.contents();
+  MeshCacheHeader header;
+  if (contents.size() < sizeof(header)) {
+    throw std::runtime_error{std::format("Invalid mesh cache {}", filepath.generic_string())};
+  }
+  std::memcpy(&header, contents.data(), sizeof(header));
+
+  if (header.magic != kMeshCacheMagic || header.byte_order_mark != kByteOrderMark) {
+    throw std::runtime_error{std::format("Invalid mesh cache {}", filepath.generic_string())};
+  }
+  if (header.version != kMeshCacheVersion) {
+    throw std::runtime_error{std::format("Unsupported mesh cache version {} in {}, expected {}",
+                                         header.version,
+                                         filepath.generic_string(),
+                                         kMeshCacheVersion)};
+  }
+
+  source_ = Source{.size = header.source_size, .write_time = header.source_write_time};
+  positions_ = GetArray<glm::vec3>(contents, header.positions, filepath);
+  normals_ = GetArray<glm::vec3>(contents, header.normals, filepath);
+  texcoords_ = GetArray<glm::vec2>(contents, header.texcoords, filepath);
+  indices_ = GetArray<std::uint32_t>(contents, header.indices, filepath);
+}
+
+void MeshCache::Write(const std::filesystem::path& filepath,
+                      const Source& source,
+                      const std::span<const glm::vec3> positions,
+                      const std::span<const glm::vec3> normals,
+                      const std::span<const glm::vec2> texcoords,
+                      const std::span<const std::uint32_t> indices) {
+  MeshCacheHeader header{.magic = kMeshCacheMagic,
+                         .version = kMeshCacheVersion,
+                         .byte_order_mark = kByteOrderMark,
+                         .source_size = source.size,
+                         .source_write_time = source.write_time,
+                         .positions = {},
+                         .normals = {},
+                         .texcoords = {},
+                         .indices = {}};
+
+  auto offset = Align(sizeof(header));
+  const auto place_array = [&offset](const auto values) {
+    const ArrayRecord array_record{.offset = offset, .size = values.size()};
+    offset = Align(offset + values.size_bytes());
+    return array_record;
+  };
+  header.positions = place_array(positions);
+  header.normals = place_array(normals);
+  header.texcoords = place_array(texcoords);
+  header.indices = place_array(indices);
+
+  // replace the previous cache only once the new one is complete so that it is never mapped while partially written
+  const auto temporary_filepath = GetTemporaryPath(filepath);
+
+  {
+    std::ofstream ofs{temporary_filepath, std::ios::binary};
+    if (!ofs.good()) throw std::runtime_error{std::format("Unable to open {}", temporary_filepath.string())};
+
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));  // NOLINT(*-reinterpret-cast)
+    WriteArray(ofs, header.positions, positions);
+    WriteArray(ofs, header.normals, normals);
+    WriteArray(ofs, header.texcoords, texcoords);
+    WriteArray(ofs, header.indices, indices);
+
+    if (!ofs.flush()) throw std::runtime_error{std::format("Unable to write {}", temporary_filepath.string())};
+  }
+
+  std::filesystem::rename(temporary_filepath, filepath);
+}
+
+}  // namespace gfx
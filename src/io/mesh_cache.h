@@ -0,0 +1,94 @@
+#ifndef IO_MESH_CACHE_H_
+#define IO_MESH_CACHE_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include "io/mapped_file.h"
+
+namespace gfx {
+
+/**
+ * @brief Vertex attributes and triangle indices stored in a binary file that is mapped into memory so they can be used
+ *        without parsing or copying them.
+ * @details A mesh cache begins with a header identifying the format version, the byte order it was written in, and
+ *          the size and modification time of the file it was created from, followed by position, normal, texture
+ *          coordinate, and index arrays that are each aligned to a cache line. A cache is only valid for the machine
+ *          architecture it was written on and is rejected elsewhere.
+ */
+class MeshCache {
+public:
+  /** @brief Identifies the version of the file a mesh cache was created from. */
+  struct Source {
+    std::uint64_t size = 0;
+    std::int64_t write_time = 0;  // the last modification time in ticks of the file clock
+
+    friend bool operator==(const Source&, const Source&) = default;
+  };
+
+  /**
+   * @brief Gets the size and modification time of a file.
+   * @param filepath The file to evaluate.
+   * @return The version of @p filepath a mesh cache must have been created from to be used in its place.
+   * @throw std::runtime_error Thrown if the file does not exist.
+   */
+  [[nodiscard]] static Source GetSource(const std::filesystem::path& filepath);
+
+  /**
+   * @brief Maps a mesh cache into memory.
+   * @param filepath The path to the mesh cache.
+   * @throw std::runtime_error Thrown if the file cannot be opened or is not a mesh cache of the current version written
+   *                           in native byte order.
+   */
+  explicit MeshCache(const std::filesystem::path& filepath);
+
+  /**
+   * @brief Writes a mesh cache.
+   * @details The cache is written to a temporary file that replaces @p filepath once complete so that a concurrent or
+   *          interrupted load never maps a partially written cache.
+   * @param filepath The path to write the mesh cache to.
+   * @param source The version of the file the mesh was loaded from.
+   * @param positions The mesh vertex positions.
+   * @param normals The mesh normals.
+   * @param texcoords The mesh texture coordinates.
+   * @param indices Element indices where consecutive triples define a triangle face in the mesh.
+   * @throw std::runtime_error Thrown if the cache cannot be written.
+   */
+  static void Write(const std::filesystem::path& filepath,
+                    const Source& source,
+                    std::span<const glm::vec3> positions,
+                    std::span<const glm::vec3> normals,
+                    std::span<const glm::vec2> texcoords,
+                    std::span<const std::uint32_t> indices);
+
+  /** @brief Gets the version of the file the mesh cache was created from. */
+  [[nodiscard]] const Source& source() const noexcept { return source_; }
+
+  /** @brief Gets the mesh vertex positions. */
+  [[nodiscard]] std::span<const glm::vec3> positions() const noexcept { return positions_; }
+
+  /** @brief Gets the mesh normals. */
+  [[nodiscard]] std::span<const glm::vec3> normals() const noexcept { return normals_; }
+
+  /** @brief Gets the mesh texture coordinates. */
+  [[nodiscard]] std::span<const glm::vec2> texcoords() const noexcept { return texcoords_; }
+
+  /** @brief Gets the mesh indices corresponding to a triangle face for every three consecutive integers. */
+  [[nodiscard]] std::span<const std::uint32_t> indices() const noexcept { return indices_; }
+
+private:
+  MappedFile mapped_file_;
+  Source source_;
+  std::span<const glm::vec3> positions_;
+  std::span<const glm::vec3> normals_;
+  std::span<const glm::vec2> texcoords_;
+  std::span<const std::uint32_t> indices_;
+};
+
+}  // namespace gfx
+
+#endif  // IO_MESH_CACHE_H_
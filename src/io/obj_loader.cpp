@@ -0,0 +1,740 @@
+#include "io/obj_loader.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <glm/gtx/hash.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include "geometry/half_edge_mesh.h"
+#include "geometry/mesh_data.h"
+#include "geometry/parallel_for.h"
+#include "geometry/vertex_welder.h"
+#include "io/batch_io.h"
+#include "io/mapped_file.h"
+#include "io/mesh_cache.h"
+#include "io/ply_file.h"
+
+namespace gfx {
+
+namespace {
+
+constexpr auto kInvalidFaceElementIndex = -1;  // sentinel value indicating an unspecified face index
+
+/** @brief Characters removed from both ends of each line which includes the carriage return of Windows line endings. */
+constexpr std::string_view kLineDelimiter = " \t\r";
+
+/** @brief The minimum size of each chunk of an .obj file parsed concurrently. */
+constexpr std::size_t kMinChunkSize = 1u << 20u;
+
+/**
+ * @brief Removes a set of characters from the beginning and end of the string.
+ * @param line The string to evaluate.
+ * @param delimiter A set of characters (in any order) to remove from the beginning and end of the string.
+ * @return A view of the characters in @p delimiter removed from the beginning and end of @p line.
+ */
+constexpr std::string_view Trim(std::string_view line, const std::string_view delimiter = " \t") noexcept {
+  line.remove_prefix(std::min<>(line.find_first_not_of(delimiter), line.size()));
+  line.remove_suffix(line.size() - line.find_last_not_of(delimiter) - 1);
+  return line;
+}
+
+/**
+ * @brief Gets the next token delimited by a set of characters and advances past it without allocating.
+ * @param line The string to evaluate. On return, refers to the characters following the token.
+ * @param delimiter The set of characters (in any order) that separate tokens.
+ * @return A view of the first token in @p line or an empty view if @p line contains only delimiters.
+ */
+constexpr std::string_view NextToken(std::string_view& line, const std::string_view delimiter = " \t") noexcept {
+  // compare against each delimiter inline because std::string_view::find_first_of searches the delimiter set with a
+  // library call for every character which dominates the cost of scanning short tokens
+  const auto is_delimiter = [delimiter](const char c) noexcept {
+    return std::ranges::any_of(delimiter, [c](const char d) noexcept { return c == d; });
+  };
+  const auto begin = std::ranges::find_if_not(line, is_delimiter);
+  const auto end = std::find_if(begin, line.cend(), is_delimiter);
+  line = std::string_view{end, line.cend()};
+  return std::string_view{begin, end};
+}
+
+/**
+ * @brief Gets a fixed number of tokens following the first token of a line in an .obj file.
+ * @tparam N The number of tokens to get (does not include the first token identifying the line type).
+ * @param line The line to evaluate.
+ * @return An array of the @p N tokens following the line type.
+ * @throw std::invalid_argument Thrown if @p line does not contain exactly @p N tokens after the line type.
+ */
+template <std::size_t N>
+std::array<std::string_view, N> GetLineTokens(const std::string_view line) {
+  auto remaining_line = line;
+  if (!NextToken(remaining_line).empty()) {
+    std::array<std::string_view, N> tokens;
+    for (auto& token : tokens) token = NextToken(remaining_line);
+    if (!tokens.back().empty() && NextToken(remaining_line).empty()) return tokens;
+  }
+  throw std::invalid_argument{std::format("Unsupported format {}", line)};
+}
+
+/**
+ * @brief Attempts to convert a decimal token to a float without the general conversion algorithm.
+ * @details Tokens of the form <tt>[-]digits[.digits][(e|E)[+|-]digits]</tt> whose significant digits and power of ten
+ *          are both exactly representable as doubles are converted with a single correctly rounded multiplication or
+ *          division. Rounding that double to a float is also correctly rounded unless it lies exactly halfway between
+ *          two floats, in which case the token is left to the general conversion. This covers nearly all values
+ *          written by exporters.
+ * @param token The token to convert.
+ * @param value Set to the converted value of @p token if the fast path applies.
+ * @return @c true if @p token was converted, otherwise @c false.
+ * @see "How to Read Floating Point Numbers Accurately" by William D. Clinger (1990).
+ */
+bool TryParseFloat(const std::string_view token, float& value) noexcept {
+  static constexpr std::ptrdiff_t kMaxDigits = 19;  // the most decimal digits that always fit in 64 bits
+  static constexpr std::ptrdiff_t kMaxExponentDigits = 4;
+  static constexpr auto kMaxExactMantissa = std::uint64_t{1} << 53u;
+  static constexpr auto kPowersOfTen = [] {
+    std::array<double, 23> powers_of_ten{1.0};  // 10^22 is the largest power of ten exactly representable as a double
+    for (std::size_t i = 1; i < powers_of_ten.size(); ++i) powers_of_ten[i] = powers_of_ten[i - 1] * 10.0;
+    return powers_of_ten;
+  }();
+
+  const auto* it = token.data();
+  const auto* const end = it + token.size();
+  const auto negative = it != end && *it == '-';
+  if (negative) ++it;
+
+  // accumulate integer and fraction digits in a single pass and remember where the decimal point is
+  const auto* const digits_begin = it;
+  const char* decimal_point = nullptr;
+  std::uint64_t mantissa = 0;
+  for (; it != end; ++it) {
+    if (const auto digit = static_cast<unsigned char>(*it - '0'); digit < 10) {
+      mantissa = mantissa * 10 + digit;
+    } else if (*it == '.' && decimal_point == nullptr) {
+      decimal_point = it;
+    } else {
+      break;
+    }
+  }
+
+  const auto digit_count = it - digits_begin - (decimal_point != nullptr ? 1 : 0);
+  if (digit_count == 0 || decimal_point == digits_begin || decimal_point == it - 1) return false;
+  auto exponent = decimal_point != nullptr ? decimal_point + 1 - it : std::ptrdiff_t{0};
+
+  if (it != end && (*it == 'e' || *it == 'E')) {
+    ++it;
+    const auto negative_exponent = it != end && *it == '-';
+    if (it != end && (*it == '-' || *it == '+')) ++it;
+    const auto* const begin = it;
+    std::ptrdiff_t explicit_exponent = 0;
+    for (; it != end && *it >= '0' && *it <= '9' && it - begin < kMaxExponentDigits; ++it) {
+      explicit_exponent = explicit_exponent * 10 + (*it - '0');
+    }
+    if (it == begin) return false;
+    exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+  }
+
+  if (it != end || digit_count > kMaxDigits || mantissa > kMaxExactMantissa
+      || std::abs(exponent) >= static_cast<std::ptrdiff_t>(kPowersOfTen.size())) {
+    return false;
+  }
+
+  if (mantissa == 0) {
+    value = negative ? -0.0f : 0.0f;
+    return true;
+  }
+
+  const auto power_of_ten = kPowersOfTen[static_cast<std::size_t>(std::abs(exponent))];
+  const auto magnitude = exponent < 0 ? static_cast<double>(mantissa) / power_of_ten
+                                      : static_cast<double>(mantissa) * power_of_ten;
+  if (magnitude < std::numeric_limits<float>::min() || magnitude > std::numeric_limits<float>::max()) return false;
+
+  // a normal double is halfway between two normal floats when the 29 mantissa bits a float drops are exactly 1000...0
+  static constexpr auto kDroppedBitCount = std::numeric_limits<double>::digits - std::numeric_limits<float>::digits;
+  static constexpr auto kDroppedBitMask = (std::uint64_t{1} << kDroppedBitCount) - 1;
+  if ((std::bit_cast<std::uint64_t>(magnitude) & kDroppedBitMask) == kDroppedBitMask / 2 + 1) return false;
+
+  value = static_cast<float>(negative ? -magnitude : magnitude);
+  return true;
+}
+
+/**
+ * @brief Parses a string token.
+ * @tparam T The type to convert to.
+ * @param token The token to parse.
+ * @return The converted value of @p token to type @p T.
+ */
+template <typename T>
+T ParseToken(const std::string_view token) {
+  T value;
+  if constexpr (std::is_same_v<T, float>) {
+    if (TryParseFloat(token, value)) return value;
+  }
+  if (const auto [_, error_code] = std::from_chars(token.data(), token.data() + token.size(), value);
+      error_code == std::errc{}) {
+    return value;
+  }
+  throw std::invalid_argument{std::format("Unable to convert {} to type {}", token, typeid(T).name())};
+}
+
+/**
+ * @brief Parses a line in an .obj file.
+ * @tparam T The type to convert to.
+ * @tparam N The number of items to convert (does not include the first token identifying the line type).
+ * @param line The line to parse.
+ * @return A vector of size @p N containing each item in @p line converted to type @p T.
+ */
+template <typename T, int N>
+glm::vec<N, T> ParseLine(const std::string_view line) {
+  const auto tokens = GetLineTokens<N>(line);
+  glm::vec<N, T> vec{};
+  for (auto i = 0; i < N; ++i) {
+    vec[i] = ParseToken<T>(tokens[i]);
+  }
+  return vec;
+}
+
+/**
+ * @brief Parses a token representing a face element index group.
+ * @param token The token to parse. May optionally contain texture coordinate and normal indices.
+ * @return A vector containing vertex position, texture coordinate, and normal indices. Unspecified texture
+ *         coordinate and normal values are indicated by the value @c kInvalidFaceElementIndex.
+ */
+glm::ivec3 ParseIndexGroup(const std::string_view token) {
+  static constexpr auto kIndexDelimiter = '/';
+  const auto first_delimiter = token.find(kIndexDelimiter);
+  const auto second_delimiter =
+      first_delimiter == std::string_view::npos ? first_delimiter : token.find(kIndexDelimiter, first_delimiter + 1);
+
+  const auto x_token = token.substr(0, first_delimiter);
+  const auto parse_index = [](const std::string_view index_token) { return ParseToken<int>(index_token) - 1; };
+
+  if (first_delimiter == std::string_view::npos) {
+    if (!x_token.empty()) return glm::ivec3{parse_index(x_token), kInvalidFaceElementIndex, kInvalidFaceElementIndex};
+  } else if (second_delimiter == std::string_view::npos) {
+    if (const auto y_token = token.substr(first_delimiter + 1); !x_token.empty() && !y_token.empty()) {
+      return glm::ivec3{parse_index(x_token), parse_index(y_token), kInvalidFaceElementIndex};
+    }
+  } else if (const auto z_token = token.substr(second_delimiter + 1);
+             !x_token.empty() && !z_token.empty() && z_token.find(kIndexDelimiter) == std::string_view::npos) {
+    const auto y_token = token.substr(first_delimiter + 1, second_delimiter - first_delimiter - 1);
+    const auto y = y_token.empty() ? kInvalidFaceElementIndex : parse_index(y_token);
+    return glm::ivec3{parse_index(x_token), y, parse_index(z_token)};
+  }
+
+  throw std::invalid_argument{std::format("Unsupported format {}", token)};
+}
+
+/**
+ * @brief Parses a line representing a triangular face element.
+ * @param line The line to parse.
+ * @return An array containing three parsed index groups for the face.
+ */
+std::array<glm::ivec3, 3> ParseFace(const std::string_view line) {
+  const auto tokens = GetLineTokens<3>(line);
+  return std::array{ParseIndexGroup(tokens[0]), ParseIndexGroup(tokens[1]), ParseIndexGroup(tokens[2])};
+}
+
+/** @brief An object or group statement in an .obj file which names the faces that follow it. */
+struct ObjGroup {
+  std::size_t first_face = 0;  // the index of the first face that follows the statement
+  std::string name;
+};
+
+/** @brief Vertex attributes and faces parsed from a contiguous range of lines in an .obj file. */
+struct ObjChunk {
+  std::vector<glm::vec3> positions;
+  std::vector<glm::vec2> texcoords;
+  std::vector<glm::vec3> normals;
+  std::vector<std::array<glm::ivec3, 3>> faces;
+  std::vector<ObjGroup> groups;
+};
+
+/**
+ * @brief Splits a string into chunks of approximately equal size that end on a line boundary.
+ * @param contents The string to split.
+ * @param chunk_count The number of chunks to split @p contents into.
+ * @return At most @p chunk_count consecutive chunks of @p contents that each contain whole lines.
+ */
+std::vector<std::string_view> SplitChunks(const std::string_view contents, const std::size_t chunk_count) {
+  std::vector<std::string_view> chunks;
+  const auto chunk_size = (contents.size() + chunk_count - 1) / chunk_count;
+  for (std::size_t begin = 0; begin < contents.size();) {
+    const auto end = std::min(contents.find('\n', std::min(begin + chunk_size, contents.size())), contents.size());
+    chunks.push_back(contents.substr(begin, end + 1 - begin));
+    begin = end + 1;
+  }
+  return chunks;
+}
+
+/**
+ * @brief Parses a line in an .obj file and appends the vertex attribute or face it defines to a chunk.
+ * @param line The line to parse.
+ * @param chunk The chunk to append to. Lines that are empty, comments, or unsupported are ignored.
+ */
+void AppendLine(const std::string_view line, ObjChunk& chunk) {
+  if (const auto line_view = Trim(line, kLineDelimiter); !line_view.empty() && !line_view.starts_with('#')) {
+    if (line_view.starts_with("v ")) {
+      chunk.positions.push_back(ParseLine<float, 3>(line_view));
+    } else if (line_view.starts_with("vt ")) {
+      chunk.texcoords.push_back(ParseLine<float, 2>(line_view));
+    } else if (line_view.starts_with("vn ")) {
+      chunk.normals.push_back(ParseLine<float, 3>(line_view));
+    } else if (line_view.starts_with("f ")) {
+      chunk.faces.push_back(ParseFace(line_view));
+    } else if (line_view.starts_with("o ") || line_view.starts_with("g ") || line_view == "o" || line_view == "g") {
+      const auto name = Trim(line_view.substr(1));
+      chunk.groups.push_back(ObjGroup{.first_face = chunk.faces.size(), .name = std::string{name}});
+    }
+  }
+}
+
+/**
+ * @brief Parses a chunk of whole lines in an .obj file.
+ * @param contents The lines to parse.
+ * @return The vertex attributes and faces defined by @p contents in the order they appear.
+ */
+ObjChunk ParseChunk(std::string_view contents) {
+  ObjChunk chunk;
+  while (!contents.empty()) {
+    const auto line_end = std::min(contents.find('\n'), contents.size());
+    AppendLine(contents.substr(0, line_end), chunk);
+    contents.remove_prefix(std::min(line_end + 1, contents.size()));
+  }
+  return chunk;
+}
+
+/**
+ * @brief Concatenates a member of each chunk in parallel.
+ * @param chunks The chunks to concatenate.
+ * @param thread_count The maximum number of worker threads.
+ * @param member A pointer to the member to concatenate.
+ * @return The elements of @p member in each chunk in order.
+ */
+template <typename T>
+std::vector<T> Concatenate(const std::span<const ObjChunk> chunks,
+                           const std::size_t thread_count,
+                           std::vector<T> ObjChunk::*const member) {
+  std::vector<std::size_t> offsets(chunks.size() + 1, 0);
+  for (std::size_t i = 0; i < chunks.size(); ++i) offsets[i + 1] = offsets[i] + (chunks[i].*member).size();
+
+  std::vector<T> values(offsets.back());
+  ParallelFor(chunks.size(), thread_count, [&](const std::size_t i) {
+    std::ranges::copy(chunks[i].*member, values.begin() + static_cast<std::ptrdiff_t>(offsets[i]));
+  });
+  return values;
+}
+
+/** @brief Vertex attributes and triangle indices defined by an .obj file with a vertex for each unique index group. */
+struct IndexedTriangles {
+  std::vector<glm::vec3> positions;
+  std::vector<glm::vec2> texcoords;
+  std::vector<glm::vec3> normals;
+  std::vector<std::uint32_t> indices;
+  std::vector<ObjGroup> groups;  // object and group statements in the order they appear
+};
+
+/**
+ * @brief Loads vertex attributes and triangle indices from the contents of an .obj file.
+ * @details The contents are split into line-aligned chunks which are parsed concurrently. Unique index groups are
+ *          then found by partitioning them by hash across worker threads so that each worker finds the first
+ *          occurrence of its index groups, and a prefix sum over first occurrences assigns each unique index group
+ *          the same vertex index it would have in a single pass over the faces in file order.
+ * @param contents The contents of an .obj file.
+ * @param thread_count The maximum number of worker threads.
+ * @param min_chunk_size The minimum size of each chunk of @p contents parsed concurrently.
+ * @return The position, texture coordinates, normals, and indices specified in @p contents which are identical
+ *         regardless of @p thread_count.
+ */
+IndexedTriangles LoadIndexedTriangles(const std::string_view contents,
+                                      const std::size_t thread_count,
+                                      const std::size_t min_chunk_size) {
+  const auto chunk_count =
+      std::clamp<std::size_t>(contents.size() / min_chunk_size, 1, std::max<std::size_t>(thread_count, 1) * 4);
+  const auto chunk_contents = SplitChunks(contents, chunk_count);
+  std::vector<ObjChunk> chunks(chunk_contents.size());
+  ParallelFor(chunks.size(), thread_count, [&](const std::size_t i) { chunks[i] = ParseChunk(chunk_contents[i]); });
+
+  auto positions = Concatenate(chunks, thread_count, &ObjChunk::positions);
+  auto texcoords = Concatenate(chunks, thread_count, &ObjChunk::texcoords);
+  auto normals = Concatenate(chunks, thread_count, &ObjChunk::normals);
+  const auto faces = Concatenate(chunks, thread_count, &ObjChunk::faces);
+
+  std::vector<ObjGroup> groups;
+  for (std::size_t i = 0, face_offset = 0; i < chunks.size(); face_offset += chunks[i++].faces.size()) {
+    for (auto& [first_face, name] : chunks[i].groups) {
+      groups.push_back(ObjGroup{.first_face = face_offset + first_face, .name = std::move(name)});
+    }
+  }
+  chunks.clear();
+
+  if (faces.empty()) {
+    return IndexedTriangles{.positions = std::move(positions),
+                            .texcoords = std::move(texcoords),
+                            .normals = std::move(normals),
+                            .indices = {},
+                            .groups = std::move(groups)};
+  }
+
+  // For each index group, store texture coordinate and normals at the same index as the vertex position so that
+  // data is aligned when sent to the vertex shader. Occasionally, index groups may specify different texture
+  // coordinates or normals for the same vertex position. To handle this situation, each unique index group is assigned
+  // a new position, texture coordinate, and normal triple in the order it first appears.
+  const auto index_group_count = faces.size() * 3;
+  const auto get_index_group = [&faces](const std::size_t i) -> const glm::ivec3& { return faces[i / 3][i % 3]; };
+  const auto range_count = std::min(std::max<std::size_t>(thread_count, 1) * 4, index_group_count);
+  const auto get_range = [&](const std::size_t i) {
+    return std::pair{index_group_count * i / range_count, index_group_count * (i + 1) / range_count};
+  };
+
+  std::vector<std::size_t> hashes(index_group_count);
+  ParallelFor(range_count, thread_count, [&](const std::size_t i) {
+    for (auto [j, end] = get_range(i); j < end; ++j) hashes[j] = std::hash<glm::ivec3>{}(get_index_group(j));
+  });
+
+  // each worker finds the first occurrence of the index groups whose hash belongs to its partition
+  std::vector<std::size_t> first_occurrences(index_group_count);
+  const auto partition_count = std::max<std::size_t>(thread_count, 1);
+  ParallelFor(partition_count, thread_count, [&](const std::size_t partition) {
+    std::unordered_map<glm::ivec3, std::size_t> partition_index_groups;
+    for (std::size_t i = 0; i < index_group_count; ++i) {
+      if (hashes[i] % partition_count == partition) {
+        first_occurrences[i] = partition_index_groups.try_emplace(get_index_group(i), i).first->second;
+      }
+    }
+  });
+
+  // count the first occurrences in each range to find where its new vertices begin in the ordered arrays
+  using VertexCounts = std::array<std::size_t, 3>;  // positions, texture coordinates, and normals
+  std::vector<VertexCounts> range_offsets(range_count + 1, VertexCounts{});
+  ParallelFor(range_count, thread_count, [&](const std::size_t i) {
+    auto& [position_count, texcoord_count, normal_count] = range_offsets[i + 1];
+    for (auto [j, end] = get_range(i); j < end; ++j) {
+      if (first_occurrences[j] == j) {
+        ++position_count;
+        texcoord_count += get_index_group(j)[1] != kInvalidFaceElementIndex;
+        normal_count += get_index_group(j)[2] != kInvalidFaceElementIndex;
+      }
+    }
+  });
+  for (std::size_t i = 0; i < range_count; ++i) {
+    for (std::size_t j = 0; j < 3; ++j) range_offsets[i + 1][j] += range_offsets[i][j];
+  }
+
+  const auto& [position_count, texcoord_count, normal_count] = range_offsets.back();
+  std::vector<glm::vec3> ordered_positions(position_count);
+  std::vector<glm::vec2> ordered_texcoords(texcoord_count);
+  std::vector<glm::vec3> ordered_normals(normal_count);
+  std::vector<std::uint32_t> indices(index_group_count);
+
+  ParallelFor(range_count, thread_count, [&](const std::size_t i) {
+    auto [position_index, texcoord_index, normal_index] = range_offsets[i];
+    for (auto [j, end] = get_range(i); j < end; ++j) {
+      if (first_occurrences[j] != j) continue;
+      const auto& index_group = get_index_group(j);
+      ordered_positions[position_index] = positions.at(index_group[0]);
+
+      if (const auto texcoords_index = index_group[1]; texcoords_index != kInvalidFaceElementIndex) {
+        ordered_texcoords[texcoord_index++] = texcoords.at(texcoords_index);
+      }
+      if (const auto normals_index = index_group[2]; normals_index != kInvalidFaceElementIndex) {
+        ordered_normals[normal_index++] = normals.at(normals_index);
+      }
+      indices[j] = static_cast<std::uint32_t>(position_index++);
+    }
+  });
+
+  // repeated index groups refer to the vertex created for their first occurrence which always precedes them
+  ParallelFor(range_count, thread_count, [&](const std::size_t i) {
+    for (auto [j, end] = get_range(i); j < end; ++j) indices[j] = indices[first_occurrences[j]];
+  });
+
+  return IndexedTriangles{.positions = std::move(ordered_positions),
+                          .texcoords = std::move(ordered_texcoords),
+                          .normals = std::move(ordered_normals),
+                          .indices = std::move(indices),
+                          .groups = std::move(groups)};
+}
+
+/**
+ * @brief Splits the triangles of an .obj file into a separate set of triangles for each named object or group.
+ * @details Each object or group statement assigns the faces that follow it to the object with its name, so
+ *          statements that repeat a name append to the same object. Faces before the first statement belong to an
+ *          object named "default". Objects are split concurrently and each is assigned only the vertices its faces
+ *          refer to in the order they first appear.
+ * @param triangles The vertex attributes, triangle indices, and group statements of an .obj file.
+ * @param thread_count The maximum number of worker threads.
+ * @return The name and triangles of each object with at least one face in the order its name first appears.
+ * @throw std::invalid_argument Thrown if texture coordinates or normals do not align with position data.
+ */
+std::vector<std::pair<std::string, IndexedTriangles>> SplitObjects(const IndexedTriangles& triangles,
+                                                                   const std::size_t thread_count) {
+  const auto& [positions, texcoords, normals, indices, groups] = triangles;
+  if (!texcoords.empty() && texcoords.size() != positions.size()) {
+    throw std::invalid_argument{"Texture coordinates must align with position data"};
+  }
+  if (!normals.empty() && normals.size() != positions.size()) {
+    throw std::invalid_argument{"Vertex normals must align with position data"};
+  }
+
+  // assign each contiguous range of faces to the object named by the statement that precedes it
+  const auto face_count = indices.size() / 3;
+  std::vector<std::string_view> object_names;
+  std::vector<std::vector<std::pair<std::size_t, std::size_t>>> object_face_ranges;
+  std::unordered_map<std::string_view, std::size_t> object_indices;
+  const auto add_face_range = [&](const std::string_view name, const std::size_t begin, const std::size_t end) {
+    if (begin == end) return;
+    const auto [iterator, inserted] = object_indices.try_emplace(name, object_names.size());
+    if (inserted) {
+      object_names.push_back(name);
+      object_face_ranges.emplace_back();
+    }
+    object_face_ranges[iterator->second].emplace_back(begin, end);
+  };
+  static constexpr std::string_view kDefaultName = "default";
+  add_face_range(kDefaultName, 0, groups.empty() ? face_count : groups.front().first_face);
+  for (std::size_t i = 0; i < groups.size(); ++i) {
+    const auto end = i + 1 < groups.size() ? groups[i + 1].first_face : face_count;
+    const auto& name = groups[i].name;
+    add_face_range(name.empty() ? kDefaultName : std::string_view{name}, groups[i].first_face, end);
+  }
+
+  std::vector<std::pair<std::string, IndexedTriangles>> objects(object_names.size());
+  ParallelFor(objects.size(), thread_count, [&](const std::size_t i) {
+    auto& [name, object] = objects[i];
+    name = object_names[i];
+
+    std::unordered_map<std::uint32_t, std::uint32_t> object_vertices;
+    for (const auto& [begin, end] : object_face_ranges[i]) {
+      for (auto j = 3 * begin; j < 3 * end; ++j) {
+        const auto index = indices[j];
+        const auto [iterator, inserted] = object_vertices.try_emplace(index, object.positions.size());
+        if (inserted) {
+          object.positions.push_back(positions[index]);
+          if (!texcoords.empty()) object.texcoords.push_back(texcoords[index]);
+          if (!normals.empty()) object.normals.push_back(normals[index]);
+        }
+        object.indices.push_back(iterator->second);
+      }
+    }
+  });
+  return objects;
+}
+
+/**
+ * @brief Loads a triangle mesh from the contents of an .obj file.
+ * @param contents The contents of an .obj file.
+ * @param thread_count The maximum number of worker threads.
+ * @param min_chunk_size The minimum size of each chunk of @p contents parsed concurrently.
+ * @return A mesh defined by the position, texture coordinates, normals, and indices specified in @p contents.
+ */
+MeshData LoadMesh(const std::string_view contents, const std::size_t thread_count, const std::size_t min_chunk_size) {
+  auto [positions, texcoords, normals, indices, _] = LoadIndexedTriangles(contents, thread_count, min_chunk_size);
+  return MeshData{std::move(positions), std::move(normals), std::move(texcoords), std::move(indices)};
+}
+
+/**
+ * @brief Loads a triangle mesh from an input stream representing the contents of an .obj file.
+ * @param istream The input stream to parse.
+ * @return A mesh defined by the position, texture coordinates, normals, and indices specified in the input stream.
+ */
+MeshData LoadMesh(std::istream& istream) {
+  const std::string contents{std::istreambuf_iterator<char>{istream}, std::istreambuf_iterator<char>{}};
+  return LoadMesh(contents, 1, kMinChunkSize);
+}
+
+/**
+ * @brief Reads vertex positions and triangle faces from the contents of an .obj file.
+ * @param contents The contents of an .obj file.
+ * @param on_position Invoked with each vertex position in the order it appears in @p contents.
+ * @param on_face Invoked with the zero-based vertex position indices of each triangle face.
+ */
+void ReadTriangles(std::string_view contents,
+                   const std::function<void(const glm::vec3&)>& on_position,
+                   const std::function<void(const std::array<int, 3>&)>& on_face) {
+  while (!contents.empty()) {
+    const auto line_end = std::min(contents.find('\n'), contents.size());
+    const auto line_view = Trim(contents.substr(0, line_end), kLineDelimiter);
+    contents.remove_prefix(std::min(line_end + 1, contents.size()));
+
+    if (line_view.starts_with("v ")) {
+      on_position(ParseLine<float, 3>(line_view));
+    } else if (line_view.starts_with("f ")) {
+      const auto face = ParseFace(line_view);
+      on_face(std::array{face[0][0], face[1][0], face[2][0]});
+    }
+  }
+}
+
+/**
+ * @brief Loads vertex attributes and triangle indices from the contents of an .obj or binary PLY file.
+ * @param contents The contents of the file. Contents beginning with the PLY signature are read as a binary PLY file
+ *                 and any other contents are parsed as an .obj file.
+ * @param thread_count The maximum number of worker threads used to parse an .obj file.
+ * @return The position, texture coordinates, normals, and indices specified in @p contents.
+ */
+IndexedTriangles LoadFileTriangles(const std::string_view contents, const std::size_t thread_count) {
+  if (ply::HasSignature(contents)) {
+    auto [positions, normals, texcoords, indices] = ply::Read(contents);
+    return IndexedTriangles{.positions = std::move(positions),
+                            .texcoords = std::move(texcoords),
+                            .normals = std::move(normals),
+                            .indices = std::move(indices),
+                            .groups = {}};
+  }
+  return LoadIndexedTriangles(contents, thread_count, kMinChunkSize);
+}
+
+/** @brief Gets the path to the mesh cache of an .obj file. */
+std::filesystem::path GetMeshCachePath(const std::filesystem::path& filepath) {
+  auto mesh_cache_path = filepath;
+  mesh_cache_path += ".meshcache";
+  return mesh_cache_path;
+}
+
+/**
+ * @brief Loads vertex attributes and triangle indices from the mesh cache of an .obj file, creating the cache from the
+ *        file if it does not exist or was created from a different version of the file.
+ * @param filepath The path to the .obj file.
+ * @param thread_count The maximum number of worker threads used to parse the file when the cache cannot be used.
+ * @param create Invoked with the positions, normals, texture coordinates, and indices of the mesh.
+ * @return The result of @p create.
+ */
+template <typename F>
+auto LoadCached(const std::filesystem::path& filepath, const std::size_t thread_count, const F& create) {
+  const auto source = MeshCache::GetSource(filepath);
+  const auto mesh_cache_path = GetMeshCachePath(filepath);
+
+  std::optional<MeshCache> mesh_cache;
+  if (std::filesystem::exists(mesh_cache_path)) {
+    try {
+      mesh_cache.emplace(mesh_cache_path);
+    } catch (const std::runtime_error& e) {
+      std::clog << std::format("Ignoring mesh cache {}: {}\n", mesh_cache_path.generic_string(), e.what());
+    }
+  }
+  if (mesh_cache.has_value() && mesh_cache->source() == source) {
+    return create(mesh_cache->positions(), mesh_cache->normals(), mesh_cache->texcoords(), mesh_cache->indices());
+  }
+  mesh_cache.reset();  // unmap a stale cache so that it can be replaced
+
+  // unmap the file before creating the mesh so that its pages do not add to peak memory usage
+  const auto [positions, texcoords, normals, indices, _] = [&] {
+    const MappedFile mapped_file{filepath};
+    return LoadFileTriangles(mapped_file.contents(), thread_count);
+  }();
+
+  // the cache only accelerates later loads so failing to write it must not fail this one
+  try {
+    MeshCache::Write(mesh_cache_path, source, positions, normals, texcoords, indices);
+  } catch (const std::exception& e) {
+    std::clog << std::format("Unable to write mesh cache {}: {}\n", mesh_cache_path.generic_string(), e.what());
+  }
+
+  return create(std::span<const glm::vec3>{positions},
+                std::span<const glm::vec3>{normals},
+                std::span<const glm::vec2>{texcoords},
+                std::span<const std::uint32_t>{indices});
+}
+
+}  // namespace
+
+MeshData obj_loader::LoadMesh(const std::filesystem::path& filepath, const std::size_t thread_count) {
+  return LoadCached(filepath,
+                    thread_count,
+                    [](const auto positions, const auto normals, const auto texcoords, const auto indices) {
+                      return MeshData{std::vector(positions.begin(), positions.end()),
+                                      std::vector(normals.begin(), normals.end()),
+                                      std::vector(texcoords.begin(), texcoords.end()),
+                                      std::vector(indices.begin(), indices.end())};
+                    });
+}
+
+HalfEdgeMesh obj_loader::LoadHalfEdgeMesh(const std::filesystem::path& filepath, const std::size_t thread_count) {
+  return LoadCached(filepath,
+                    thread_count,
+                    [](const auto positions, const auto normals, const auto texcoords, const auto indices) {
+                      return HalfEdgeMesh{positions, normals, texcoords, indices};
+                    });
+}
+
+HalfEdgeMesh obj_loader::LoadHalfEdgeMesh(const std::filesystem::path& filepath,
+                                          const WeldOptions& weld_options,
+                                          const std::size_t thread_count) {
+  return LoadCached(filepath,
+                    thread_count,
+                    [&](const auto positions, const auto normals, const auto texcoords, const auto indices) {
+                      const auto welded_mesh =
+                          vertex_welder::Weld(positions, normals, texcoords, indices, weld_options, thread_count);
+                      return HalfEdgeMesh{
+                          welded_mesh.positions, welded_mesh.normals, welded_mesh.texcoords, welded_mesh.indices};
+                    });
+}
+
+std::vector<HalfEdgeMesh> obj_loader::LoadHalfEdgeMeshes(const std::span<const std::filesystem::path> filepaths,
+                                                         const BatchIoOptions& io_options,
+                                                         const std::size_t thread_count) {
+  std::vector<std::optional<HalfEdgeMesh>> half_edge_meshes(filepaths.size());
+  batch_io::ReadFiles(
+      filepaths,
+      [&](const std::size_t i, const std::string_view contents) {
+        const auto [positions, texcoords, normals, indices, _] = LoadFileTriangles(contents, 1);
+        half_edge_meshes[i].emplace(positions, normals, texcoords, indices);
+      },
+      io_options,
+      thread_count);
+
+  std::vector<HalfEdgeMesh> loaded_meshes;
+  loaded_meshes.reserve(half_edge_meshes.size());
+  for (auto& half_edge_mesh : half_edge_meshes) loaded_meshes.push_back(std::move(*half_edge_mesh));
+  return loaded_meshes;
+}
+
+std::vector<ObjObject> obj_loader::LoadObjects(const std::filesystem::path& filepath, const std::size_t thread_count) {
+  // unmap the file before creating meshes so that its pages do not add to peak memory usage
+  auto objects = [&] {
+    const MappedFile mapped_file{filepath};
+    return SplitObjects(LoadFileTriangles(mapped_file.contents(), thread_count), thread_count);
+  }();
+
+  std::vector<ObjObject> meshes;
+  meshes.reserve(objects.size());
+  for (auto& [name, object] : objects) {
+    meshes.push_back(ObjObject{.name = std::move(name),
+                               .mesh = MeshData{std::move(object.positions),
+                                                std::move(object.normals),
+                                                std::move(object.texcoords),
+                                                std::move(object.indices)}});
+  }
+  return meshes;
+}
+
+void obj_loader::ReadTriangles(const std::filesystem::path& filepath,
+                               const std::function<void(const glm::vec3&)>& on_position,
+                               const std::function<void(const std::array<int, 3>&)>& on_face) {
+  const MappedFile mapped_file{filepath};
+  gfx::ReadTriangles(mapped_file.contents(), on_position, on_face);
+}
+
+}  // namespace gfx
@@ -0,0 +1,134 @@
+#ifndef IO_OBJ_LOADER_H_
+#define IO_OBJ_LOADER_H_
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+#include "geometry/mesh_data.h"
+#include "io/batch_io.h"
+
+namespace gfx {
+class HalfEdgeMesh;
+struct WeldOptions;
+
+/** @brief A named object or group in an .obj file. */
+struct ObjObject {
+  /** @brief The name given by the object or group statements that precede the faces of the mesh. */
+  std::string name;
+
+  /** @brief The faces of the object and the vertices they refer to. */
+  MeshData mesh;
+};
+
+namespace obj_loader {
+
+/**
+ * @brief Loads a triangle mesh from an .obj or binary PLY file.
+ * @details The file is mapped into memory and split into line-aligned chunks that are parsed concurrently. Vertices
+ *          are then deduplicated in parallel so that the result is identical to parsing the file in a single pass.
+ *          Files beginning with the PLY signature are instead read by @c ply::Read regardless of their extension.
+ *          The result is saved to a mesh cache next to the file (e.g., model.obj.meshcache) which later loads map into
+ *          memory in place of parsing the file until its size or modification time changes.
+ * @param filepath The path to the .obj or PLY file.
+ * @param thread_count The maximum number of worker threads used to parse the file.
+ * @return A mesh defined by the position, texture coordinates, normals, and indices specified in the file.
+ * @throw std::invalid_argument Thrown if the file format is unsupported.
+ * @throw std::runtime_error Thrown if the file cannot be opened.
+ * @note At this time, only a subset of the .obj file specification is supported which includes 3D vertex positions,
+ *       2D texture coordinates, and 3D normals. Face elements are supported and may optionally contain texture
+ *       coordinates, normals, and indices.
+ * @see https://en.wikipedia.org/wiki/Wavefront_.obj_file
+ */
+MeshData LoadMesh(const std::filesystem::path& filepath,
+                  std::size_t thread_count = std::thread::hardware_concurrency());
+
+/**
+ * @brief Loads a half-edge mesh from an .obj or binary PLY file without creating intermediate mesh data.
+ * @details The file is parsed exactly as it is by @c LoadMesh and the resulting vertex attributes and indices are
+ *          passed directly to the half-edge mesh which skips copying them into a @c MeshData. The mesh cache of the
+ *          file is used and created the same way as by @c LoadMesh.
+ * @param filepath The path to the .obj or PLY file.
+ * @param thread_count The maximum number of worker threads used to parse the file.
+ * @return A half-edge mesh identical to one created from the mesh returned by @c LoadMesh for the same file.
+ * @throw std::invalid_argument Thrown if the file format is unsupported.
+ * @throw std::runtime_error Thrown if the file cannot be opened.
+ */
+HalfEdgeMesh LoadHalfEdgeMesh(const std::filesystem::path& filepath,
+                              std::size_t thread_count = std::thread::hardware_concurrency());
+
+/**
+ * @brief Loads a half-edge mesh from each file in a batch of .obj or binary PLY files.
+ * @details Files are read by @c batch_io::ReadFiles so that many reads are in flight at once, and each buffer is
+ *          parsed on a worker thread as soon as it has been read while the remaining files are still being read. Each
+ *          file is parsed on a single thread since files are already parsed concurrently. The mesh cache is not used
+ *          so that every file is read by the batch.
+ * @param filepaths The paths to the .obj or PLY files.
+ * @param io_options Options that control how the files are read.
+ * @param thread_count The maximum number of worker threads used to parse the files.
+ * @return A half-edge mesh for each file in the same order as @p filepaths.
+ * @throw std::invalid_argument Thrown if the format of a file is unsupported.
+ * @throw std::runtime_error Thrown if a file cannot be opened.
+ */
+std::vector<HalfEdgeMesh> LoadHalfEdgeMeshes(std::span<const std::filesystem::path> filepaths,
+                                             const BatchIoOptions& io_options = {},
+                                             std::size_t thread_count = std::thread::hardware_concurrency());
+
+/**
+ * @brief Loads a separate triangle mesh for each named object or group in an .obj file.
+ * @details The file is parsed concurrently exactly as it is by @c LoadMesh. Each @c o or @c g statement then assigns
+ *          the faces that follow it to the object with its name, and statements that repeat a name append to the same
+ *          object. Faces before the first statement belong to an object named "default". Objects are split on worker
+ *          threads and each mesh refers only to the vertices of its own faces. The mesh cache is not used because it
+ *          does not store object names. A binary PLY file is loaded as a single object named "default".
+ * @param filepath The path to the .obj or PLY file.
+ * @param thread_count The maximum number of worker threads used to parse the file and split its objects.
+ * @return A mesh for each object with at least one face in the order its name first appears in the file.
+ * @throw std::invalid_argument Thrown if the file format is unsupported.
+ * @throw std::runtime_error Thrown if the file cannot be opened.
+ */
+std::vector<ObjObject> LoadObjects(const std::filesystem::path& filepath,
+                                   std::size_t thread_count = std::thread::hardware_concurrency());
+
+/**
+ * @brief Loads a half-edge mesh from an .obj or binary PLY file after welding vertices split by the exporter.
+ * @details The file is parsed exactly as it is by @c LoadHalfEdgeMesh and vertices are then welded by
+ *          @c vertex_welder::Weld before the half-edge mesh is created so that per-face normals, texture seams, and
+ *          positions written with limited precision do not appear as boundaries. The mesh cache stores the file
+ *          contents before welding so that it can be shared with loads that use different options.
+ * @param filepath The path to the .obj or PLY file.
+ * @param weld_options Options that control which vertices are welded.
+ * @param thread_count The maximum number of worker threads used to parse the file and weld its vertices.
+ * @return A half-edge mesh created from the welded vertex attributes and indices.
+ * @throw std::invalid_argument Thrown if the file format is unsupported or a weld tolerance is negative.
+ * @throw std::runtime_error Thrown if the file cannot be opened.
+ */
+HalfEdgeMesh LoadHalfEdgeMesh(const std::filesystem::path& filepath,
+                              const WeldOptions& weld_options,
+                              std::size_t thread_count = std::thread::hardware_concurrency());
+
+/**
+ * @brief Reads vertex positions and triangle faces from an .obj file one line at a time without storing them.
+ * @details The file is mapped into memory and scanned in place so that no line is copied.
+ * @param filepath The path to the .obj file.
+ * @param on_position Invoked with each vertex position in the order it appears in the file.
+ * @param on_face Invoked with the zero-based vertex position indices of each triangle face.
+ * @throw std::invalid_argument Thrown if the file format is unsupported.
+ * @throw std::runtime_error Thrown if the file cannot be opened.
+ * @note Texture coordinates and normals are ignored which allows files larger than available memory to be processed.
+ */
+void ReadTriangles(const std::filesystem::path& filepath,
+                   const std::function<void(const glm::vec3&)>& on_position,
+                   const std::function<void(const std::array<int, 3>&)>& on_face);
+
+}  // namespace obj_loader
+}  // namespace gfx
+
+#endif  // IO_OBJ_LOADER_H_
@@ -0,0 +1,248 @@
+#include "io/obj_writer.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "geometry/mesh_data.h"
+#include "geometry/parallel_for.h"
+#include "io/batch_io.h"
+
+namespace gfx {
+
+namespace {
+
+/** @brief The number of vertices or faces in each chunk of an .obj file formatted concurrently. */
+constexpr std::size_t kChunkSize = std::size_t{1} << 16u;
+
+/**
+ * @brief The maximum length of a float formatted by @c std::to_chars in its shortest round-trip representation which
+ *        includes a sign, 9 significant digits, a decimal point, and an exponent (e.g., -1.17549435e-38).
+ */
+constexpr std::size_t kMaxFloatLength = 16;
+
+/** @brief The maximum length of a one-based 32-bit index. */
+constexpr std::size_t kMaxIndexLength = std::numeric_limits<std::uint32_t>::digits10 + 1;
+
+/** @brief The maximum length of a vertex attribute line such as "vn -0.5 1 2.25e-07". */
+constexpr std::size_t kMaxVertexLineLength = 3 + 3 * (kMaxFloatLength + 1);
+
+/** @brief The maximum length of a face line such as "f 1/1/1 2/2/2 3/3/3". */
+constexpr std::size_t kMaxFaceLineLength = 1 + 3 * (1 + 3 * kMaxIndexLength + 2) + 1;
+
+/** @brief Formats a contiguous range of lines of an .obj file independently of every other chunk. */
+using ChunkFormatter = std::function<std::string()>;
+
+/**
+ * @brief Formats a vertex attribute line.
+ * @param prefix The line prefix which identifies the vertex attribute (e.g., "v ").
+ * @param value The vertex attribute value.
+ * @param it The position in the chunk buffer to format the line at.
+ * @param last The end of the chunk buffer.
+ * @return The position in the chunk buffer following the formatted line.
+ */
+template <glm::length_t N>
+char* FormatVertex(const std::string_view prefix, const glm::vec<N, float>& value, char* it, char* const last) {
+  it = std::ranges::copy(prefix, it).out;
+  for (glm::length_t i = 0; i < N; ++i) {
+    if (i > 0) *it++ = ' ';
+    it = std::to_chars(it, last, value[i]).ptr;
+  }
+  *it++ = '\n';
+  return it;
+}
+
+/**
+ * @brief Formats a face line whose vertices refer to the same index of every vertex attribute.
+ * @param triangle The zero-based vertex indices of the triangle.
+ * @param has_texcoords Indicates if each face vertex refers to a texture coordinate.
+ * @param has_normals Indicates if each face vertex refers to a normal.
+ * @param it The position in the chunk buffer to format the line at.
+ * @param last The end of the chunk buffer.
+ * @return The position in the chunk buffer following the formatted line.
+ */
+char* FormatFace(const std::uint32_t* const triangle,
+                 const bool has_texcoords,
+                 const bool has_normals,
+                 char* it,
+                 char* const last) {
+  *it++ = 'f';
+  for (auto i = 0; i < 3; ++i) {
+    const auto index = std::uint64_t{triangle[i]} + 1;  // .obj indices are one-based
+    *it++ = ' ';
+    it = std::to_chars(it, last, index).ptr;
+    if (has_texcoords || has_normals) {
+      *it++ = '/';
+      if (has_texcoords) it = std::to_chars(it, last, index).ptr;
+      if (has_normals) {
+        *it++ = '/';
+        it = std::to_chars(it, last, index).ptr;
+      }
+    }
+  }
+  *it++ = '\n';
+  return it;
+}
+
+/**
+ * @brief Splits a range of lines into chunks that are each formatted into their own buffer.
+ * @param line_count The number of lines to format.
+ * @param max_line_length The maximum length of each line which determines the size of each chunk buffer.
+ * @param format_line Formats the line at an index into a chunk buffer and returns the position following it.
+ * @param chunk_formatters The chunk formatters to append to.
+ */
+template <typename F>
+void AddChunks(const std::size_t line_count,
+               const std::size_t max_line_length,
+               const F& format_line,
+               std::vector<ChunkFormatter>& chunk_formatters) {
+  for (std::size_t begin = 0; begin < line_count; begin += kChunkSize) {
+    const auto end = std::min(begin + kChunkSize, line_count);
+    chunk_formatters.emplace_back([begin, end, max_line_length, format_line] {
+      std::string chunk((end - begin) * max_line_length, '\0');
+      auto* it = chunk.data();
+      for (auto i = begin; i < end; ++i) it = format_line(i, it, it + max_line_length);
+      chunk.resize(static_cast<std::size_t>(it - chunk.data()));
+      return chunk;
+    });
+  }
+}
+
+/**
+ * @brief Formats chunks concurrently and concatenates them so that they can be written with a single call.
+ * @param chunk_formatters The chunk formatters in the order their chunks appear in the file.
+ * @param thread_count The maximum number of worker threads used to format the chunks.
+ * @return The concatenated chunks.
+ */
+std::string FormatChunks(const std::vector<ChunkFormatter>& chunk_formatters, const std::size_t thread_count) {
+  std::vector<std::string> chunks(chunk_formatters.size());
+  ParallelFor(chunks.size(), thread_count, [&](const std::size_t i) { chunks[i] = chunk_formatters[i](); });
+
+  std::vector<std::size_t> chunk_offsets(chunks.size() + 1, 0);
+  for (std::size_t i = 0; i < chunks.size(); ++i) chunk_offsets[i + 1] = chunk_offsets[i] + chunks[i].size();
+  std::string contents(chunk_offsets.back(), '\0');
+  ParallelFor(chunks.size(), thread_count, [&](const std::size_t i) {
+    std::memcpy(contents.data() + chunk_offsets[i], chunks[i].data(), chunks[i].size());
+  });
+  return contents;
+}
+
+/**
+ * @brief Formats vertex attributes and triangle indices as the contents of an .obj file.
+ * @see obj_writer::WriteMesh
+ */
+std::string FormatMesh(const std::span<const glm::vec3> positions,
+                       const std::span<const glm::vec3> normals,
+                       const std::span<const glm::vec2> texcoords,
+                       const std::span<const std::uint32_t> indices,
+                       const std::size_t thread_count) {
+  if (indices.size() % 3 != 0) {
+    throw std::invalid_argument{std::format("Invalid number of triangle indices: {}", indices.size())};
+  }
+  if ((!normals.empty() && normals.size() != positions.size())
+      || (!texcoords.empty() && texcoords.size() != positions.size())) {
+    throw std::invalid_argument{"Vertex attributes must align with position data"};
+  }
+  if (const auto max_index = std::ranges::max_element(indices);
+      max_index != indices.end() && *max_index >= positions.size()) {
+    throw std::invalid_argument{std::format("Face references vertex {} of {}", *max_index + 1, positions.size())};
+  }
+
+  const auto format_position = [positions](const std::size_t i, char* const it, char* const last) {
+    return FormatVertex("v ", positions[i], it, last);
+  };
+  const auto format_texcoord = [texcoords](const std::size_t i, char* const it, char* const last) {
+    return FormatVertex("vt ", texcoords[i], it, last);
+  };
+  const auto format_normal = [normals](const std::size_t i, char* const it, char* const last) {
+    return FormatVertex("vn ", normals[i], it, last);
+  };
+  const auto format_face = [indices, has_texcoords = !texcoords.empty(), has_normals = !normals.empty()](
+                               const std::size_t i, char* const it, char* const last) {
+    return FormatFace(indices.data() + 3 * i, has_texcoords, has_normals, it, last);
+  };
+
+  std::vector<ChunkFormatter> chunk_formatters;
+  AddChunks(positions.size(), kMaxVertexLineLength, format_position, chunk_formatters);
+  AddChunks(texcoords.size(), kMaxVertexLineLength, format_texcoord, chunk_formatters);
+  AddChunks(normals.size(), kMaxVertexLineLength, format_normal, chunk_formatters);
+  AddChunks(indices.size() / 3, kMaxFaceLineLength, format_face, chunk_formatters);
+  return FormatChunks(chunk_formatters, thread_count);
+}
+
+}  // namespace
+
+void obj_writer::WriteMesh(const std::filesystem::path& filepath,
+                           const std::span<const glm::vec3> positions,
+                           const std::span<const glm::vec3> normals,
+                           const std::span<const glm::vec2> texcoords,
+                           const std::span<const std::uint32_t> indices,
+                           const std::size_t thread_count) {
+  const auto contents = FormatMesh(positions, normals, texcoords, indices, thread_count);
+  std::ofstream ofs{filepath, std::ios::binary};
+  if (!ofs.good()) throw std::runtime_error{std::format("Unable to open {}", filepath.string())};
+  ofs.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+  if (!ofs.flush()) throw std::runtime_error{std::format("Unable to write {}", filepath.string())};
+}
+
+void obj_writer::WriteMesh(const std::filesystem::path& filepath,
+                           const MeshData& mesh,
+                           const std::size_t thread_count) {
+  WriteMesh(filepath, mesh.positions(), mesh.normals(), mesh.texcoords(), mesh.indices(), thread_count);
+}
+
+std::string obj_writer::FormatPart(const std::span<const glm::vec3> positions,
+                                   const std::span<const std::uint32_t> indices,
+                                   const std::size_t first_vertex_index,
+                                   const std::size_t thread_count) {
+  if (indices.size() % 3 != 0) {
+    throw std::invalid_argument{std::format("Invalid number of triangle indices: {}", indices.size())};
+  }
+  const auto vertex_count = first_vertex_index + positions.size();
+  if (const auto max_index = std::ranges::max_element(indices);
+      max_index != indices.end() && *max_index >= vertex_count) {
+    throw std::invalid_argument{std::format("Face references vertex {} of {}", *max_index + 1, vertex_count)};
+  }
+
+  const auto format_position = [positions](const std::size_t i, char* const it, char* const last) {
+    return FormatVertex("v ", positions[i], it, last);
+  };
+  const auto format_face = [indices](const std::size_t i, char* const it, char* const last) {
+    return FormatFace(indices.data() + 3 * i, false, false, it, last);
+  };
+
+  std::vector<ChunkFormatter> chunk_formatters;
+  AddChunks(positions.size(), kMaxVertexLineLength, format_position, chunk_formatters);
+  AddChunks(indices.size() / 3, kMaxFaceLineLength, format_face, chunk_formatters);
+  return FormatChunks(chunk_formatters, thread_count);
+}
+
+void obj_writer::WriteMeshes(const std::span<const std::filesystem::path> filepaths,
+                             const std::span<const MeshData> meshes,
+                             const BatchIoOptions& io_options,
+                             const std::size_t thread_count) {
+  if (filepaths.size() != meshes.size()) {
+    throw std::invalid_argument{
+        std::format("Batch contains {} file paths and {} meshes", filepaths.size(), meshes.size())};
+  }
+
+  // meshes are formatted concurrently so each is formatted on a single thread
+  std::vector<std::string> contents(meshes.size());
+  ParallelFor(meshes.size(), thread_count, [&](const std::size_t i) {
+    const auto& mesh = meshes[i];
+    contents[i] = FormatMesh(mesh.positions(), mesh.normals(), mesh.texcoords(), mesh.indices(), 1);
+  });
+
+  const std::vector<std::string_view> content_views{contents.begin(), contents.end()};
+  batch_io::WriteFiles(filepaths, content_views, io_options, thread_count);
+}
+
+}  // namespace gfx
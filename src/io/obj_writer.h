@@ -0,0 +1,96 @@
+#ifndef IO_OBJ_WRITER_H_
+#define IO_OBJ_WRITER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <thread>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include "io/batch_io.h"
+
+namespace gfx {
+class MeshData;
+
+namespace obj_writer {
+
+/**
+ * @brief Writes vertex attributes and triangle indices to an .obj file.
+ * @details Each line is formatted with @c std::to_chars into a buffer owned by a contiguous chunk of vertices or faces
+ *          and chunks are formatted concurrently. The chunks are then concatenated and the file is written with a
+ *          single call. Floating-point values use their shortest round-trip representation so that loading the file
+ *          with @c obj_loader::LoadMesh reproduces the same values.
+ * @param filepath The path to write the .obj file to.
+ * @param positions The mesh vertex positions.
+ * @param normals The mesh normals or empty if they should not be written.
+ * @param texcoords The mesh texture coordinates or empty if they should not be written.
+ * @param indices Element indices where consecutive triples define a triangle face in the mesh.
+ * @param thread_count The maximum number of worker threads used to format the file.
+ * @throw std::invalid_argument Thrown if the number of indices is not a multiple of 3, an index refers to a vertex
+ *                              that does not exist, or an attribute is not specified for every vertex.
+ * @throw std::runtime_error Thrown if the file cannot be written.
+ */
+void WriteMesh(const std::filesystem::path& filepath,
+               std::span<const glm::vec3> positions,
+               std::span<const glm::vec3> normals,
+               std::span<const glm::vec2> texcoords,
+               std::span<const std::uint32_t> indices,
+               std::size_t thread_count = std::thread::hardware_concurrency());
+
+/**
+ * @brief Writes a triangle mesh to an .obj file.
+ * @param filepath The path to write the .obj file to.
+ * @param mesh The mesh to write. Its model transform is not written.
+ * @param thread_count The maximum number of worker threads used to format the file.
+ * @throw std::invalid_argument Thrown if an attribute of @p mesh is not specified for every vertex.
+ * @throw std::runtime_error Thrown if the file cannot be written.
+ * @see WriteMesh(const std::filesystem::path&, std::span<const glm::vec3>, std::span<const glm::vec3>,
+ *      std::span<const glm::vec2>, std::span<const std::uint32_t>, std::size_t)
+ */
+void WriteMesh(const std::filesystem::path& filepath,
+               const MeshData& mesh,
+               std::size_t thread_count = std::thread::hardware_concurrency());
+
+/**
+ * @brief Writes a batch of triangle meshes to .obj files.
+ * @details Meshes are formatted concurrently exactly as they are by @c WriteMesh and the files are then written
+ *          together by @c batch_io::WriteFiles so that many writes are in flight at once. Every formatted file is held
+ *          in memory until the batch has been written.
+ * @param filepaths The paths to write the .obj files to.
+ * @param meshes The mesh to write to each file in @p filepaths. Their model transforms are not written.
+ * @param io_options Options that control how the files are written.
+ * @param thread_count The maximum number of worker threads used to format and write the files.
+ * @throw std::invalid_argument Thrown if the number of file paths and meshes differ or an attribute of a mesh is not
+ *                              specified for every vertex.
+ * @throw std::runtime_error Thrown if a file cannot be written.
+ */
+void WriteMeshes(std::span<const std::filesystem::path> filepaths,
+                 std::span<const MeshData> meshes,
+                 const BatchIoOptions& io_options = {},
+                 std::size_t thread_count = std::thread::hardware_concurrency());
+
+/**
+ * @brief Formats vertex positions and triangles as part of an .obj file that is written incrementally.
+ * @details Lines are formatted exactly as they are by @c WriteMesh except that triangles may refer to vertices in
+ *          parts of the file that were formatted earlier.
+ * @param positions The vertex positions to format.
+ * @param indices Zero-based indices of vertices in the entire file where consecutive triples define a triangle.
+ * @param first_vertex_index The index in the entire file of the first vertex in @p positions.
+ * @param thread_count The maximum number of worker threads used to format the lines.
+ * @return The formatted vertex lines followed by the formatted face lines.
+ * @throw std::invalid_argument Thrown if the number of indices is not a multiple of 3 or an index refers to a vertex
+ *                              that does not exist once @p positions are appended.
+ */
+[[nodiscard]] std::string FormatPart(std::span<const glm::vec3> positions,
+                                     std::span<const std::uint32_t> indices,
+                                     std::size_t first_vertex_index,
+                                     std::size_t thread_count = 1);
+
+}  // namespace obj_writer
+}  // namespace gfx
+
+#endif  // IO_OBJ_WRITER_H_
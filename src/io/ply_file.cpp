@@ -0,0 +1,488 @@
+#include "io/ply_file.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "geometry/mesh_data.h"
+
+namespace gfx {
+
+namespace {
+
+/** @brief The first line of every PLY file. */
+constexpr std::string_view kSignature = "ply";
+
+/** @brief The scalar types a PLY property may have. */
+enum class ScalarType : std::uint8_t { kInt8, kUint8, kInt16, kUint16, kInt32, kUint32, kFloat32, kFloat64 };
+
+/** @brief A property of a PLY element which is a list of values preceded by their count if it has a count type. */
+struct Property {
+  std::string name;
+  ScalarType type = ScalarType::kFloat32;
+  std::optional<ScalarType> count_type;
+};
+
+/** @brief A PLY element such as a vertex or face and the number of times it is repeated in the file. */
+struct Element {
+  std::string name;
+  std::size_t count = 0;
+  std::vector<Property> properties;
+};
+
+/** @brief The elements declared in a PLY header and the byte order they are stored in. */
+struct Header {
+  bool is_big_endian = false;
+  std::vector<Element> elements;
+};
+
+/** @brief Gets the size in bytes of a scalar type. */
+constexpr std::size_t GetSize(const ScalarType type) noexcept {
+  switch (type) {
+    case ScalarType::kInt8:
+    case ScalarType::kUint8:
+      return 1;
+    case ScalarType::kInt16:
+    case ScalarType::kUint16:
+      return 2;
+    case ScalarType::kInt32:
+    case ScalarType::kUint32:
+    case ScalarType::kFloat32:
+      return 4;
+    case ScalarType::kFloat64:
+      return 8;
+  }
+  return 0;
+}
+
+/** @brief Determines if a scalar type is an integer type which is required for list counts and vertex indices. */
+constexpr bool IsInteger(const ScalarType type) noexcept {
+  return type != ScalarType::kFloat32 && type != ScalarType::kFloat64;
+}
+
+/**
+ * @brief Parses the name of a scalar type.
+ * @throw std::invalid_argument Thrown if @p name is not a PLY scalar type.
+ */
+ScalarType ParseScalarType(const std::string_view name) {
+  using enum ScalarType;
+  static constexpr std::array<std::pair<std::string_view, ScalarType>, 16> kScalarTypes{{
+      {"char", kInt8},
+      {"int8", kInt8},
+      {"uchar", kUint8},
+      {"uint8", kUint8},
+      {"short", kInt16},
+      {"int16", kInt16},
+      {"ushort", kUint16},
+      {"uint16", kUint16},
+      {"int", kInt32},
+      {"int32", kInt32},
+      {"uint", kUint32},
+      {"uint32", kUint32},
+      {"float", kFloat32},
+      {"float32", kFloat32},
+      {"double", kFloat64},
+      {"float64", kFloat64},
+  }};
+  const auto iterator =
+      std::ranges::find(kScalarTypes, name, [](const auto& scalar_type) { return scalar_type.first; });
+  if (iterator == kScalarTypes.end()) throw std::invalid_argument{std::format("Unsupported PLY type {}", name)};
+  return iterator->second;
+}
+
+/** @brief Removes and returns the next whitespace-delimited token from the beginning of a header line. */
+std::string_view NextToken(std::string_view& line) noexcept {
+  const auto begin = std::min(line.find_first_not_of(" \t"), line.size());
+  line.remove_prefix(begin);
+  const auto end = std::min(line.find_first_of(" \t"), line.size());
+  const auto token = line.substr(0, end);
+  line.remove_prefix(end);
+  return token;
+}
+
+/**
+ * @brief Reads the header at the beginning of a PLY file.
+ * @param contents The contents of a PLY file which is advanced past the end of the header.
+ * @return The header of the file.
+ * @throw std::invalid_argument Thrown if the header is incomplete or declares an unsupported format.
+ */
+Header ReadHeader(std::string_view& contents) {
+  Header header;
+  auto has_format = false;
+
+  for (auto is_first_line = true;; is_first_line = false) {
+    const auto line_end = contents.find('\n');
+    if (line_end == std::string_view::npos) throw std::invalid_argument{"Missing PLY end_header"};
+    auto line = contents.substr(0, line_end);
+    if (line.ends_with('\r')) line.remove_suffix(1);
+    contents.remove_prefix(line_end + 1);
+
+    const auto keyword = NextToken(line);
+    if (is_first_line) {
+      if (keyword != kSignature) throw std::invalid_argument{"Missing PLY signature"};
+    } else if (keyword == "format") {
+      const auto format = NextToken(line);
+      if (format != "binary_little_endian" && format != "binary_big_endian") {
+        throw std::invalid_argument{std::format("Unsupported PLY format {}", format)};
+      }
+      header.is_big_endian = format == "binary_big_endian";
+      has_format = true;
+    } else if (keyword == "element") {
+      const auto name = NextToken(line);
+      const auto count_token = NextToken(line);
+      std::size_t count = 0;
+      if (const auto [ptr, ec] = std::from_chars(count_token.data(), count_token.data() + count_token.size(), count);
+          ec != std::errc{} || ptr != count_token.data() + count_token.size()) {
+        throw std::invalid_argument{std::format("Unsupported PLY element count {}", count_token)};
+      }
+      header.elements.push_back(Element{.name = std::string{name}, .count = count, .properties = {}});
+    } else if (keyword == "property") {
+      if (header.elements.empty()) throw std::invalid_argument{"PLY property must follow an element"};
+      Property property;
+      auto type = NextToken(line);
+      if (type == "list") {
+        property.count_type = ParseScalarType(NextToken(line));
+        if (!IsInteger(*property.count_type)) throw std::invalid_argument{"PLY list counts must be integers"};
+        type = NextToken(line);
+      }
+      property.type = ParseScalarType(type);
+      property.name = NextToken(line);
+      header.elements.back().properties.push_back(std::move(property));
+    } else if (keyword == "end_header") {
+      if (!has_format) throw std::invalid_argument{"Missing PLY format"};
+      return header;
+    } else if (keyword != "comment" && keyword != "obj_info" && !keyword.empty()) {
+      throw std::invalid_argument{std::format("Unsupported PLY header keyword {}", keyword)};
+    }
+  }
+}
+
+/** @brief Reads a value of a known type with the opposite byte order if @p swap is true. */
+template <typename T>
+T ReadValue(const char* const data, const bool swap) noexcept {
+  std::array<char, sizeof(T)> bytes{};
+  std::memcpy(bytes.data(), data, sizeof(T));
+  if (swap) std::ranges::reverse(bytes);
+  return std::bit_cast<T>(bytes);
+}
+
+/** @brief Reads a scalar of a type declared in the header and converts it to @p T. */
+template <typename T>
+T ReadScalar(const char* const data, const ScalarType type, const bool swap) noexcept {
+  switch (type) {
+    case ScalarType::kInt8:
+      return static_cast<T>(ReadValue<std::int8_t>(data, swap));
+    case ScalarType::kUint8:
+      return static_cast<T>(ReadValue<std::uint8_t>(data, swap));
+    case ScalarType::kInt16:
+      return static_cast<T>(ReadValue<std::int16_t>(data, swap));
+    case ScalarType::kUint16:
+      return static_cast<T>(ReadValue<std::uint16_t>(data, swap));
+    case ScalarType::kInt32:
+      return static_cast<T>(ReadValue<std::int32_t>(data, swap));
+    case ScalarType::kUint32:
+      return static_cast<T>(ReadValue<std::uint32_t>(data, swap));
+    case ScalarType::kFloat32:
+      return static_cast<T>(ReadValue<float>(data, swap));
+    case ScalarType::kFloat64:
+      return static_cast<T>(ReadValue<double>(data, swap));
+  }
+  return T{};
+}
+
+/**
+ * @brief Removes a number of bytes from the beginning of the contents of a PLY file.
+ * @throw std::invalid_argument Thrown if fewer than @p size bytes remain.
+ */
+std::string_view Consume(std::string_view& contents, const std::size_t size) {
+  if (size > contents.size()) throw std::invalid_argument{"Unexpected end of PLY data"};
+  const auto data = contents.substr(0, size);
+  contents.remove_prefix(size);
+  return data;
+}
+
+/** @brief Gets the size of each item of an element or zero if it has list properties whose size varies. */
+std::size_t GetStride(const Element& element) noexcept {
+  std::size_t stride = 0;
+  for (const auto& property : element.properties) {
+    if (property.count_type.has_value()) return 0;
+    stride += GetSize(property.type);
+  }
+  return stride;
+}
+
+/**
+ * @brief Removes the items of an element from the contents of a PLY file without reading them.
+ * @throw std::invalid_argument Thrown if the contents end before every item.
+ */
+void SkipElement(std::string_view& contents, const Element& element, const bool swap) {
+  if (const auto stride = GetStride(element); stride > 0) {
+    if (element.count > contents.size() / stride) throw std::invalid_argument{"Unexpected end of PLY data"};
+    contents.remove_prefix(element.count * stride);
+    return;
+  }
+  for (std::size_t i = 0; i < element.count; ++i) {
+    for (const auto& property : element.properties) {
+      std::size_t count = 1;
+      if (property.count_type.has_value()) {
+        const auto count_data = Consume(contents, GetSize(*property.count_type));
+        count = ReadScalar<std::size_t>(count_data.data(), *property.count_type, swap);
+      }
+      Consume(contents, count * GetSize(property.type));
+    }
+  }
+}
+
+/**
+ * @brief Reads a vertex attribute from the items of the vertex element.
+ * @param vertices The items of the vertex element.
+ * @param element The vertex element.
+ * @param names The property names of each component of the attribute.
+ * @param swap Indicates if the byte order of the file differs from the native byte order.
+ * @return The attribute of each vertex or empty if the vertex element does not have every component.
+ */
+template <glm::length_t N>
+std::vector<glm::vec<N, float>> ReadAttribute(const std::string_view vertices,
+                                              const Element& element,
+                                              const std::array<std::string_view, N>& names,
+                                              const bool swap) {
+  std::array<std::size_t, N> offsets{};
+  std::array<ScalarType, N> types{};
+  for (glm::length_t i = 0; i < N; ++i) {
+    std::size_t offset = 0;
+    const auto iterator = std::ranges::find_if(element.properties, [&](const auto& property) {
+      if (property.name == names[i]) return true;
+      offset += GetSize(property.type);
+      return false;
+    });
+    if (iterator == element.properties.end()) return {};
+    offsets[i] = offset;
+    types[i] = iterator->type;
+  }
+
+  using Vector = glm::vec<N, float>;
+  const auto stride = GetStride(element);
+  std::vector<Vector> attribute(element.count);
+
+  // copy attributes stored as consecutive native floats directly instead of converting each component
+  auto is_contiguous = !swap;
+  for (glm::length_t i = 0; i < N; ++i) {
+    const auto offset = offsets[0] + static_cast<std::size_t>(i) * sizeof(float);
+    is_contiguous = is_contiguous && types[i] == ScalarType::kFloat32 && offsets[i] == offset;
+  }
+  if (is_contiguous && stride == sizeof(Vector)) {
+    std::memcpy(attribute.data(), vertices.data(), attribute.size() * sizeof(Vector));
+  } else if (is_contiguous) {
+    for (std::size_t i = 0; i < attribute.size(); ++i) {
+      std::memcpy(&attribute[i], vertices.data() + i * stride + offsets[0], sizeof(Vector));
+    }
+  } else {
+    for (std::size_t i = 0; i < attribute.size(); ++i) {
+      for (glm::length_t j = 0; j < N; ++j) {
+        attribute[i][j] = ReadScalar<float>(vertices.data() + i * stride + offsets[j], types[j], swap);
+      }
+    }
+  }
+
+  return attribute;
+}
+
+/**
+ * @brief Reads the vertex attributes of the vertex element.
+ * @param contents The contents of a PLY file beginning at the vertex element which is advanced past it.
+ * @param element The vertex element.
+ * @param swap Indicates if the byte order of the file differs from the native byte order.
+ * @param indexed_triangles The triangles to read vertex attributes into.
+ * @throw std::invalid_argument Thrown if the vertex element does not have positions, has list properties, or the
+ *                              contents end before every vertex.
+ */
+void ReadVertices(std::string_view& contents,
+                  const Element& element,
+                  const bool swap,
+                  ply::IndexedTriangles& indexed_triangles) {
+  const auto stride = GetStride(element);
+  if (stride == 0) throw std::invalid_argument{"Unsupported PLY vertex element with list properties"};
+  if (element.count > contents.size() / stride) throw std::invalid_argument{"Unexpected end of PLY data"};
+  const auto vertices = Consume(contents, element.count * stride);
+
+  indexed_triangles.positions = ReadAttribute<3>(vertices, element, {"x", "y", "z"}, swap);
+  if (indexed_triangles.positions.size() != element.count) {
+    throw std::invalid_argument{"PLY vertex element must have x, y, and z properties"};
+  }
+  indexed_triangles.normals = ReadAttribute<3>(vertices, element, {"nx", "ny", "nz"}, swap);
+
+  static constexpr std::array<std::array<std::string_view, 2>, 4> kTexcoordNames{
+      {{"s", "t"}, {"u", "v"}, {"texture_u", "texture_v"}, {"texture_s", "texture_t"}}};
+  for (const auto& texcoord_names : kTexcoordNames) {
+    indexed_triangles.texcoords = ReadAttribute<2>(vertices, element, texcoord_names, swap);
+    if (!indexed_triangles.texcoords.empty()) break;
+  }
+}
+
+/**
+ * @brief Reads the triangle indices of the face element.
+ * @param contents The contents of a PLY file beginning at the face element which is advanced past it.
+ * @param element The face element.
+ * @param swap Indicates if the byte order of the file differs from the native byte order.
+ * @param indices The indices to append each triangle to. Polygons are triangulated as a fan.
+ * @throw std::invalid_argument Thrown if the face element does not have vertex indices, has a face with fewer than
+ *                              three vertices, or the contents end before every face.
+ */
+void ReadFaces(std::string_view& contents,
+               const Element& element,
+               const bool swap,
+               std::vector<std::uint32_t>& indices) {
+  const auto index_property = std::ranges::find_if(element.properties, [](const auto& property) {
+    return property.count_type.has_value() && (property.name == "vertex_indices" || property.name == "vertex_index");
+  });
+  if (index_property == element.properties.end() || !IsInteger(index_property->type)) {
+    throw std::invalid_argument{"PLY face element must have an integer vertex_indices list property"};
+  }
+
+  // triangles whose indices are stored as native 32-bit integers are copied directly
+  const auto index_size = GetSize(index_property->type);
+  const auto is_native = !swap && index_size == sizeof(std::uint32_t);
+  indices.reserve(indices.size() + std::min(element.count, contents.size() / (index_size * 3)) * 3);
+
+  for (std::size_t i = 0; i < element.count; ++i) {
+    for (auto property = element.properties.begin(); property != element.properties.end(); ++property) {
+      if (!property->count_type.has_value()) {
+        Consume(contents, GetSize(property->type));
+        continue;
+      }
+
+      const auto count_data = Consume(contents, GetSize(*property->count_type));
+      const auto count = ReadScalar<std::size_t>(count_data.data(), *property->count_type, swap);
+      const auto list = Consume(contents, count * GetSize(property->type));
+      if (property != index_property) continue;
+
+      if (count < 3) throw std::invalid_argument{std::format("Unsupported PLY face with {} vertices", count)};
+      if (is_native && count == 3) {
+        const auto offset = indices.size();
+        indices.resize(offset + 3);
+        std::memcpy(indices.data() + offset, list.data(), 3 * sizeof(std::uint32_t));
+        continue;
+      }
+
+      const auto get_index = [&](const std::size_t j) {
+        return ReadScalar<std::uint32_t>(list.data() + j * index_size, property->type, swap);
+      };
+      const auto i0 = get_index(0);
+      for (std::size_t j = 1; j + 1 < count; ++j) indices.insert(indices.end(), {i0, get_index(j), get_index(j + 1)});
+    }
+  }
+}
+
+/** @brief Converts a value from native byte order to little-endian byte order. */
+template <typename T>
+T ToLittleEndian(const T value) noexcept {
+  if constexpr (std::endian::native == std::endian::big) {
+    auto bytes = std::bit_cast<std::array<char, sizeof(T)>>(value);
+    std::ranges::reverse(bytes);
+    return std::bit_cast<T>(bytes);
+  } else {
+    return value;
+  }
+}
+
+}  // namespace
+
+bool ply::HasSignature(const std::string_view contents) noexcept {
+  return contents.starts_with("ply\n") || contents.starts_with("ply\r\n");
+}
+
+ply::IndexedTriangles ply::Read(std::string_view contents) {
+  const auto header = ReadHeader(contents);
+  const auto swap = header.is_big_endian != (std::endian::native == std::endian::big);
+
+  IndexedTriangles indexed_triangles;
+  auto has_vertices = false;
+  for (const auto& element : header.elements) {
+    if (element.name == "vertex" && !has_vertices) {
+      ReadVertices(contents, element, swap, indexed_triangles);
+      has_vertices = true;
+    } else if (element.name == "face") {
+      ReadFaces(contents, element, swap, indexed_triangles.indices);
+    } else {
+      SkipElement(contents, element, swap);
+    }
+  }
+
+  if (!has_vertices) throw std::invalid_argument{"Missing PLY vertex element"};
+  const auto vertex_count = indexed_triangles.positions.size();
+  if (const auto iterator = std::ranges::find_if(indexed_triangles.indices, [&](const auto index) {
+        return index >= vertex_count;
+      });
+      iterator != indexed_triangles.indices.end()) {
+    throw std::invalid_argument{std::format("PLY face refers to vertex {} which does not exist", *iterator)};
+  }
+
+  return indexed_triangles;
+}
+
+void ply::Write(const std::filesystem::path& filepath,
+                const std::span<const glm::vec3> positions,
+                const std::span<const glm::vec3> normals,
+                const std::span<const glm::vec2> texcoords,
+                const std::span<const std::uint32_t> indices) {
+  if (indices.size() % 3 != 0) {
+    throw std::invalid_argument{std::format("Invalid number of triangle indices: {}", indices.size())};
+  }
+  if ((!normals.empty() && normals.size() != positions.size())
+      || (!texcoords.empty() && texcoords.size() != positions.size())) {
+    throw std::invalid_argument{"Vertex attributes must align with position data"};
+  }
+
+  std::string header = std::format("ply\nformat binary_little_endian 1.0\nelement vertex {}\n", positions.size());
+  header += "property float x\nproperty float y\nproperty float z\n";
+  if (!normals.empty()) header += "property float nx\nproperty float ny\nproperty float nz\n";
+  if (!texcoords.empty()) header += "property float s\nproperty float t\n";
+  header += std::format("element face {}\nproperty list uchar uint vertex_indices\nend_header\n", indices.size() / 3);
+
+  // interleave vertex attributes and faces so that each element is written with a single call
+  const auto vertex_size = 3 + (normals.empty() ? 0 : 3) + (texcoords.empty() ? 0 : 2);
+  std::vector<float> vertices;
+  vertices.reserve(positions.size() * vertex_size);
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    for (glm::length_t j = 0; j < 3; ++j) vertices.push_back(ToLittleEndian(positions[i][j]));
+    if (!normals.empty()) {
+      for (glm::length_t j = 0; j < 3; ++j) vertices.push_back(ToLittleEndian(normals[i][j]));
+    }
+    if (!texcoords.empty()) {
+      for (glm::length_t j = 0; j < 2; ++j) vertices.push_back(ToLittleEndian(texcoords[i][j]));
+    }
+  }
+
+  static constexpr std::size_t kFaceSize = 1 + 3 * sizeof(std::uint32_t);
+  std::vector<char> faces(indices.size() / 3 * kFaceSize);
+  for (std::size_t i = 0; i < indices.size() / 3; ++i) {
+    auto* const face = faces.data() + i * kFaceSize;
+    const std::array triangle{
+        ToLittleEndian(indices[3 * i]), ToLittleEndian(indices[3 * i + 1]), ToLittleEndian(indices[3 * i + 2])};
+    face[0] = 3;
+    std::memcpy(face + 1, triangle.data(), sizeof(triangle));
+  }
+
+  std::ofstream ofs{filepath, std::ios::binary};
+  if (!ofs.good()) throw std::runtime_error{std::format("Unable to open {}", filepath.string())};
+  ofs.write(header.data(), static_cast<std::streamsize>(header.size()));
+  ofs.write(reinterpret_cast<const char*>(vertices.data()),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            static_cast<std::streamsize>(vertices.size() * sizeof(float)));
+  ofs.write(faces.data(), static_cast<std::streamsize>(faces.size()));
+  if (!ofs.flush()) throw std::runtime_error{std::format("Unable to write {}", filepath.string())};
+}
+
+void ply::Write(const std::filesystem::path& filepath, const MeshData& mesh) {
+  Write(filepath, mesh.positions(), mesh.normals(), mesh.texcoords(), mesh.indices());
+}
+
+}  // namespace gfx
@@ -0,0 +1,76 @@
+#ifndef IO_PLY_FILE_H_
+#define IO_PLY_FILE_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+namespace gfx {
+class MeshData;
+
+namespace ply {
+
+/** @brief Vertex attributes and triangle indices read from a PLY file. */
+struct IndexedTriangles {
+  std::vector<glm::vec3> positions;
+  std::vector<glm::vec3> normals;    // empty if the file does not have normals
+  std::vector<glm::vec2> texcoords;  // empty if the file does not have texture coordinates
+  std::vector<std::uint32_t> indices;
+};
+
+/**
+ * @brief Determines if the contents of a file begin with the PLY signature.
+ * @param contents The contents of a file.
+ * @return @c true if @p contents should be read as a PLY file, otherwise @c false.
+ */
+[[nodiscard]] bool HasSignature(std::string_view contents) noexcept;
+
+/**
+ * @brief Reads vertex attributes and triangle indices from the contents of a binary PLY file.
+ * @details Vertex positions are read from the x, y, and z properties of the vertex element, normals from nx, ny, and
+ *          nz, and texture coordinates from s and t or u and v. Every other element and property is skipped. When
+ *          an attribute is stored as consecutive 32-bit floats in native byte order, it is copied in bulk rather than
+ *          converted one property at a time. Polygons with more than three vertices are triangulated as a fan.
+ * @param contents The contents of a binary little-endian or big-endian PLY file.
+ * @return The vertex attributes and triangle indices in @p contents.
+ * @throw std::invalid_argument Thrown if the file format is unsupported, the contents end before every element is
+ *                              read, or a face refers to a vertex that does not exist.
+ * @see http://paulbourke.net/dataformats/ply/
+ */
+[[nodiscard]] IndexedTriangles Read(std::string_view contents);
+
+/**
+ * @brief Writes vertex attributes and triangle indices to a binary little-endian PLY file.
+ * @param filepath The path to write the PLY file to.
+ * @param positions The mesh vertex positions.
+ * @param normals The mesh normals or empty if they should not be written.
+ * @param texcoords The mesh texture coordinates or empty if they should not be written.
+ * @param indices Element indices where consecutive triples define a triangle face in the mesh.
+ * @throw std::invalid_argument Thrown if the number of indices is not a multiple of 3 or an attribute is not specified
+ *                              for every vertex.
+ * @throw std::runtime_error Thrown if the file cannot be written.
+ */
+void Write(const std::filesystem::path& filepath,
+           std::span<const glm::vec3> positions,
+           std::span<const glm::vec3> normals,
+           std::span<const glm::vec2> texcoords,
+           std::span<const std::uint32_t> indices);
+
+/**
+ * @brief Writes a triangle mesh to a binary little-endian PLY file.
+ * @param filepath The path to write the PLY file to.
+ * @param mesh The mesh to write. Its model transform is not written.
+ * @throw std::invalid_argument Thrown if an attribute of @p mesh is not specified for every vertex.
+ * @throw std::runtime_error Thrown if the file cannot be written.
+ */
+void Write(const std::filesystem::path& filepath, const MeshData& mesh);
+
+}  // namespace ply
+}  // namespace gfx
+
+#endif  // IO_PLY_FILE_H_
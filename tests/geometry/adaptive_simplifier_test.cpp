@@ -0,0 +1,47 @@
+#include "geometry/adaptive_simplifier.cpp"  // NOLINT
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test_meshes.h"
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+TEST(AdaptiveSimplifierTest, TestCreateSample) {
+  const auto mesh = test::CreateSubdividedOctahedron(1);
+  const auto sample = CreateSample(mesh, 2);
+
+  EXPECT_EQ(5, sample.positions().size());
+  EXPECT_EQ((std::vector<std::uint32_t>{0, 1, 2, 1, 3, 4}), sample.indices());
+}
+
+TEST(AdaptiveSimplifierTest, TestSimplifyWithinGenerousBudgetUsesExactStrategy) {
+  const auto mesh = test::CreateSubdividedOctahedron(4);
+  const auto job = mesh::SimplifyWithinBudget(mesh, 0.5f, std::chrono::hours{1});
+
+  EXPECT_EQ(SimplificationStrategy::kExact, job.strategy);
+  EXPECT_EQ(0, job.clustered_face_count);
+  EXPECT_LT(job.mesh.indices().size(), mesh.indices().size());
+}
+
+TEST(AdaptiveSimplifierTest, TestSimplifyWithinZeroBudgetUsesClusteredStrategy) {
+  const auto mesh = test::CreateSubdividedOctahedron(4);
+  const auto job = mesh::SimplifyWithinBudget(mesh, 0.5f, std::chrono::duration<float>{0.0f});
+
+  EXPECT_EQ(SimplificationStrategy::kClustered, job.strategy);
+  EXPECT_GT(job.predicted_time.count(), 0.0f);
+  EXPECT_LT(job.mesh.indices().size(), mesh.indices().size());
+}
+
+TEST(AdaptiveSimplifierTest, TestSimplifyWithinBudgetWithInvalidRateThrowsException) {
+  EXPECT_THROW((void)mesh::SimplifyWithinBudget(test::CreateSubdividedOctahedron(0), 1.5f, std::chrono::seconds{1}),
+               std::invalid_argument);
+}
+
+}  // namespace
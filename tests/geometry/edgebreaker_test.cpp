@@ -0,0 +1,177 @@
+#include "geometry/edgebreaker.cpp"  // NOLINT
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+/** @brief Vertex positions and triangle indices of a mesh to compress. */
+struct IndexedMesh {
+  std::vector<glm::vec3> positions;
+  std::vector<std::uint32_t> indices;
+};
+
+/** @brief Creates a square grid with two triangles per cell. */
+IndexedMesh CreateGrid(const std::uint32_t size) {
+  IndexedMesh mesh;
+  for (std::uint32_t y = 0; y <= size; ++y) {
+    for (std::uint32_t x = 0; x <= size; ++x) mesh.positions.emplace_back(x, y, 0.1f * static_cast<float>(x * y));
+  }
+  for (std::uint32_t y = 0; y < size; ++y) {
+    for (std::uint32_t x = 0; x < size; ++x) {
+      const auto v0 = y * (size + 1) + x;
+      const auto v2 = v0 + size + 1;
+      mesh.indices.insert(mesh.indices.end(), {v0, v0 + 1, v2 + 1, v0, v2 + 1, v2});
+    }
+  }
+  return mesh;
+}
+
+/** @brief Creates a closed torus with two triangles per cell of a grid wrapped around both of its circles. */
+IndexedMesh CreateTorus(const std::uint32_t major_segments, const std::uint32_t minor_segments) {
+  IndexedMesh mesh;
+  for (std::uint32_t i = 0; i < major_segments; ++i) {
+    const auto theta = 2.0f * std::numbers::pi_v<float> * static_cast<float>(i) / static_cast<float>(major_segments);
+    for (std::uint32_t j = 0; j < minor_segments; ++j) {
+      const auto phi = 2.0f * std::numbers::pi_v<float> * static_cast<float>(j) / static_cast<float>(minor_segments);
+      const auto radius = 1.0f + 0.25f * std::cos(phi);
+      mesh.positions.emplace_back(radius * std::cos(theta), radius * std::sin(theta), 0.25f * std::sin(phi));
+    }
+  }
+  for (std::uint32_t i = 0; i < major_segments; ++i) {
+    for (std::uint32_t j = 0; j < minor_segments; ++j) {
+      const auto v0 = i * minor_segments + j;
+      const auto v1 = (i + 1) % major_segments * minor_segments + j;
+      const auto v2 = i * minor_segments + (j + 1) % minor_segments;
+      const auto v3 = (i + 1) % major_segments * minor_segments + (j + 1) % minor_segments;
+      mesh.indices.insert(mesh.indices.end(), {v0, v1, v3, v0, v3, v2});
+    }
+  }
+  return mesh;
+}
+
+/** @brief Creates two tetrahedra that share a single non-manifold vertex and a vertex without triangles. */
+IndexedMesh CreateBowtie() {
+  return IndexedMesh{.positions = {{0.0f, 0.0f, 0.0f},
+                                   {1.0f, 0.0f, 0.0f},
+                                   {0.0f, 1.0f, 0.0f},
+                                   {0.0f, 0.0f, 1.0f},
+                                   {-1.0f, 0.0f, 0.0f},
+                                   {0.0f, -1.0f, 0.0f},
+                                   {0.0f, 0.0f, -1.0f},
+                                   {2.0f, 2.0f, 2.0f}},
+                     .indices = {0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 3, 0, 5, 4, 0, 4, 6, 0, 6, 5, 4, 5, 6}};
+}
+
+/** @brief Gets triangles rotated to start at their smallest index and sorted so that they can be compared. */
+std::vector<std::array<std::uint32_t, 3>> GetTriangles(const std::span<const std::uint32_t> indices) {
+  std::vector<std::array<std::uint32_t, 3>> triangles;
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    std::array triangle{indices[i], indices[i + 1], indices[i + 2]};
+    std::ranges::rotate(triangle, std::ranges::min_element(triangle));
+    triangles.push_back(triangle);
+  }
+  std::ranges::sort(triangles);
+  return triangles;
+}
+
+/** @brief Compresses a mesh and verifies that decompressing it recovers its positions and oriented triangles. */
+edgebreaker::DecodedMesh VerifyRoundTrip(const IndexedMesh& mesh, std::size_t* const compressed_size = nullptr) {
+  const HalfEdgeMesh half_edge_mesh{mesh.positions, {}, {}, mesh.indices};
+  std::stringstream ss;
+  edgebreaker::Encode(ss, half_edge_mesh);
+  if (compressed_size != nullptr) *compressed_size = ss.str().size();
+  auto decoded_mesh = edgebreaker::Decode(ss);
+
+  // vertices are reordered by the traversal so each decoded vertex is matched to the nearest original vertex
+  EXPECT_EQ(mesh.positions.size(), decoded_mesh.positions.size());
+  std::vector<std::uint32_t> original_indices;
+  for (const auto& position : decoded_mesh.positions) {
+    const auto nearest = std::ranges::min_element(mesh.positions, {}, [&](const glm::vec3& original_position) {
+      return glm::distance(position, original_position);
+    });
+    EXPECT_NEAR(0.0f, glm::distance(position, *nearest), 1.0e-3f);
+    original_indices.push_back(static_cast<std::uint32_t>(nearest - mesh.positions.begin()));
+  }
+
+  std::vector<std::uint32_t> indices;
+  for (const auto index : decoded_mesh.indices) indices.push_back(original_indices.at(index));
+  EXPECT_EQ(GetTriangles(mesh.indices), GetTriangles(indices));
+
+  return decoded_mesh;
+}
+
+TEST(EdgebreakerTest, TestRoundTripOpenMesh) { VerifyRoundTrip(CreateGrid(6)); }
+
+TEST(EdgebreakerTest, TestRoundTripClosedMeshWithHandle) { VerifyRoundTrip(CreateTorus(24, 12)); }
+
+TEST(EdgebreakerTest, TestRoundTripNonManifoldMeshWithIsolatedVertex) { VerifyRoundTrip(CreateBowtie()); }
+
+TEST(EdgebreakerTest, TestRoundTripMultipleComponents) {
+  auto mesh = CreateGrid(3);
+  const auto torus = CreateTorus(8, 6);
+  const auto vertex_offset = static_cast<std::uint32_t>(mesh.positions.size());
+  for (const auto& position : torus.positions) mesh.positions.push_back(position + glm::vec3{10.0f});
+  for (const auto index : torus.indices) mesh.indices.push_back(index + vertex_offset);
+
+  VerifyRoundTrip(mesh);
+}
+
+TEST(EdgebreakerTest, TestRoundTripPreservesModelTransform) {
+  const auto mesh = CreateGrid(2);
+  const auto model_transform = glm::translate(glm::mat4{1.0f}, glm::vec3{1.0f, 2.0f, 3.0f});
+  const HalfEdgeMesh half_edge_mesh{mesh.positions, {}, {}, mesh.indices, model_transform};
+  std::stringstream ss;
+  edgebreaker::Encode(ss, half_edge_mesh);
+  EXPECT_EQ(model_transform, edgebreaker::Decode(ss).model_transform);
+}
+
+TEST(EdgebreakerTest, TestCompressionRate) {
+  const auto torus = CreateTorus(128, 64);
+  std::size_t compressed_size = 0;
+  VerifyRoundTrip(torus, &compressed_size);
+
+  // an indexed triangle list with float positions takes 144 bits per triangle on a closed mesh of genus 1
+  const auto triangle_count = static_cast<double>(torus.indices.size() / 3);
+  const auto bits_per_triangle = 8.0 * static_cast<double>(compressed_size) / triangle_count;
+  EXPECT_LT(bits_per_triangle, 16.0);
+}
+
+TEST(EdgebreakerTest, TestEncodeInvalidQuantizationBits) {
+  const auto mesh = CreateGrid(1);
+  const HalfEdgeMesh half_edge_mesh{mesh.positions, {}, {}, mesh.indices};
+  std::stringstream ss;
+  EXPECT_THROW(edgebreaker::Encode(ss, half_edge_mesh, 0), std::invalid_argument);
+  EXPECT_THROW(edgebreaker::Encode(ss, half_edge_mesh, edgebreaker::kMaxQuantizationBits + 1), std::invalid_argument);
+}
+
+TEST(EdgebreakerTest, TestDecodeInvalidStream) {
+  std::stringstream invalid_magic{"GFXMESH"};
+  EXPECT_THROW(std::ignore = edgebreaker::Decode(invalid_magic), std::runtime_error);
+
+  const auto mesh = CreateGrid(3);
+  const HalfEdgeMesh half_edge_mesh{mesh.positions, {}, {}, mesh.indices};
+  std::stringstream ss;
+  edgebreaker::Encode(ss, half_edge_mesh);
+  const auto contents = ss.str();
+  for (const auto size : {contents.size() / 2, contents.size() - 1}) {
+    std::stringstream truncated{contents.substr(0, size)};
+    EXPECT_THROW(std::ignore = edgebreaker::Decode(truncated), std::runtime_error);
+  }
+}
+
+}  // namespace
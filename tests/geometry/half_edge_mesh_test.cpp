@@ -1,8 +1,17 @@
 #include "geometry/half_edge_mesh.cpp"  // NOLINT
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ranges>
+#include <set>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
-#include <GL/gl3w.h>
 #include <gtest/gtest.h>
 
 namespace {
@@ -34,7 +43,7 @@ protected:
   std::unordered_map<std::size_t, std::shared_ptr<Face>> faces_;
 };
 
-static Mesh CreateValidMesh() {
+static MeshData CreateValidMesh() {
   const std::vector<glm::vec3> positions{
       {1.0f, 0.0f, 0.0f},   // v0
       {2.0f, 0.0f, 0.0f},   // v1
@@ -48,7 +57,7 @@ static Mesh CreateValidMesh() {
       {0.0f, 0.0f, 0.0f}    // v9
   };
 
-  const std::vector<GLuint> indices{
+  const std::vector<std::uint32_t> indices{
       0, 2, 3,  // f0
       0, 3, 1,  // f1
       0, 1, 7,  // f2
@@ -61,7 +70,7 @@ static Mesh CreateValidMesh() {
       1, 6, 7   // f9
   };
 
-  return Mesh{positions, std::vector(10, glm::vec3{0.0f, 0.0f, 1.0f}), {}, indices};
+  return MeshData{positions, std::vector(10, glm::vec3{0.0f, 0.0f, 1.0f}), {}, indices};
 }
 
 HalfEdgeMesh MakeHalfEdgeMesh() {
@@ -91,7 +100,7 @@ void VerifyEdge(const std::shared_ptr<Vertex>& v0,
   EXPECT_EQ(edge10, edge10->flip()->flip());
 }
 
-void VerifyTriangles(const HalfEdgeMesh& half_edge_mesh, const std::vector<GLuint>& indices) {
+void VerifyTriangles(const HalfEdgeMesh& half_edge_mesh, const std::vector<std::uint32_t>& indices) {
   const auto& vertices = half_edge_mesh.vertices();
   const auto& edges = half_edge_mesh.edges();
   const auto& faces = half_edge_mesh.faces();
@@ -167,6 +176,297 @@ TEST_F(HalfEdgeMeshTest, TestCollapseEdge) {
                                    2, 10, 9});  // f7
 }
 
+TEST_F(HalfEdgeMeshTest, TestRemoveComponent) {
+  const std::vector<glm::vec3> positions{
+      {0.0f, 0.0f, 0.0f},  // v0
+      {1.0f, 0.0f, 0.0f},  // v1
+      {0.0f, 1.0f, 0.0f},  // v2
+      {0.0f, 0.0f, 1.0f},  // v3
+      {2.0f, 0.0f, 0.0f},  // v4
+      {3.0f, 0.0f, 0.0f},  // v5
+      {2.0f, 1.0f, 0.0f},  // v6
+      {2.0f, 0.0f, 1.0f}   // v7
+  };
+
+  const std::vector<std::uint32_t> indices{
+      0, 2, 1,  // f0
+      0, 1, 3,  // f1
+      0, 3, 2,  // f2
+      1, 2, 3,  // f3
+      4, 6, 5,  // f4
+      4, 5, 7,  // f5
+      4, 7, 6,  // f6
+      5, 6, 7   // f7
+  };
+
+  HalfEdgeMesh half_edge_mesh{MeshData{positions, {}, {}, indices}};
+  auto vertex_ids = half_edge_mesh.RemoveComponent(*half_edge_mesh.vertices().at(2));
+  std::ranges::sort(vertex_ids);
+
+  EXPECT_EQ(vertex_ids, (std::vector{0, 1, 2, 3}));
+  EXPECT_EQ(4, half_edge_mesh.vertices().size());
+  EXPECT_EQ(12, half_edge_mesh.edges().size());
+  EXPECT_EQ(4, half_edge_mesh.faces().size());
+
+  VerifyTriangles(half_edge_mesh, {4, 6, 5, 4, 5, 7, 4, 7, 6, 5, 6, 7});
+}
+
+TEST_F(HalfEdgeMeshTest, TestMerge) {
+  const std::vector<glm::vec3> positions{
+      {0.0f, 0.0f, 0.0f},  // v0
+      {1.0f, 0.0f, 0.0f},  // v1
+      {0.0f, 1.0f, 0.0f},  // v2
+      {0.0f, 0.0f, 1.0f},  // v3
+      {2.0f, 0.0f, 0.0f},  // v4
+      {3.0f, 0.0f, 0.0f},  // v5
+      {2.0f, 1.0f, 0.0f},  // v6
+      {2.0f, 0.0f, 1.0f}   // v7
+  };
+
+  const std::vector<std::uint32_t> indices{
+      0, 2, 1,  // f0
+      0, 1, 3,  // f1
+      0, 3, 2,  // f2
+      1, 2, 3,  // f3
+      4, 6, 5,  // f4
+      4, 5, 7,  // f5
+      4, 7, 6,  // f6
+      5, 6, 7   // f7
+  };
+
+  HalfEdgeMesh half_edge_mesh{MeshData{positions, {}, {}, indices}};
+  const auto& vertices = half_edge_mesh.vertices();
+  half_edge_mesh.Merge(*vertices.at(1), *vertices.at(4), std::make_shared<Vertex>(8, glm::vec3{1.5f, 0.0f, 0.0f}));
+
+  EXPECT_EQ(7, vertices.size());
+  EXPECT_EQ(24, half_edge_mesh.edges().size());
+  EXPECT_EQ(8, half_edge_mesh.faces().size());
+  EXPECT_EQ(half_edge_mesh.locked_vertices(), (std::unordered_set{8}));
+
+  VerifyTriangles(half_edge_mesh, {0, 2, 8, 0, 8, 3, 0, 3, 2, 2, 3, 8, 5, 8, 6, 5, 7, 8, 6, 8, 7, 5, 6, 7});
+}
+
+TEST_F(HalfEdgeMeshTest, TestLockBoundary) {
+  auto half_edge_mesh = MakeHalfEdgeMesh();
+  half_edge_mesh.LockBoundary();
+
+  EXPECT_EQ(half_edge_mesh.locked_vertices(), (std::unordered_set{2, 3, 4, 5, 6, 7, 8, 9}));
+  EXPECT_FALSE(half_edge_mesh.IsLocked(*half_edge_mesh.vertices().at(0)));
+  EXPECT_FALSE(half_edge_mesh.IsLocked(*half_edge_mesh.vertices().at(1)));
+}
+
+TEST(HalfEdgeMeshLockTest, TestLockBoundaryLocksVertexJoiningTwoFans) {
+  // two closed tetrahedra joined at a single vertex
+  const std::vector<glm::vec3> positions{
+      {0.0f, 0.0f, 0.0f},   // v0
+      {1.0f, 0.0f, 0.0f},   // v1
+      {0.0f, 1.0f, 0.0f},   // v2
+      {0.0f, 0.0f, 1.0f},   // v3
+      {-1.0f, 0.0f, 0.0f},  // v4
+      {0.0f, -1.0f, 0.0f},  // v5
+      {0.0f, 0.0f, -1.0f}   // v6
+  };
+
+  const std::vector<std::uint32_t> indices{
+      0, 2, 1,  // f0
+      0, 1, 3,  // f1
+      0, 3, 2,  // f2
+      1, 2, 3,  // f3
+      0, 4, 5,  // f4
+      0, 6, 4,  // f5
+      0, 5, 6,  // f6
+      4, 6, 5   // f7
+  };
+
+  HalfEdgeMesh half_edge_mesh{MeshData{positions, {}, {}, indices}};
+  half_edge_mesh.LockBoundary();
+
+  EXPECT_EQ(half_edge_mesh.locked_vertices(), (std::unordered_set{0}));
+}
+
+TEST_F(HalfEdgeMeshTest, TestWriteAndReadHalfEdgeMesh) {
+  auto half_edge_mesh = MakeHalfEdgeMesh();
+  half_edge_mesh.LockBoundary();
+
+  std::stringstream stream;
+  half_edge_mesh.Write(stream);
+  const HalfEdgeMesh read_half_edge_mesh{stream};
+
+  EXPECT_EQ(half_edge_mesh.locked_vertices(), read_half_edge_mesh.locked_vertices());
+  EXPECT_EQ(half_edge_mesh.edges().size(), read_half_edge_mesh.edges().size());
+  ASSERT_EQ(half_edge_mesh.faces().size(), read_half_edge_mesh.faces().size());
+  for (const auto face_key : half_edge_mesh.faces() | std::views::keys) {
+    EXPECT_TRUE(read_half_edge_mesh.faces().contains(face_key));
+  }
+
+  // each vertex refers to the same half-edge so that traversal around it begins in the same place
+  ASSERT_EQ(half_edge_mesh.vertices().size(), read_half_edge_mesh.vertices().size());
+  for (const auto& [vertex_id, vertex] : half_edge_mesh.vertices()) {
+    const auto& read_vertex = read_half_edge_mesh.vertices().at(vertex_id);
+    EXPECT_EQ(vertex->position(), read_vertex->position());
+    EXPECT_EQ(hash_value(*vertex->edge()), hash_value(*read_vertex->edge()));
+  }
+}
+
+TEST(HalfEdgeMeshReadTest, TestReadTruncatedHalfEdgeMeshThrowsException) {
+  std::stringstream stream{"truncated"};
+  EXPECT_THROW(HalfEdgeMesh{stream}, std::runtime_error);
+}
+
+TEST_F(HalfEdgeMeshTest, TestLockVertex) {
+  auto half_edge_mesh = MakeHalfEdgeMesh();
+  half_edge_mesh.Lock(0);
+
+  EXPECT_TRUE(half_edge_mesh.IsLocked(*half_edge_mesh.vertices().at(0)));
+  EXPECT_EQ(1, half_edge_mesh.locked_vertices().size());
+}
+
+TEST_F(HalfEdgeMeshTest, TestLockInvalidVertexThrowsException) {
+  auto half_edge_mesh = MakeHalfEdgeMesh();
+  EXPECT_THROW(half_edge_mesh.Lock(10), std::invalid_argument);
+}
+
+TEST_F(HalfEdgeMeshTest, TestConvertOpenMeshToMesh) {
+  const auto half_edge_mesh = MakeHalfEdgeMesh();
+  const auto mesh = static_cast<MeshData>(half_edge_mesh);
+
+  EXPECT_EQ(10, mesh.positions().size());
+  EXPECT_EQ(30, mesh.indices().size());
+  for (const auto& normal : mesh.normals()) {
+    EXPECT_FLOAT_EQ(1.0f, normal.z);
+  }
+}
+
+TEST_F(HalfEdgeMeshTest, TestConvertToMeshIsIndependentOfTriangleOrder) {
+  const auto mesh = static_cast<MeshData>(MakeHalfEdgeMesh());
+
+  // reversing the order of triangles inserts faces into the half-edge mesh in a different order
+  std::vector<std::uint32_t> reversed_indices;
+  for (auto i = mesh.indices().size(); i >= 3; i -= 3) {
+    const auto face = std::span{mesh.indices()}.subspan(i - 3, 3);
+    reversed_indices.insert(reversed_indices.end(), face.begin(), face.end());
+  }
+  const auto expected_mesh = static_cast<MeshData>(HalfEdgeMesh{MeshData{mesh.positions(), {}, {}, mesh.indices()}});
+  const auto actual_mesh = static_cast<MeshData>(HalfEdgeMesh{MeshData{mesh.positions(), {}, {}, reversed_indices}});
+
+  EXPECT_EQ(expected_mesh.positions(), actual_mesh.positions());
+  EXPECT_EQ(expected_mesh.normals(), actual_mesh.normals());
+  EXPECT_EQ(expected_mesh.indices(), actual_mesh.indices());
+}
+
+/** @brief Creates two triangles that share an edge split at a texture seam into separate mesh vertices. */
+MeshData CreateSeamMesh() {
+  const std::vector<glm::vec3> positions{
+      {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f},  // left triangle
+      {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}   // right triangle
+  };
+  const std::vector<glm::vec2> texcoords{
+      {0.0f, 0.0f}, {0.5f, 0.0f}, {0.0f, 0.5f}, {0.5f, 0.5f}, {1.0f, 1.0f}, {0.5f, 1.0f}};
+  const std::vector<std::uint32_t> indices{0, 1, 2, 3, 4, 5};
+  return MeshData{positions, {}, texcoords, indices};
+}
+
+TEST(HalfEdgeMeshWedgeTest, TestCreateHalfEdgeMeshWeldsVerticesAtAttributeSeam) {
+  const auto mesh = CreateSeamMesh();
+  const HalfEdgeMesh half_edge_mesh{mesh};
+
+  EXPECT_EQ(4, half_edge_mesh.vertices().size());
+  EXPECT_EQ(5, half_edge_mesh.edges().size() / 2);
+  EXPECT_EQ(6, half_edge_mesh.wedges().size());
+  EXPECT_TRUE(half_edge_mesh.has_texcoords());
+  EXPECT_FALSE(half_edge_mesh.has_normals());
+  EXPECT_EQ((std::vector{0, 1, 2, 1, 4, 2}), HalfEdgeMesh::GetCornerVertexIds(mesh));
+
+  // the shared edge has a triangle on both sides so it is no longer a boundary
+  const auto& edge12 = half_edge_mesh.edges().at(hash_value(*half_edge_mesh.vertices().at(1),
+                                                            *half_edge_mesh.vertices().at(2)));
+  EXPECT_FALSE(edge12->is_boundary());
+  EXPECT_FALSE(edge12->flip()->is_boundary());
+}
+
+TEST(HalfEdgeMeshWedgeTest, TestConvertHalfEdgeMeshWithWedgesToMeshPreservesAttributeSeam) {
+  const auto mesh = CreateSeamMesh();
+  const HalfEdgeMesh half_edge_mesh{mesh};
+  const auto converted_mesh = static_cast<MeshData>(half_edge_mesh);
+
+  ASSERT_EQ(6, converted_mesh.positions().size());
+  ASSERT_EQ(6, converted_mesh.texcoords().size());
+  ASSERT_EQ(6, converted_mesh.normals().size());
+  EXPECT_EQ((std::vector{0, 1, 1, 2, 2, 4}), half_edge_mesh.GetMeshVertexIds());
+
+  // every triangle corner keeps the position and texture coordinates it had in the original mesh
+  std::multiset<std::pair<std::array<float, 3>, std::array<float, 2>>> expected_corners, actual_corners;
+  const auto insert_corners = [](const MeshData& corner_mesh, auto& corners) {
+    for (const auto index : corner_mesh.indices()) {
+      const auto& position = corner_mesh.positions()[index];
+      const auto& texcoord = corner_mesh.texcoords()[index];
+      corners.emplace(std::array{position.x, position.y, position.z}, std::array{texcoord.x, texcoord.y});
+    }
+  };
+  insert_corners(mesh, expected_corners);
+  insert_corners(converted_mesh, actual_corners);
+  EXPECT_EQ(expected_corners, actual_corners);
+
+  for (const auto& normal : converted_mesh.normals()) {
+    EXPECT_FLOAT_EQ(1.0f, normal.z);
+  }
+}
+
+TEST(HalfEdgeMeshWedgeTest, TestCreateHalfEdgeMeshFromAttributesMatchesMesh) {
+  const auto mesh = CreateSeamMesh();
+  const HalfEdgeMesh half_edge_mesh{mesh.positions(), mesh.normals(), mesh.texcoords(), mesh.indices()};
+
+  std::stringstream expected_stream, actual_stream;
+  HalfEdgeMesh{mesh}.Write(expected_stream);
+  half_edge_mesh.Write(actual_stream);
+  EXPECT_EQ(expected_stream.str(), actual_stream.str());
+  EXPECT_EQ(mesh.positions().size(), half_edge_mesh.GetNextVertexId());
+}
+
+TEST(HalfEdgeMeshWedgeTest, TestCreateHalfEdgeMeshFromInvalidAttributesThrowsException) {
+  const std::vector<glm::vec3> positions{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+  const std::vector<glm::vec2> texcoords{{0.0f, 0.0f}, {1.0f, 0.0f}};
+  EXPECT_THROW((HalfEdgeMesh{positions, {}, {}, std::vector<std::uint32_t>{0, 1}}), std::invalid_argument);
+  EXPECT_THROW((HalfEdgeMesh{positions, {}, {}, std::vector<std::uint32_t>{0, 1, 3}}), std::invalid_argument);
+  EXPECT_THROW((HalfEdgeMesh{positions, {}, texcoords, std::vector<std::uint32_t>{0, 1, 2}}), std::invalid_argument);
+}
+
+TEST(HalfEdgeMeshWedgeTest, TestLockWeldedVertexLocksVertexItWasWeldedInto) {
+  HalfEdgeMesh half_edge_mesh{CreateSeamMesh()};
+  half_edge_mesh.Lock(3);
+
+  EXPECT_EQ(half_edge_mesh.locked_vertices(), (std::unordered_set{1}));
+}
+
+TEST(HalfEdgeMeshWedgeTest, TestDiscardAttributesRemovesWedges) {
+  HalfEdgeMesh half_edge_mesh{CreateSeamMesh()};
+  half_edge_mesh.DiscardAttributes(true, true);
+  const auto converted_mesh = static_cast<MeshData>(half_edge_mesh);
+
+  // vertices remain welded at the seam but each becomes a single mesh vertex without texture coordinates
+  EXPECT_FALSE(half_edge_mesh.has_texcoords());
+  EXPECT_TRUE(half_edge_mesh.wedges().empty());
+  EXPECT_EQ(4, converted_mesh.positions().size());
+  EXPECT_TRUE(converted_mesh.texcoords().empty());
+  for (const auto& edge : half_edge_mesh.edges() | std::views::values) EXPECT_EQ(-1, edge->wedge());
+}
+
+TEST(HalfEdgeMeshWedgeTest, TestWriteAndReadHalfEdgeMeshPreservesWedges) {
+  const HalfEdgeMesh half_edge_mesh{CreateSeamMesh()};
+
+  std::stringstream stream;
+  half_edge_mesh.Write(stream);
+  const HalfEdgeMesh read_half_edge_mesh{stream};
+
+  EXPECT_TRUE(read_half_edge_mesh.has_texcoords());
+  EXPECT_FALSE(read_half_edge_mesh.has_normals());
+  ASSERT_EQ(half_edge_mesh.wedges().size(), read_half_edge_mesh.wedges().size());
+  for (const auto& [edge_key, edge] : half_edge_mesh.edges()) {
+    EXPECT_EQ(edge->wedge(), read_half_edge_mesh.edges().at(edge_key)->wedge());
+  }
+  EXPECT_EQ(half_edge_mesh.GetMeshVertexIds(), read_half_edge_mesh.GetMeshVertexIds());
+}
+
 TEST_F(HalfEdgeMeshTest, TestGetHalfEdge) {
   EXPECT_EQ(edge01_, GetHalfEdge(*v0_, *v1_, edges_));
   EXPECT_EQ(edge10_, GetHalfEdge(*v1_, *v0_, edges_));
@@ -0,0 +1,108 @@
+#include "geometry/mesh_data.cpp"  // NOLINT
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+TEST(MeshDataTest, TestValidateMeshWithInvalidNumberOfPositions) {
+  for (auto i = 0; i <= 4; ++i) {
+    if (i != 3) {
+      EXPECT_THROW((MeshData{std::vector<glm::vec3>(i), {}, {}, {}}), std::invalid_argument);
+    }
+  }
+}
+
+TEST(MeshDataTest, TestValidateMeshWithInvalidNumberOfTextureCoordinates) {
+  const std::vector<glm::vec3> positions(3);
+  for (auto i = 1; i <= 4; ++i) {
+    if (i != 3) {
+      EXPECT_THROW((MeshData{positions, {}, std::vector<glm::vec2>(i), {}}), std::invalid_argument);
+    }
+  }
+}
+
+TEST(MeshDataTest, TestValidateMeshInvalidNumberOfNormals) {
+  const std::vector<glm::vec3> positions(3);
+  for (auto i = 1; i <= 4; ++i) {
+    if (i != 3) {
+      EXPECT_THROW((MeshData{positions, std::vector<glm::vec3>(i), {}, {}}), std::invalid_argument);
+    }
+  }
+}
+
+TEST(MeshDataTest, TestValidateMeshWithInvalidIndices) {
+  const std::vector<glm::vec3> positions(3);
+  for (auto i = 1; i <= 4; ++i) {
+    if (i != 3) {
+      EXPECT_THROW((MeshData{positions, {}, {}, std::vector<std::uint32_t>(i)}), std::invalid_argument);
+    }
+  }
+}
+
+TEST(MeshDataTest, TestValidateMeshWithCorrectNumberOfPositionsTextureCoordinatesAndNormals) {
+  const std::vector<glm::vec3> positions(3);
+  const std::vector<glm::vec3> normals(3);
+  const std::vector<glm::vec2> texcoords(3);
+  EXPECT_NO_THROW((MeshData{positions, normals, texcoords, {}}));
+}
+
+TEST(MeshDataTest, TestValidateMeshWithCorrectNumberOfPositionsTextureCoordinatesNormalsAndIndices) {
+  const std::vector<glm::vec3> positions(4);
+  const std::vector<glm::vec3> normals(5);
+  const std::vector<glm::vec2> texcoords(2);
+  const std::vector<std::uint32_t> indices(3);
+  EXPECT_NO_THROW((MeshData{positions, normals, texcoords, indices}));
+}
+
+TEST(MeshDataTest, TestCreateMeshMovesVertexAttributesAndIndices) {
+  std::vector<glm::vec3> positions(3);
+  std::vector<std::uint32_t> indices{0, 1, 2};
+  const auto* const positions_data = positions.data();
+  const auto* const indices_data = indices.data();
+  const auto model_transform = glm::translate(glm::mat4{1.0f}, glm::vec3{1.0f, 2.0f, 3.0f});
+
+  const MeshData mesh{std::move(positions), {}, {}, std::move(indices), model_transform};
+
+  EXPECT_EQ(mesh.positions().data(), positions_data);
+  EXPECT_EQ(mesh.indices().data(), indices_data);
+  EXPECT_EQ(mesh.model_transform(), model_transform);
+}
+
+TEST(MeshDataTest, TestResizeIndices) {
+  MeshData mesh{std::vector<glm::vec3>(3), {}, {}, {0, 1, 2}};
+
+  mesh.ResizeIndices(6);
+  EXPECT_EQ(mesh.indices(), (std::vector<std::uint32_t>{0, 1, 2, 0, 0, 0}));
+
+  mesh.ResizeIndices(0);
+  EXPECT_TRUE(mesh.indices().empty());
+}
+
+TEST(MeshDataTest, TestResizeIndicesWithInvalidSize) {
+  MeshData mesh{std::vector<glm::vec3>(3), {}, {}, {0, 1, 2}};
+  EXPECT_THROW(mesh.ResizeIndices(2), std::invalid_argument);
+  EXPECT_EQ(mesh.indices().size(), 3);
+}
+
+TEST(MeshDataTest, TestUpdateIndices) {
+  MeshData mesh{std::vector<glm::vec3>(3), {}, {}, {0, 1, 2, 0, 1, 2}};
+  mesh.UpdateIndices(3, std::vector<std::uint32_t>{2, 1, 0});
+  EXPECT_EQ(mesh.indices(), (std::vector<std::uint32_t>{0, 1, 2, 2, 1, 0}));
+}
+
+TEST(MeshDataTest, TestUpdateIndicesOutOfRange) {
+  MeshData mesh{std::vector<glm::vec3>(3), {}, {}, {0, 1, 2}};
+  const std::vector<std::uint32_t> indices{0, 1, 2};
+  EXPECT_THROW(mesh.UpdateIndices(1, indices), std::out_of_range);
+  EXPECT_THROW(mesh.UpdateIndices(4, {}), std::out_of_range);
+}
+
+}  // namespace
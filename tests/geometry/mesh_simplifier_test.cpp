@@ -0,0 +1,606 @@
+#include "geometry/mesh_simplifier.cpp"  // NOLINT
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <ranges>
+#include <set>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test_meshes.h"
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+/**
+ * @brief Creates a closed mesh with texture coordinates and normals by splitting each vertex on the equator of a
+ *        subdivided octahedron into separate mesh vertices for the upper and lower hemisphere. Texture coordinates are
+ *        the xy position offset by two in the lower hemisphere so that each side of the seam maps to a different chart.
+ */
+MeshData CreateTexturedOctahedron(const int subdivisions) {
+  const auto sphere = test::CreateSubdividedOctahedron(subdivisions);
+  std::vector<glm::vec3> positions, normals;
+  std::vector<glm::vec2> texcoords;
+  std::vector<std::uint32_t> indices;
+  std::map<std::pair<std::uint32_t, bool>, std::uint32_t> index_map;
+
+  for (std::size_t i = 0; i < sphere.indices().size(); i += 3) {
+    const auto face = std::span{sphere.indices()}.subspan(i, 3);
+    const auto is_lower =
+        std::ranges::any_of(face, [&](const auto index) { return sphere.positions()[index].z < 0.0f; });
+
+    for (const auto index : face) {
+      const auto [iterator, inserted] =
+          index_map.try_emplace(std::pair{index, is_lower}, static_cast<std::uint32_t>(positions.size()));
+      if (inserted) {
+        const auto& position = sphere.positions()[index];
+        positions.push_back(position);
+        normals.push_back(position);
+        texcoords.emplace_back(position.x + (is_lower ? 2.0f : 0.0f), position.y);
+      }
+      indices.push_back(iterator->second);
+    }
+  }
+
+  return MeshData{positions, normals, texcoords, indices};
+}
+
+/** @brief Gets simplifier options that preserve texture coordinates and normals. */
+SimplifierOptions GetAttributeOptions() {
+  SimplifierOptions options;
+  options.texcoord_weight = 1.0f;
+  options.normal_weight = 1.0f;
+  return options;
+}
+
+/** @brief Verifies two half-edge meshes have the same vertex IDs, vertex positions, and triangles. */
+void VerifyEqual(const HalfEdgeMesh& expected, const HalfEdgeMesh& actual) {
+  ASSERT_EQ(expected.vertices().size(), actual.vertices().size());
+  for (const auto& [vertex_id, vertex] : expected.vertices()) {
+    const auto iterator = actual.vertices().find(vertex_id);
+    ASSERT_NE(iterator, actual.vertices().end());
+    EXPECT_EQ(vertex->position(), iterator->second->position());
+  }
+
+  const auto get_triangles = [](const HalfEdgeMesh& half_edge_mesh) {
+    std::set<std::array<int, 3>> triangles;
+    for (const auto& face : half_edge_mesh.faces() | std::views::values) {
+      triangles.insert(std::array{face->v0()->id(), face->v1()->id(), face->v2()->id()});
+    }
+    return triangles;
+  };
+  EXPECT_EQ(get_triangles(expected), get_triangles(actual));
+}
+
+class MeshSimplifierCheckpointTest : public testing::TestWithParam<std::size_t> {
+protected:
+  MeshSimplifierCheckpointTest()
+      : directory_{std::filesystem::path{testing::TempDir()} / "mesh_simplifier_test"},
+        checkpoint_path_{directory_ / "mesh_simplifier_test.checkpoint"} {
+    std::filesystem::create_directories(directory_);
+  }
+
+  ~MeshSimplifierCheckpointTest() override { std::filesystem::remove_all(directory_); }
+
+  std::filesystem::path directory_;
+  std::filesystem::path checkpoint_path_;
+};
+
+TEST_P(MeshSimplifierCheckpointTest, TestResumeFromCheckpointMatchesUninterruptedSimplification) {
+  const auto mesh = test::CreateSubdividedOctahedron(4);
+  SimplifierOptions options;
+  options.approximate_queue_samples = GetParam();
+
+  MeshSimplifier uninterrupted_mesh_simplifier{mesh, nullptr, options};
+  uninterrupted_mesh_simplifier.Simplify(128);
+
+  // simulate a process terminated after the last checkpoint by continuing past it before resuming from the checkpoint
+  options.checkpoint_interval = 300;
+  options.checkpoint_path = checkpoint_path_;
+  MeshSimplifier interrupted_mesh_simplifier{mesh, nullptr, options};
+  interrupted_mesh_simplifier.Simplify(1024);
+  ASSERT_TRUE(std::filesystem::exists(checkpoint_path_));
+
+  auto resumed_mesh_simplifier = MeshSimplifier::LoadCheckpoint(checkpoint_path_);
+  EXPECT_GT(resumed_mesh_simplifier.face_count(), interrupted_mesh_simplifier.face_count());
+  resumed_mesh_simplifier.Simplify(128);
+
+  VerifyEqual(uninterrupted_mesh_simplifier.half_edge_mesh(), resumed_mesh_simplifier.half_edge_mesh());
+  EXPECT_EQ(uninterrupted_mesh_simplifier.max_error(), resumed_mesh_simplifier.max_error());
+}
+
+INSTANTIATE_TEST_SUITE_P(ExactAndApproximateQueue, MeshSimplifierCheckpointTest, testing::Values(0, 8));
+
+TEST_F(MeshSimplifierCheckpointTest, TestSaveAndLoadCheckpointPreservesState) {
+  const auto mesh = test::CreateSubdividedOctahedron(2);
+  MeshSimplifier mesh_simplifier{mesh};
+  mesh_simplifier.Simplify(64);
+  mesh_simplifier.SaveCheckpoint(checkpoint_path_);
+
+  const auto loaded_mesh_simplifier = MeshSimplifier::LoadCheckpoint(checkpoint_path_);
+
+  VerifyEqual(mesh_simplifier.half_edge_mesh(), loaded_mesh_simplifier.half_edge_mesh());
+  EXPECT_EQ(mesh_simplifier.max_error(), loaded_mesh_simplifier.max_error());
+  EXPECT_EQ(1, std::distance(std::filesystem::directory_iterator{directory_}, std::filesystem::directory_iterator{}));
+}
+
+TEST_F(MeshSimplifierCheckpointTest, TestResumeFromCheckpointWithAttributesMatchesUninterruptedSimplification) {
+  const auto mesh = CreateTexturedOctahedron(3);
+  MeshSimplifier uninterrupted_mesh_simplifier{mesh, nullptr, GetAttributeOptions()};
+  uninterrupted_mesh_simplifier.Simplify(64);
+
+  MeshSimplifier interrupted_mesh_simplifier{mesh, nullptr, GetAttributeOptions()};
+  interrupted_mesh_simplifier.Simplify(256);
+  interrupted_mesh_simplifier.SaveCheckpoint(checkpoint_path_);
+  auto resumed_mesh_simplifier = MeshSimplifier::LoadCheckpoint(checkpoint_path_);
+  resumed_mesh_simplifier.Simplify(64);
+
+  VerifyEqual(uninterrupted_mesh_simplifier.half_edge_mesh(), resumed_mesh_simplifier.half_edge_mesh());
+  const auto uninterrupted_mesh = static_cast<MeshData>(uninterrupted_mesh_simplifier.half_edge_mesh());
+  const auto resumed_mesh = static_cast<MeshData>(resumed_mesh_simplifier.half_edge_mesh());
+  EXPECT_EQ(uninterrupted_mesh.texcoords(), resumed_mesh.texcoords());
+  EXPECT_EQ(uninterrupted_mesh.normals(), resumed_mesh.normals());
+}
+
+TEST_F(MeshSimplifierCheckpointTest, TestResumeFromCheckpointWithMaxDeviationMatchesUninterruptedSimplification) {
+  const auto mesh = test::CreateSubdividedOctahedron(3);
+  SimplifierOptions options;
+  options.max_deviation = 0.02f;
+  MeshSimplifier uninterrupted_mesh_simplifier{mesh, nullptr, options};
+  uninterrupted_mesh_simplifier.Simplify(0);
+
+  MeshSimplifier interrupted_mesh_simplifier{mesh, nullptr, options};
+  interrupted_mesh_simplifier.Simplify(256);
+  interrupted_mesh_simplifier.SaveCheckpoint(checkpoint_path_);
+  auto resumed_mesh_simplifier = MeshSimplifier::LoadCheckpoint(checkpoint_path_);
+  EXPECT_EQ(interrupted_mesh_simplifier.GetDeviation(), resumed_mesh_simplifier.GetDeviation());
+  resumed_mesh_simplifier.Simplify(0);
+
+  VerifyEqual(uninterrupted_mesh_simplifier.half_edge_mesh(), resumed_mesh_simplifier.half_edge_mesh());
+  EXPECT_EQ(uninterrupted_mesh_simplifier.GetDeviation(), resumed_mesh_simplifier.GetDeviation());
+}
+
+TEST_F(MeshSimplifierCheckpointTest, TestLoadInvalidCheckpointThrowsException) {
+  std::ofstream{checkpoint_path_} << "not a checkpoint";
+  EXPECT_THROW((void)MeshSimplifier::LoadCheckpoint(checkpoint_path_), std::runtime_error);
+}
+
+TEST_F(MeshSimplifierCheckpointTest, TestLoadTruncatedCheckpointThrowsException) {
+  MeshSimplifier{test::CreateSubdividedOctahedron(1)}.SaveCheckpoint(checkpoint_path_);
+  std::filesystem::resize_file(checkpoint_path_, std::filesystem::file_size(checkpoint_path_) / 2);
+  EXPECT_THROW((void)MeshSimplifier::LoadCheckpoint(checkpoint_path_), std::runtime_error);
+}
+
+TEST_F(MeshSimplifierCheckpointTest, TestSaveCheckpointWhileRecordingProgressiveMeshThrowsException) {
+  const auto mesh = test::CreateSubdividedOctahedron(1);
+  ProgressiveMesh progressive_mesh{mesh};
+  const MeshSimplifier mesh_simplifier{mesh, &progressive_mesh};
+  EXPECT_THROW(mesh_simplifier.SaveCheckpoint(checkpoint_path_), std::logic_error);
+}
+
+TEST(MeshSimplifierTest, TestSimplifyMeshWithAttributeSeamPreservesAttributes) {
+  const auto mesh = CreateTexturedOctahedron(4);
+  // throws if the seam were not welded because the mesh would have a boundary
+  MeshSimplifier mesh_simplifier{mesh, nullptr, GetAttributeOptions()};
+  mesh_simplifier.Simplify(mesh.indices().size() / 3 / 4);
+  const auto simplified_mesh = static_cast<MeshData>(mesh_simplifier.half_edge_mesh());
+
+  const auto& positions = simplified_mesh.positions();
+  ASSERT_EQ(positions.size(), simplified_mesh.texcoords().size());
+  ASSERT_EQ(positions.size(), simplified_mesh.normals().size());
+  EXPECT_LT(simplified_mesh.indices().size(), mesh.indices().size() / 2);
+
+  // each texture coordinate stays on the chart of one side of the seam and remains close to its linear mapping
+  std::map<std::array<float, 3>, std::multiset<float>> position_offsets;
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    const auto& position = positions[i];
+    const auto& texcoord = simplified_mesh.texcoords()[i];
+    const auto offset = texcoord.x - position.x > 1.0f ? 2.0f : 0.0f;
+    EXPECT_NEAR(position.x + offset, texcoord.x, 0.05f);
+    EXPECT_NEAR(position.y, texcoord.y, 0.05f);
+    EXPECT_GT(glm::dot(glm::normalize(position), simplified_mesh.normals()[i]), 0.95f);
+    position_offsets[std::array{position.x, position.y, position.z}].insert(offset);
+  }
+
+  // vertices remaining on the seam are still split into one mesh vertex for each chart while wedges that meet across
+  // a contracted edge are merged so that few other vertices are split
+  const auto seam_vertex_count = std::ranges::count_if(position_offsets | std::views::values, [](const auto& offsets) {
+    return std::set(offsets.begin(), offsets.end()).size() == 2;
+  });
+  EXPECT_GT(seam_vertex_count, 0);
+  EXPECT_LT(positions.size(), mesh_simplifier.half_edge_mesh().vertices().size() * 5 / 4);
+}
+
+TEST(MeshSimplifierTest, TestSimplifyMeshWithAttributesRecordsProgressiveMesh) {
+  const auto mesh = CreateTexturedOctahedron(2);
+  ProgressiveMesh progressive_mesh{mesh};
+  MeshSimplifier mesh_simplifier{mesh, &progressive_mesh, GetAttributeOptions()};
+  mesh_simplifier.Simplify(mesh.indices().size() / 3 / 2);
+
+  progressive_mesh.SetFaceCount(mesh_simplifier.face_count());
+  EXPECT_EQ(mesh_simplifier.face_count(), progressive_mesh.face_count());
+}
+
+TEST(MeshSimplifierTest, TestReplayProgressiveMeshVertexSplitsRestoresMesh) {
+  const auto mesh = test::CreateSubdividedOctahedron(3);
+  const auto face_count = mesh.indices().size() / 3;
+  ProgressiveMesh progressive_mesh{mesh};
+  const auto simplified_mesh = mesh::Simplify(mesh, 0.75f, &progressive_mesh);
+  ASSERT_FALSE(progressive_mesh.vertex_splits().empty());
+
+  progressive_mesh.SetFaceCount(simplified_mesh.indices().size() / 3);
+  EXPECT_EQ(progressive_mesh.vertex_splits().size(), progressive_mesh.collapse_count());
+  EXPECT_EQ(simplified_mesh.indices().size() / 3, progressive_mesh.face_count());
+  EXPECT_EQ(simplified_mesh.positions().size(), progressive_mesh.ToMesh().positions().size());
+
+  // vertices are not split at seams in this mesh so vertex IDs are the original indices
+  std::unordered_set<VertexSplit::Face, ProgressiveMesh::FaceHash> faces;
+  for (std::size_t i = 0; i < mesh.indices().size(); i += 3) {
+    VertexSplit::Face face{static_cast<int>(mesh.indices()[i]),
+                           static_cast<int>(mesh.indices()[i + 1]),
+                           static_cast<int>(mesh.indices()[i + 2])};
+    std::ranges::rotate(face, std::ranges::min_element(face));
+    faces.insert(face);
+  }
+
+  const auto restored_mesh = progressive_mesh.Extract(face_count);
+  EXPECT_EQ(0, progressive_mesh.collapse_count());
+  EXPECT_EQ(face_count, progressive_mesh.face_count());
+  EXPECT_EQ(faces, progressive_mesh.faces());
+  EXPECT_EQ(mesh.positions().size(), restored_mesh.positions().size());
+  EXPECT_EQ(mesh.indices().size(), restored_mesh.indices().size());
+}
+
+TEST(MeshSimplifierTest, TestSimplifyHalfEdgeMeshMatchesMesh) {
+  const auto mesh = CreateTexturedOctahedron(3);
+  MeshSimplifier mesh_simplifier{mesh, nullptr, GetAttributeOptions()};
+  MeshSimplifier half_edge_mesh_simplifier{HalfEdgeMesh{mesh}, GetAttributeOptions()};
+  mesh_simplifier.Simplify(mesh.indices().size() / 3 / 4);
+  half_edge_mesh_simplifier.Simplify(mesh.indices().size() / 3 / 4);
+
+  std::stringstream expected_stream, actual_stream;
+  mesh_simplifier.half_edge_mesh().Write(expected_stream);
+  half_edge_mesh_simplifier.half_edge_mesh().Write(actual_stream);
+  EXPECT_EQ(expected_stream.str(), actual_stream.str());
+}
+
+TEST(MeshSimplifierTest, TestSimplifyWithoutAttributeWeightsDiscardsAttributes) {
+  const auto mesh = CreateTexturedOctahedron(3);
+  const MeshData untextured_mesh{mesh.positions(), {}, {}, mesh.indices()};
+  SimplifierOptions options;
+  options.lock_boundary = true;  // the seam is a boundary when vertices are not welded
+  const auto simplified_mesh = mesh::Simplify(mesh, 0.5f, nullptr, options);
+  const auto untextured_simplified_mesh = mesh::Simplify(untextured_mesh, 0.5f, nullptr, options);
+
+  // attributes are neither welded nor preserved unless they are weighted
+  EXPECT_TRUE(simplified_mesh.texcoords().empty());
+  EXPECT_EQ(untextured_simplified_mesh.positions(), simplified_mesh.positions());
+  EXPECT_EQ(untextured_simplified_mesh.normals(), simplified_mesh.normals());
+  EXPECT_EQ(untextured_simplified_mesh.indices(), simplified_mesh.indices());
+}
+
+TEST(MeshSimplifierTest, TestNegativeAttributeWeightThrowsException) {
+  SimplifierOptions options;
+  options.texcoord_weight = -1.0f;
+  EXPECT_THROW((MeshSimplifier{CreateTexturedOctahedron(1), nullptr, options}), std::invalid_argument);
+}
+
+TEST(MeshSimplifierTest, TestSimplifyPosesMatchSimplifiedMeshVertices) {
+  const auto mesh = test::CreateSubdividedOctahedron(3);
+  static constexpr glm::vec3 kTranslation{0.5f, -1.0f, 2.0f};
+
+  // error quadrics are invariant to translation so the optimal position of each vertex is translated with the pose
+  std::vector<glm::vec3> translated_pose;
+  for (const auto& position : mesh.positions()) translated_pose.push_back(position + kTranslation);
+  const std::array poses{translated_pose};
+
+  const auto [simplified_mesh, simplified_poses] = mesh::Simplify(mesh, poses, 0.75f);
+
+  ASSERT_EQ(1, simplified_poses.size());
+  ASSERT_EQ(simplified_mesh.positions().size(), simplified_poses[0].size());
+  EXPECT_LT(simplified_mesh.indices().size() / 3, mesh.indices().size() / 12);
+  EXPECT_GE(simplified_mesh.indices().size() / 3 + 2, mesh.indices().size() / 12);
+  for (std::size_t i = 0; i < simplified_mesh.positions().size(); ++i) {
+    const auto expected_position = simplified_mesh.positions()[i] + kTranslation;
+    EXPECT_NEAR(expected_position.x, simplified_poses[0][i].x, 1.0e-3f);
+    EXPECT_NEAR(expected_position.y, simplified_poses[0][i].y, 1.0e-3f);
+    EXPECT_NEAR(expected_position.z, simplified_poses[0][i].z, 1.0e-3f);
+  }
+}
+
+TEST(MeshSimplifierTest, TestSimplifyPosesBoundsErrorInEachPose) {
+  const auto mesh = test::CreateSubdividedOctahedron(3);
+  static constexpr glm::vec3 kScale{2.0f, 1.0f, 0.5f};
+
+  // the second pose stretches the sphere into an ellipsoid whose surface differs from the rest pose
+  std::vector<glm::vec3> stretched_pose;
+  for (const auto& position : mesh.positions()) stretched_pose.push_back(position * kScale);
+  const std::array poses{stretched_pose};
+
+  const auto [simplified_mesh, simplified_poses] = mesh::Simplify(mesh, poses, 0.75f);
+  ASSERT_EQ(1, simplified_poses.size());
+  ASSERT_EQ(simplified_mesh.positions().size(), simplified_poses[0].size());
+
+  for (const auto& position : simplified_mesh.positions()) {
+    EXPECT_NEAR(1.0f, glm::length(position), 0.1f);
+  }
+  for (const auto& position : simplified_poses[0]) {
+    EXPECT_NEAR(1.0f, glm::length(position / kScale), 0.1f);
+  }
+}
+
+TEST(MeshSimplifierTest, TestSimplifyPoseWithWrongVertexCountThrowsException) {
+  const auto mesh = test::CreateSubdividedOctahedron(1);
+  const std::array poses{std::vector<glm::vec3>(mesh.positions().size() - 1)};
+  EXPECT_THROW(std::ignore = mesh::Simplify(mesh, poses, 0.5f), std::invalid_argument);
+}
+
+TEST(MeshSimplifierTest, TestSimplifySessionResumesFromPreviousState) {
+  const auto mesh = test::CreateSubdividedOctahedron(3);
+  MeshSimplifier mesh_simplifier{mesh};
+
+  // each rate is relative to the current face count so halving twice removes the same triangles as a rate of .75
+  const auto half_mesh = mesh::Simplify(mesh_simplifier, 0.5f);
+  const auto expected_half_mesh = mesh::Simplify(mesh, 0.5f);
+  EXPECT_EQ(half_mesh.indices().size() / 3, mesh_simplifier.face_count());
+  EXPECT_EQ(expected_half_mesh.positions(), half_mesh.positions());
+  EXPECT_EQ(expected_half_mesh.indices(), half_mesh.indices());
+
+  const auto half_max_error = mesh_simplifier.max_error();
+  const auto quarter_mesh = mesh::Simplify(mesh_simplifier, 0.5f);
+  const auto expected_mesh = mesh::Simplify(mesh, 0.75f);
+  EXPECT_EQ(expected_mesh.positions(), quarter_mesh.positions());
+  EXPECT_EQ(expected_mesh.indices(), quarter_mesh.indices());
+  EXPECT_GE(mesh_simplifier.max_error(), half_max_error);
+}
+
+TEST(MeshSimplifierTest, TestSimplifyLodsReachesEachTargetInOrder) {
+  const auto mesh = test::CreateSubdividedOctahedron(3);
+  const auto face_count = mesh.indices().size() / 3;
+  const std::array targets{
+      mesh::LodTarget{.rate = 0.25f}, mesh::LodTarget{.rate = 0.5f}, mesh::LodTarget{.rate = 0.75f}};
+
+  const auto lods = mesh::SimplifyLods(mesh, targets);
+  ASSERT_EQ(targets.size(), lods.size());
+
+  for (std::size_t i = 0; i < lods.size(); ++i) {
+    const auto target_face_count = static_cast<std::size_t>((1.0f - targets[i].rate) * static_cast<float>(face_count));
+    EXPECT_EQ(lods[i].face_count, lods[i].mesh.indices().size() / 3);
+    EXPECT_LT(lods[i].face_count, target_face_count);
+    EXPECT_GE(lods[i].face_count + 2, target_face_count);
+    if (i > 0) {
+      EXPECT_GE(lods[i].max_error, lods[i - 1].max_error);
+    }
+  }
+
+  // the finest level of detail is the same mesh produced by simplifying to its target alone
+  const auto simplified_mesh = mesh::Simplify(mesh, targets[0].rate);
+  EXPECT_EQ(simplified_mesh.positions(), lods[0].mesh.positions());
+  EXPECT_EQ(simplified_mesh.indices(), lods[0].mesh.indices());
+}
+
+TEST(MeshSimplifierTest, TestSimplifyLodsStopsAtMaxError) {
+  const auto mesh = test::CreateSubdividedOctahedron(3);
+  const auto half_lod = mesh::SimplifyLods(mesh, std::array{mesh::LodTarget{.rate = 0.5f}}).front();
+
+  // the first level of detail stops before its rate is reached once the next edge contraction exceeds its error
+  const std::array targets{mesh::LodTarget{.rate = 0.9f, .max_error = half_lod.max_error},
+                           mesh::LodTarget{.rate = 0.1f},
+                           mesh::LodTarget{.rate = 0.9f}};
+  const auto lods = mesh::SimplifyLods(mesh, targets);
+  ASSERT_EQ(targets.size(), lods.size());
+
+  EXPECT_LE(lods[0].max_error, half_lod.max_error);
+  EXPECT_LE(lods[0].face_count, half_lod.face_count);
+  EXPECT_GT(lods[0].face_count, mesh.indices().size() / 30);
+
+  // a target already satisfied by the previous level of detail produces a copy of it
+  EXPECT_EQ(lods[0].face_count, lods[1].face_count);
+  EXPECT_EQ(lods[0].mesh.indices(), lods[1].mesh.indices());
+
+  EXPECT_LT(lods[2].face_count, mesh.indices().size() / 30);
+  EXPECT_GT(lods[2].max_error, half_lod.max_error);
+}
+
+TEST(MeshSimplifierTest, TestSimplifyLodsWithNegativeMaxErrorThrowsException) {
+  const std::array targets{mesh::LodTarget{.rate = 0.5f, .max_error = -1.0f}};
+  EXPECT_THROW(std::ignore = mesh::SimplifyLods(test::CreateSubdividedOctahedron(1), targets), std::invalid_argument);
+}
+
+TEST(MeshSimplifierTest, TestSimplifyWithMaxDeviationBoundsDistanceToOriginalSurface) {
+  constexpr auto kMaxDeviation = 0.02f;
+  const auto mesh = test::CreateSubdividedOctahedron(4);
+  const auto get_triangles = [](const MeshData& triangle_mesh) {
+    std::vector<TriangleBvh::Triangle> triangles;
+    const auto& positions = triangle_mesh.positions();
+    const auto& indices = triangle_mesh.indices();
+    for (std::size_t i = 0; i < indices.size(); i += 3) {
+      triangles.push_back(
+          TriangleBvh::Triangle{positions[indices[i]], positions[indices[i + 1]], positions[indices[i + 2]]});
+    }
+    return triangles;
+  };
+  const TriangleBvh original_surface{get_triangles(mesh)};
+
+  for (const auto approximate_queue_samples : {std::size_t{0}, std::size_t{8}}) {
+    SimplifierOptions options;
+    options.approximate_queue_samples = approximate_queue_samples;
+    options.max_deviation = kMaxDeviation;
+    MeshSimplifier mesh_simplifier{mesh, nullptr, options};
+    mesh_simplifier.Simplify(0);
+    const auto simplified_mesh = static_cast<MeshData>(mesh_simplifier.half_edge_mesh());
+    EXPECT_LT(simplified_mesh.indices().size(), mesh.indices().size() / 4);
+    EXPECT_LE(mesh_simplifier.GetDeviation(), kMaxDeviation);
+
+    // verify the bound by sampling each simplified face against the original surface and vice versa
+    const TriangleBvh simplified_surface{get_triangles(simplified_mesh)};
+    for (const auto& [p0, p1, p2] : simplified_surface.triangles()) {
+      const std::array points{p0, p1, p2, (p0 + p1) / 2.0f, (p1 + p2) / 2.0f, (p2 + p0) / 2.0f, (p0 + p1 + p2) / 3.0f};
+      for (const auto& point : points) EXPECT_LE(original_surface.GetDistance(point), kMaxDeviation);
+    }
+    for (const auto& position : mesh.positions()) {
+      EXPECT_LE(simplified_surface.GetDistance(position), kMaxDeviation);
+    }
+  }
+}
+
+TEST(MeshSimplifierTest, TestSimplifyWithStricterMaxDeviationRemovesFewerTriangles) {
+  const auto mesh = test::CreateSubdividedOctahedron(3);
+  std::vector<std::size_t> face_counts;
+  for (const auto max_deviation : {std::numeric_limits<float>::infinity(), 0.05f, 0.02f}) {
+    SimplifierOptions options;
+    options.max_deviation = max_deviation;
+    MeshSimplifier mesh_simplifier{mesh, nullptr, options};
+    mesh_simplifier.Simplify(16);
+    face_counts.push_back(mesh_simplifier.face_count());
+  }
+  EXPECT_LT(face_counts[0], face_counts[1]);
+  EXPECT_LT(face_counts[1], face_counts[2]);
+  EXPECT_LT(face_counts[2], mesh.indices().size() / 3);
+}
+
+TEST(MeshSimplifierTest, TestNonPositiveMaxDeviationThrowsException) {
+  SimplifierOptions options;
+  options.max_deviation = 0.0f;
+  EXPECT_THROW((MeshSimplifier{test::CreateSubdividedOctahedron(1), nullptr, options}), std::invalid_argument);
+}
+
+/** @brief Creates two subdivided octahedra whose centers are separated along the x-axis by a given distance. */
+MeshData CreateSeparatedOctahedra(const int subdivisions, const float center_distance) {
+  const auto sphere = test::CreateSubdividedOctahedron(subdivisions);
+  const auto vertex_count = static_cast<std::uint32_t>(sphere.positions().size());
+
+  std::vector<glm::vec3> positions{sphere.positions().begin(), sphere.positions().end()};
+  for (const auto& position : sphere.positions()) {
+    positions.push_back(position + glm::vec3{center_distance, 0.0f, 0.0f});
+  }
+
+  std::vector<std::uint32_t> indices{sphere.indices().begin(), sphere.indices().end()};
+  for (const auto index : sphere.indices()) indices.push_back(index + vertex_count);
+
+  return MeshData{positions, {}, {}, indices};
+}
+
+TEST(MeshSimplifierTest, TestVirtualPairsMergeNearbyComponents) {
+  static constexpr auto kCenterDistance = 2.02f;
+  static constexpr auto kRate = 0.9f;
+  const auto mesh = CreateSeparatedOctahedra(3, kCenterDistance);
+  const auto face_count = static_cast<float>(mesh.indices().size() / 3);
+  const auto target_face_count = static_cast<std::size_t>((1.0f - kRate) * face_count);
+
+  SimplifierOptions options;
+  options.virtual_pair_distance = 0.1f;
+  const auto simplified_mesh = mesh::Simplify(mesh, kRate, nullptr, options);
+  const auto& positions = simplified_mesh.positions();
+  const auto& indices = simplified_mesh.indices();
+
+  // merging vertices removes no faces so the target face count is reached exactly as it is by edge contractions alone
+  EXPECT_LT(indices.size() / 3, target_face_count);
+  EXPECT_GE(indices.size() / 3 + 2, target_face_count);
+
+  // every vertex stays close to the surface of one of the spheres including the merged vertex between them
+  for (const auto& position : positions) {
+    const auto deviation = std::min(std::abs(glm::length(position) - 1.0f),
+                                    std::abs(glm::distance(position, glm::vec3{kCenterDistance, 0.0f, 0.0f}) - 1.0f));
+    EXPECT_LT(deviation, 0.1f);
+  }
+
+  // both spheres keep their faces and share exactly one vertex
+  std::array<std::set<std::uint32_t>, 2> component_vertices;
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    const auto face = std::span{indices}.subspan(i, 3);
+    const auto centroid = (positions[face[0]] + positions[face[1]] + positions[face[2]]) / 3.0f;
+    component_vertices[centroid.x < kCenterDistance / 2.0f ? 0 : 1].insert(face.begin(), face.end());
+  }
+  EXPECT_GT(component_vertices[0].size(), positions.size() / 4);
+  EXPECT_GT(component_vertices[1].size(), positions.size() / 4);
+
+  std::vector<std::uint32_t> shared_vertices;
+  std::ranges::set_intersection(component_vertices[0], component_vertices[1], std::back_inserter(shared_vertices));
+  ASSERT_EQ(1, shared_vertices.size());
+  EXPECT_NEAR(kCenterDistance / 2.0f, positions[shared_vertices.front()].x, 0.1f);
+}
+
+TEST(MeshSimplifierTest, TestVirtualPairsRemoveComponents) {
+  const auto mesh = CreateSeparatedOctahedra(2, 2.1f);
+  SimplifierOptions options;
+  options.virtual_pair_distance = 0.2f;
+  const auto merged_mesh = mesh::Simplify(mesh, 1.0f, nullptr, options);
+  options.remove_virtual_pair_components = true;
+  const auto folded_mesh = mesh::Simplify(mesh, 1.0f, nullptr, options);
+
+  // neither sphere can be simplified beyond a tetrahedron unless one of them is removed
+  EXPECT_GE(merged_mesh.indices().size() / 3, 8);
+  EXPECT_EQ(4, folded_mesh.indices().size() / 3);
+}
+
+/** @brief Adds normals to two spheres created by @c CreateSeparatedOctahedra whose centers are 2 units apart. */
+MeshData AddTouchingSphereNormals(const MeshData& mesh) {
+  const auto vertex_count = mesh.positions().size() / 2;
+  std::vector<glm::vec3> normals;
+  for (std::size_t i = 0; i < mesh.positions().size(); ++i) {
+    normals.push_back(mesh.positions()[i] - glm::vec3{i < vertex_count ? 0.0f : 2.0f, 0.0f, 0.0f});
+  }
+  return MeshData{mesh.positions(), normals, {}, mesh.indices()};
+}
+
+TEST(MeshSimplifierTest, TestSimplifyTouchingComponentsWithAttributes) {
+  // the spheres touch at (1,0,0) where vertex positions are welded because the mesh has normals
+  const auto mesh = AddTouchingSphereNormals(CreateSeparatedOctahedra(3, 2.0f));
+  const auto corner_vertex_ids = HalfEdgeMesh::GetCornerVertexIds(mesh);
+  std::set<int> touching_vertex_ids;
+  for (std::size_t i = 0; i < corner_vertex_ids.size(); ++i) {
+    if (mesh.positions()[mesh.indices()[i]] == glm::vec3{1.0f, 0.0f, 0.0f}) {
+      touching_vertex_ids.insert(corner_vertex_ids[i]);
+    }
+  }
+  EXPECT_EQ(2, touching_vertex_ids.size());
+
+  const auto simplified_mesh = mesh::Simplify(mesh, 0.9f, nullptr, GetAttributeOptions());
+  EXPECT_LT(simplified_mesh.indices().size(), mesh.indices().size() / 5);
+  EXPECT_EQ(simplified_mesh.positions().size(), simplified_mesh.normals().size());
+}
+
+TEST(MeshSimplifierTest, TestSimplifyComponentsSharingVertexWithAttributes) {
+  // the vertex index shared by both spheres cannot be split so its two fans of triangles must not be contracted
+  auto mesh = AddTouchingSphereNormals(CreateSeparatedOctahedra(3, 2.0f));
+  const auto vertex_count = static_cast<std::uint32_t>(mesh.positions().size() / 2);
+  std::vector<std::uint32_t> indices{mesh.indices().begin(), mesh.indices().end()};
+  std::ranges::replace(indices, vertex_count + 1, 0u);
+  mesh = MeshData{mesh.positions(), mesh.normals(), {}, indices};
+
+  MeshSimplifier mesh_simplifier{mesh, nullptr, GetAttributeOptions()};
+  EXPECT_TRUE(mesh_simplifier.half_edge_mesh().IsLocked(*mesh_simplifier.half_edge_mesh().vertices().at(0)));
+  mesh_simplifier.Simplify(mesh.indices().size() / 3 / 10);
+  EXPECT_TRUE(mesh_simplifier.half_edge_mesh().vertices().contains(0));
+}
+
+TEST(MeshSimplifierTest, TestVirtualPairsWithMaxDeviationThrowsException) {
+  SimplifierOptions options;
+  options.virtual_pair_distance = 1.0f;
+  options.max_deviation = 0.1f;
+  EXPECT_THROW((MeshSimplifier{test::CreateSubdividedOctahedron(1), nullptr, options}), std::invalid_argument);
+}
+
+TEST(MeshSimplifierTest, TestCheckpointIntervalWithoutPathThrowsException) {
+  SimplifierOptions options;
+  options.checkpoint_interval = 1;
+  EXPECT_THROW((MeshSimplifier{test::CreateSubdividedOctahedron(1), nullptr, options}), std::invalid_argument);
+}
+
+}  // namespace
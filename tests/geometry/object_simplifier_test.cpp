@@ -0,0 +1,65 @@
+#include "geometry/object_simplifier.cpp"  // NOLINT
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test_meshes.h"
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+/** @brief Creates a named square grid on a paraboloid with two triangles per cell. */
+ObjObject CreateGridObject(std::string name, const int size) {
+  return ObjObject{.name = std::move(name), .mesh = test::CreateParaboloidGrid(size)};
+}
+
+TEST(ObjectSimplifierTest, TestSimplifyObjectsPreservesNamesAndOrder) {
+  std::vector<ObjObject> objects;
+  objects.push_back(CreateGridObject("small", 4));
+  objects.push_back(CreateGridObject("large", 16));
+  objects.push_back(CreateGridObject("medium", 8));
+
+  SimplifierOptions options;
+  options.lock_boundary = true;
+  const auto simplified_objects = mesh::SimplifyObjects(objects, 0.5f, options, 2);
+
+  ASSERT_EQ(objects.size(), simplified_objects.size());
+  for (std::size_t i = 0; i < objects.size(); ++i) {
+    EXPECT_EQ(objects[i].name, simplified_objects[i].name);
+    EXPECT_LT(simplified_objects[i].mesh.indices().size(), objects[i].mesh.indices().size());
+  }
+}
+
+TEST(ObjectSimplifierTest, TestSimplifyObjectsIsIndependentOfThreadCount) {
+  std::vector<ObjObject> objects;
+  for (auto i = 0; i < 6; ++i) objects.push_back(CreateGridObject(std::to_string(i), 3 + 2 * i));
+
+  SimplifierOptions options;
+  options.lock_boundary = true;
+  const auto expected_objects = mesh::SimplifyObjects(objects, 0.5f, options, 1);
+  const auto actual_objects = mesh::SimplifyObjects(objects, 0.5f, options, 4);
+
+  ASSERT_EQ(expected_objects.size(), actual_objects.size());
+  for (std::size_t i = 0; i < expected_objects.size(); ++i) {
+    EXPECT_EQ(expected_objects[i].mesh.positions(), actual_objects[i].mesh.positions());
+    EXPECT_EQ(expected_objects[i].mesh.indices(), actual_objects[i].mesh.indices());
+  }
+}
+
+TEST(ObjectSimplifierTest, TestSimplifyObjectsWithInvalidArguments) {
+  std::vector<ObjObject> objects;
+  objects.push_back(CreateGridObject("grid", 2));
+  EXPECT_THROW(mesh::SimplifyObjects(objects, 1.5f), std::invalid_argument);
+
+  const std::vector locked_vertices{0};
+  SimplifierOptions options;
+  options.locked_vertices = locked_vertices;
+  EXPECT_THROW(mesh::SimplifyObjects(objects, 0.5f, options), std::invalid_argument);
+}
+
+}  // namespace
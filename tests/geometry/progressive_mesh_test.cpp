@@ -0,0 +1,103 @@
+#include "geometry/progressive_mesh.cpp"  // NOLINT
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+MeshData CreateValidMesh() {
+  const std::vector<glm::vec3> positions{
+      {1.0f, 0.0f, 0.0f},   // v0
+      {2.0f, 0.0f, 0.0f},   // v1
+      {0.5f, -1.0f, 0.0f},  // v2
+      {1.5f, -1.0f, 0.0f},  // v3
+      {2.5f, -1.0f, 0.0f},  // v4
+      {3.0f, 0.0f, 0.0f},   // v5
+      {2.5f, 1.0f, 0.0f},   // v6
+      {1.5f, 1.0f, 0.0f},   // v7
+      {0.5f, 1.0f, 0.0f},   // v8
+      {0.0f, 0.0f, 0.0f}    // v9
+  };
+
+  const std::vector<std::uint32_t> indices{
+      0, 2, 3,  // f0
+      0, 3, 1,  // f1
+      0, 1, 7,  // f2
+      0, 7, 8,  // f3
+      0, 8, 9,  // f4
+      0, 9, 2,  // f5
+      1, 3, 4,  // f6
+      1, 4, 5,  // f7
+      1, 5, 6,  // f8
+      1, 6, 7   // f9
+  };
+
+  return MeshData{positions, {}, {}, indices};
+}
+
+VertexSplit CreateVertexSplit() {
+  return VertexSplit{
+      .collapsed_vertices = {0, 1},
+      .vertex = 10,
+      .position = glm::vec3{1.5f, 0.0f, 0.0f},
+      .removed_faces = {{0, 2, 3}, {0, 3, 1}, {0, 1, 7}, {0, 7, 8}, {0, 8, 9},
+                        {0, 9, 2}, {1, 3, 4}, {1, 4, 5}, {1, 5, 6}, {1, 6, 7}},
+      .added_faces = {{2, 3, 10}, {3, 4, 10}, {4, 5, 10}, {5, 6, 10}, {6, 7, 10}, {7, 8, 10}, {8, 9, 10}, {2, 10, 9}},
+  };
+}
+
+TEST(ProgressiveMeshTest, TestCreateProgressiveMesh) {
+  const ProgressiveMesh progressive_mesh{CreateValidMesh()};
+  EXPECT_EQ(progressive_mesh.face_count(), 10);
+  EXPECT_TRUE(progressive_mesh.vertex_splits().empty());
+}
+
+TEST(ProgressiveMeshTest, TestGetMinVertexOrder) {
+  EXPECT_EQ((VertexSplit::Face{0, 1, 2}), GetMinVertexOrder(0, 1, 2));
+  EXPECT_EQ((VertexSplit::Face{0, 1, 2}), GetMinVertexOrder(1, 2, 0));
+  EXPECT_EQ((VertexSplit::Face{0, 1, 2}), GetMinVertexOrder(2, 0, 1));
+}
+
+TEST(ProgressiveMeshTest, TestAppendVertexSplitWithInvalidIdThrowsException) {
+  ProgressiveMesh progressive_mesh{CreateValidMesh()};
+  auto vertex_split = CreateVertexSplit();
+  vertex_split.vertex = 11;
+  EXPECT_THROW(progressive_mesh.Append(std::move(vertex_split)), std::invalid_argument);
+}
+
+TEST(ProgressiveMeshTest, TestSetFaceCountReplaysAndUndoesVertexSplits) {
+  ProgressiveMesh progressive_mesh{CreateValidMesh()};
+  progressive_mesh.Append(CreateVertexSplit());
+
+  progressive_mesh.SetFaceCount(8);
+  EXPECT_EQ(progressive_mesh.face_count(), 8);
+
+  progressive_mesh.SetFaceCount(10);
+  EXPECT_EQ(progressive_mesh.face_count(), 10);
+
+  progressive_mesh.SetFaceCount(9);
+  EXPECT_EQ(progressive_mesh.face_count(), 8);
+
+  progressive_mesh.SetFaceCount(0);
+  EXPECT_EQ(progressive_mesh.face_count(), 8);
+}
+
+TEST(ProgressiveMeshTest, TestExtractMesh) {
+  ProgressiveMesh progressive_mesh{CreateValidMesh()};
+  progressive_mesh.Append(CreateVertexSplit());
+
+  const auto base_mesh = progressive_mesh.Extract(8);
+  EXPECT_EQ(base_mesh.positions().size(), 9);
+  EXPECT_EQ(base_mesh.normals().size(), 9);
+  EXPECT_EQ(base_mesh.indices().size(), 24);
+
+  const auto full_mesh = progressive_mesh.Extract(10);
+  EXPECT_EQ(full_mesh.positions().size(), 10);
+  EXPECT_EQ(full_mesh.indices().size(), 30);
+}
+
+}  // namespace
@@ -0,0 +1,173 @@
+#include "geometry/simplification_cache.cpp"  // NOLINT
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test_meshes.h"
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+class SimplificationCacheTest : public testing::Test {
+protected:
+  SimplificationCacheTest()
+      : directory_{std::filesystem::path{testing::TempDir()} / "simplification_cache_test"},
+        cache_{directory_, std::uintmax_t{1} << 20u} {}
+
+  ~SimplificationCacheTest() override { std::filesystem::remove_all(directory_); }
+
+  std::filesystem::path directory_;
+  SimplificationCache cache_;
+};
+
+TEST(Fnv1aHashTest, TestHashMatchesReferenceValues) {
+  const auto hash_string = [](const std::string_view string) {
+    Fnv1aHash hash;
+    hash.Update(std::as_bytes(std::span{string}));
+    return hash.value();
+  };
+  EXPECT_EQ((std::array<std::uint64_t, 2>{0x6c62272e07bb0142, 0x62b821756295c58d}), hash_string(""));
+  EXPECT_EQ((std::array<std::uint64_t, 2>{0xd228cb696f1a8caf, 0x78912b704e4a8964}), hash_string("a"));
+  EXPECT_EQ((std::array<std::uint64_t, 2>{0x343e1662793c64bf, 0x6f0d3597ba446f18}), hash_string("foobar"));
+}
+
+TEST_F(SimplificationCacheTest, TestKeyDependsOnInputAndParameters) {
+  const auto mesh = test::CreateParaboloidGrid(4);
+  const auto key = SimplificationCache::GetKey(mesh, 0.5f);
+  EXPECT_EQ(32, key.size());
+  EXPECT_EQ(key, SimplificationCache::GetKey(test::CreateParaboloidGrid(4), 0.5f));
+
+  EXPECT_NE(key, SimplificationCache::GetKey(test::CreateParaboloidGrid(5), 0.5f));
+  EXPECT_NE(key, SimplificationCache::GetKey(mesh, 0.6f));
+
+  SimplifierOptions options;
+  options.lock_boundary = true;
+  EXPECT_NE(key, SimplificationCache::GetKey(mesh, 0.5f, options));
+
+  options = SimplifierOptions{};
+  options.normal_weight = 2.0f;
+  EXPECT_NE(key, SimplificationCache::GetKey(mesh, 0.5f, options));
+
+  options = SimplifierOptions{};
+  options.checkpoint_interval = 10;
+  EXPECT_EQ(key, SimplificationCache::GetKey(mesh, 0.5f, options));
+
+  const std::array targets{mesh::LodTarget{.rate = 0.5f}};
+  EXPECT_NE(key, SimplificationCache::GetKey(mesh, targets));
+}
+
+TEST_F(SimplificationCacheTest, TestFindMissingEntry) {
+  EXPECT_FALSE(cache_.Find(SimplificationCache::GetKey(test::CreateParaboloidGrid(4), 0.5f)).has_value());
+}
+
+TEST_F(SimplificationCacheTest, TestFindInsertedEntry) {
+  const auto mesh = test::CreateParaboloidGrid(2);
+  const auto key = SimplificationCache::GetKey(mesh, 0.5f);
+  const std::array lods{mesh::LevelOfDetail{.mesh = test::CreateParaboloidGrid(2), .face_count = 8, .max_error = 0.5f},
+                        mesh::LevelOfDetail{.mesh = test::CreateParaboloidGrid(1), .face_count = 2, .max_error = 1.5f}};
+  cache_.Insert(key, lods);
+
+  const auto cached_lods = cache_.Find(key);
+  ASSERT_TRUE(cached_lods.has_value());
+  ASSERT_EQ(lods.size(), cached_lods->size());
+  for (std::size_t i = 0; i < lods.size(); ++i) {
+    EXPECT_EQ(lods[i].mesh.positions(), (*cached_lods)[i].mesh.positions());
+    EXPECT_EQ(lods[i].mesh.indices(), (*cached_lods)[i].mesh.indices());
+    EXPECT_EQ(lods[i].face_count, (*cached_lods)[i].face_count);
+    EXPECT_EQ(lods[i].max_error, (*cached_lods)[i].max_error);
+  }
+}
+
+TEST_F(SimplificationCacheTest, TestConcurrentInsertsOfSameEntry) {
+  const auto mesh = test::CreateParaboloidGrid(8);
+  const auto key = SimplificationCache::GetKey(mesh, 0.5f);
+  const std::array lods{mesh::LevelOfDetail{.mesh = mesh, .face_count = 128, .max_error = 0.0f}};
+
+  {
+    std::vector<std::jthread> writers;
+    for (auto i = 0; i < 8; ++i) {
+      writers.emplace_back([&] {
+        for (auto j = 0; j < 8; ++j) cache_.Insert(key, lods);
+      });
+    }
+  }
+
+  const auto cached_lods = cache_.Find(key);
+  ASSERT_TRUE(cached_lods.has_value());
+  ASSERT_EQ(1, cached_lods->size());
+  EXPECT_EQ(mesh.indices(), cached_lods->front().mesh.indices());
+  EXPECT_EQ(1, std::distance(std::filesystem::directory_iterator{directory_}, std::filesystem::directory_iterator{}));
+}
+
+TEST_F(SimplificationCacheTest, TestFindCorruptEntry) {
+  const auto key = SimplificationCache::GetKey(test::CreateParaboloidGrid(4), 0.5f);
+  std::ofstream{directory_ / (key + ".simplified"), std::ios::binary} << "GFXSIMP";
+  EXPECT_FALSE(cache_.Find(key).has_value());
+}
+
+TEST_F(SimplificationCacheTest, TestEvictLeastRecentlyUsedEntries) {
+  const std::array lods{
+      mesh::LevelOfDetail{.mesh = test::CreateParaboloidGrid(4), .face_count = 32, .max_error = 0.0f}};
+  cache_.Insert("a", lods);
+  const auto entry_size = std::filesystem::file_size(directory_ / "a.simplified");
+
+  const SimplificationCache cache{directory_, entry_size * 2};
+  cache.Insert("b", lods);
+
+  // entry "a" was inserted first but used most recently
+  const auto now = std::filesystem::file_time_type::clock::now();
+  std::filesystem::last_write_time(directory_ / "a.simplified", now - std::chrono::hours{2});
+  std::filesystem::last_write_time(directory_ / "b.simplified", now - std::chrono::hours{1});
+  ASSERT_TRUE(cache.Find("a").has_value());
+
+  cache.Insert("c", lods);
+  EXPECT_TRUE(std::filesystem::exists(directory_ / "a.simplified"));
+  EXPECT_FALSE(std::filesystem::exists(directory_ / "b.simplified"));
+  EXPECT_TRUE(std::filesystem::exists(directory_ / "c.simplified"));
+}
+
+TEST_F(SimplificationCacheTest, TestSimplifyWithCacheMatchesSimplify) {
+  const auto mesh = test::CreateParaboloidGrid(8);
+  SimplifierOptions options;
+  options.lock_boundary = true;
+  const auto expected_mesh = mesh::Simplify(mesh, 0.5f, nullptr, options);
+
+  for (auto i = 0; i < 2; ++i) {  // the second iteration is found in the cache
+    const auto actual_mesh = mesh::Simplify(mesh, 0.5f, cache_, options);
+    EXPECT_EQ(expected_mesh.positions(), actual_mesh.positions());
+    EXPECT_EQ(expected_mesh.normals(), actual_mesh.normals());
+    EXPECT_EQ(expected_mesh.indices(), actual_mesh.indices());
+    EXPECT_TRUE(cache_.Find(SimplificationCache::GetKey(mesh, 0.5f, options)).has_value());
+  }
+}
+
+TEST_F(SimplificationCacheTest, TestSimplifyLodsWithCacheMatchesSimplifyLods) {
+  const auto mesh = test::CreateParaboloidGrid(8);
+  const std::array targets{mesh::LodTarget{.rate = 0.5f}, mesh::LodTarget{.rate = 0.75f}};
+  SimplifierOptions options;
+  options.lock_boundary = true;
+  const auto expected_lods = mesh::SimplifyLods(mesh, targets, options);
+
+  for (auto i = 0; i < 2; ++i) {  // the second iteration is found in the cache
+    const auto actual_lods = mesh::SimplifyLods(mesh, targets, cache_, options);
+    ASSERT_EQ(expected_lods.size(), actual_lods.size());
+    for (std::size_t j = 0; j < expected_lods.size(); ++j) {
+      EXPECT_EQ(expected_lods[j].mesh.positions(), actual_lods[j].mesh.positions());
+      EXPECT_EQ(expected_lods[j].mesh.indices(), actual_lods[j].mesh.indices());
+      EXPECT_EQ(expected_lods[j].face_count, actual_lods[j].face_count);
+    }
+  }
+}
+
+}  // namespace
@@ -0,0 +1,116 @@
+#include "geometry/streaming_simplifier.cpp"  // NOLINT
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+/** @brief Writes a closed mesh created by subdividing each face of an octahedron into an .obj file. */
+void WriteSubdividedOctahedron(const std::filesystem::path& filepath, const int subdivisions) {
+  std::vector<glm::vec3> positions{{1.0f, 0.0f, 0.0f},
+                                   {-1.0f, 0.0f, 0.0f},
+                                   {0.0f, 1.0f, 0.0f},
+                                   {0.0f, -1.0f, 0.0f},
+                                   {0.0f, 0.0f, 1.0f},
+                                   {0.0f, 0.0f, -1.0f}};
+  std::vector<std::array<int, 3>> faces{{0, 2, 4}, {2, 1, 4}, {1, 3, 4}, {3, 0, 4},
+                                        {2, 0, 5}, {1, 2, 5}, {3, 1, 5}, {0, 3, 5}};
+
+  for (auto i = 0; i < subdivisions; ++i) {
+    std::map<std::pair<int, int>, int> midpoints;
+    const auto get_midpoint = [&](const int v0, const int v1) {
+      const auto [iterator, inserted] = midpoints.try_emplace(std::minmax(v0, v1), static_cast<int>(positions.size()));
+      if (inserted) positions.push_back(glm::normalize(positions[v0] + positions[v1]));
+      return iterator->second;
+    };
+
+    std::vector<std::array<int, 3>> subdivided_faces;
+    for (const auto& [v0, v1, v2] : faces) {
+      const auto v01 = get_midpoint(v0, v1);
+      const auto v12 = get_midpoint(v1, v2);
+      const auto v20 = get_midpoint(v2, v0);
+      subdivided_faces.insert(subdivided_faces.end(),
+                              {{v0, v01, v20}, {v01, v1, v12}, {v20, v12, v2}, {v01, v12, v20}});
+    }
+    faces = std::move(subdivided_faces);
+  }
+
+  std::ofstream ofs{filepath};
+  for (const auto& position : positions) ofs << std::format("v {} {} {}\n", position.x, position.y, position.z);
+  for (const auto& [v0, v1, v2] : faces) ofs << std::format("f {} {} {}\n", v0 + 1, v1 + 1, v2 + 1);
+}
+
+TEST(StreamingSimplifierTest, TestReadAndWriteRecords) {
+  TemporaryDirectory temporary_directory{std::filesystem::temp_directory_path()};
+  const auto filepath = temporary_directory.CreateFilepath();
+  const std::vector<Triangle> triangles(3, Triangle{glm::vec3{1.0f}, glm::vec3{2.0f}, glm::vec3{3.0f}});
+
+  auto ofs = Open<std::ofstream>(filepath);
+  Write<Triangle>(ofs, triangles);
+  ofs.close();
+
+  auto ifs = Open<std::ifstream>(filepath);
+  std::vector<Triangle> records;
+  ASSERT_TRUE(Read(ifs, records, 2));
+  EXPECT_EQ(2, records.size());
+  ASSERT_TRUE(Read(ifs, records, 2));
+  EXPECT_EQ(1, records.size());
+  EXPECT_EQ(triangles[0], records[0]);
+  EXPECT_FALSE(Read(ifs, records, 2));
+}
+
+TEST(StreamingSimplifierTest, TestTemporaryDirectoryIsRemoved) {
+  std::filesystem::path filepath;
+  {
+    TemporaryDirectory temporary_directory{std::filesystem::temp_directory_path()};
+    filepath = temporary_directory.CreateFilepath();
+    std::ofstream{filepath} << "test";
+    ASSERT_TRUE(std::filesystem::exists(filepath));
+  }
+  EXPECT_FALSE(std::filesystem::exists(filepath.parent_path()));
+}
+
+TEST(StreamingSimplifierTest, TestSimplifyOutOfCoreProducesClosedMesh) {
+  TemporaryDirectory temporary_directory{std::filesystem::temp_directory_path()};
+  const auto input_filepath = temporary_directory.CreateFilepath().replace_extension(".obj");
+  const auto output_filepath = temporary_directory.CreateFilepath().replace_extension(".obj");
+  WriteSubdividedOctahedron(input_filepath, 4);
+
+  // a small memory budget partitions the mesh into many cells
+  StreamingOptions options;
+  options.memory_budget = 256 * kBytesPerFace;
+  const auto face_count = mesh::SimplifyOutOfCore(input_filepath, output_filepath, 0.5f, options);
+  const auto mesh = obj_loader::LoadMesh(output_filepath);
+
+  EXPECT_LT(face_count, 2048);
+  EXPECT_EQ(face_count * 3, mesh.indices().size());
+
+  // every edge of the output is shared by exactly two triangles if cells were stitched together without cracks
+  std::map<std::pair<std::uint32_t, std::uint32_t>, int> edge_counts;
+  const auto& indices = mesh.indices();
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      ++edge_counts[std::minmax(indices[i + j], indices[i + (j + 1) % 3])];
+    }
+  }
+  for (const auto edge_count : edge_counts | std::views::values) {
+    EXPECT_EQ(2, edge_count);
+  }
+}
+
+TEST(StreamingSimplifierTest, TestSimplifyOutOfCoreWithInvalidRateThrowsException) {
+  EXPECT_THROW(mesh::SimplifyOutOfCore("input.obj", "output.obj", 1.5f), std::invalid_argument);
+}
+
+}  // namespace
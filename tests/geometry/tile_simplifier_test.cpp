@@ -0,0 +1,72 @@
+#include "geometry/tile_simplifier.cpp"  // NOLINT
+
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test_meshes.h"
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+TEST(TileSimplifierTest, TestParseTileManifest) {
+  std::istringstream manifest_stream{
+      "# tiles\n"
+      "tile a.obj 0.5\n"
+      "\n"
+      "  tile b.obj 0.9  \n"
+      "seam 1 2.5 -3\n"};
+
+  const auto manifest = ParseTileManifest(manifest_stream, "tiles");
+
+  ASSERT_EQ(2, manifest.tiles.size());
+  EXPECT_EQ(std::filesystem::path{"tiles"} / "a.obj", manifest.tiles[0].filepath);
+  EXPECT_FLOAT_EQ(0.5f, manifest.tiles[0].rate);
+  EXPECT_EQ(std::filesystem::path{"tiles"} / "b.obj", manifest.tiles[1].filepath);
+  EXPECT_FLOAT_EQ(0.9f, manifest.tiles[1].rate);
+  EXPECT_EQ((std::vector{glm::vec3{1.0f, 2.5f, -3.0f}}), manifest.seam_positions);
+}
+
+TEST(TileSimplifierTest, TestParseTileManifestWithUnsupportedLine) {
+  std::istringstream manifest_stream{"tile a.obj\n"};
+  EXPECT_THROW(ParseTileManifest(manifest_stream, {}), std::invalid_argument);
+}
+
+TEST(TileSimplifierTest, TestParseTileManifestWithInvalidRate) {
+  std::istringstream manifest_stream{"tile a.obj 1.5\n"};
+  EXPECT_THROW(ParseTileManifest(manifest_stream, {}), std::invalid_argument);
+}
+
+TEST(TileSimplifierTest, TestSimplifyTilePreservesSeams) {
+  static constexpr auto kSize = 8;
+  const auto mesh = test::CreateGridMesh(kSize);
+  const glm::vec3 seam_position{4.0f, 4.0f, 0.0f};
+  std::optional<MeshSimplifier> mesh_simplifier;
+
+  SimplifyTile(HalfEdgeMesh{mesh}, 1.0f, {seam_position}, mesh_simplifier);
+
+  const auto& half_edge_mesh = mesh_simplifier->half_edge_mesh();
+  EXPECT_LT(half_edge_mesh.faces().size(), mesh.indices().size() / 3);
+
+  // every boundary vertex and the seam vertex must remain with their original IDs and positions
+  for (auto i = 0; std::cmp_less(i, mesh.positions().size()); ++i) {
+    const auto& position = mesh.positions()[static_cast<std::size_t>(i)];
+    if (position == seam_position || position.x == 0.0f || position.y == 0.0f || position.x == kSize
+        || position.y == kSize) {
+      const auto iterator = half_edge_mesh.vertices().find(i);
+      ASSERT_NE(iterator, half_edge_mesh.vertices().end());
+      EXPECT_EQ(position, iterator->second->position());
+    }
+  }
+}
+
+TEST(TileSimplifierTest, TestSimplifyOpenMeshWithoutLockedBoundaryThrowsException) {
+  const auto mesh = test::CreateGridMesh(2);
+  EXPECT_THROW(MeshSimplifier{mesh}, std::invalid_argument);
+}
+
+}  // namespace
@@ -0,0 +1,86 @@
+#include "geometry/triangle_bvh.cpp"  // NOLINT
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+constexpr TriangleBvh::Triangle kTriangle{
+    glm::vec3{0.0f, 0.0f, 0.0f}, glm::vec3{1.0f, 0.0f, 0.0f}, glm::vec3{0.0f, 1.0f, 0.0f}};
+
+/** @brief Creates randomly positioned and oriented triangles. */
+std::vector<TriangleBvh::Triangle> CreateRandomTriangles(const std::size_t count, std::mt19937& random_engine) {
+  std::uniform_real_distribution<float> center_distribution{-10.0f, 10.0f};
+  std::uniform_real_distribution<float> offset_distribution{-1.0f, 1.0f};
+  const auto get_point = [&](std::uniform_real_distribution<float>& distribution) {
+    return glm::vec3{distribution(random_engine), distribution(random_engine), distribution(random_engine)};
+  };
+
+  std::vector<TriangleBvh::Triangle> triangles;
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto center = get_point(center_distribution);
+    triangles.push_back(TriangleBvh::Triangle{center + get_point(offset_distribution),
+                                              center + get_point(offset_distribution),
+                                              center + get_point(offset_distribution)});
+  }
+  return triangles;
+}
+
+TEST(TriangleBvhTest, TestGetClosestPointInsideTriangle) {
+  EXPECT_EQ((glm::vec3{0.25f, 0.25f, 0.0f}), TriangleBvh::GetClosestPoint(glm::vec3{0.25f, 0.25f, 2.0f}, kTriangle));
+}
+
+TEST(TriangleBvhTest, TestGetClosestPointOnTriangleEdge) {
+  const auto closest_point = TriangleBvh::GetClosestPoint(glm::vec3{1.0f, 1.0f, 0.0f}, kTriangle);
+  EXPECT_FLOAT_EQ(0.5f, closest_point.x);
+  EXPECT_FLOAT_EQ(0.5f, closest_point.y);
+  EXPECT_FLOAT_EQ(0.0f, closest_point.z);
+}
+
+TEST(TriangleBvhTest, TestGetClosestPointOnTriangleVertex) {
+  EXPECT_EQ(kTriangle[1], TriangleBvh::GetClosestPoint(glm::vec3{2.0f, -1.0f, 1.0f}, kTriangle));
+}
+
+TEST(TriangleBvhTest, TestGetClosestPointOnDegenerateTriangle) {
+  constexpr TriangleBvh::Triangle kDegenerateTriangle{
+      glm::vec3{0.0f, 0.0f, 0.0f}, glm::vec3{2.0f, 0.0f, 0.0f}, glm::vec3{1.0f, 0.0f, 0.0f}};
+  EXPECT_EQ((glm::vec3{0.5f, 0.0f, 0.0f}),
+            TriangleBvh::GetClosestPoint(glm::vec3{0.5f, 1.0f, 0.0f}, kDegenerateTriangle));
+}
+
+TEST(TriangleBvhTest, TestGetDistanceMatchesExhaustiveSearch) {
+  std::mt19937 random_engine{0};  // NOLINT(cert-msc32-c, cert-msc51-cpp)
+  const auto triangles = CreateRandomTriangles(512, random_engine);
+  const TriangleBvh triangle_bvh{triangles};
+  ASSERT_EQ(triangles.size(), triangle_bvh.triangles().size());
+
+  std::uniform_real_distribution<float> distribution{-12.0f, 12.0f};
+  for (auto i = 0; i < 256; ++i) {
+    const glm::vec3 point{distribution(random_engine), distribution(random_engine), distribution(random_engine)};
+    auto expected_distance = std::numeric_limits<float>::infinity();
+    for (const auto& triangle : triangles) {
+      expected_distance =
+          std::min(expected_distance, glm::distance(point, TriangleBvh::GetClosestPoint(point, triangle)));
+    }
+    EXPECT_FLOAT_EQ(expected_distance, triangle_bvh.GetDistance(point));
+  }
+}
+
+TEST(TriangleBvhTest, TestGetDistanceBeyondMaxDistanceReturnsMaxDistance) {
+  const TriangleBvh triangle_bvh{{kTriangle}};
+  EXPECT_FLOAT_EQ(2.0f, triangle_bvh.GetDistance(glm::vec3{0.25f, 0.25f, 2.0f}));
+  EXPECT_EQ(1.0f, triangle_bvh.GetDistance(glm::vec3{0.25f, 0.25f, 2.0f}, 1.0f));
+}
+
+TEST(TriangleBvhTest, TestGetDistanceWithoutTrianglesReturnsMaxDistance) {
+  const TriangleBvh triangle_bvh{{}};
+  EXPECT_EQ(std::numeric_limits<float>::infinity(), triangle_bvh.GetDistance(glm::vec3{0.0f}));
+}
+
+}  // namespace
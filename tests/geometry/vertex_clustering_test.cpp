@@ -0,0 +1,68 @@
+#include "geometry/vertex_clustering.cpp"  // NOLINT
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test_meshes.h"
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+TEST(VertexClusteringTest, TestClusterVerticesReducesMesh) {
+  const auto mesh = test::CreateGridMesh(16);
+  const auto clustered_mesh = mesh::ClusterVertices(mesh, 64);
+
+  EXPECT_LT(clustered_mesh.positions().size(), mesh.positions().size());
+  EXPECT_LT(clustered_mesh.indices().size(), mesh.indices().size());
+  EXPECT_FALSE(clustered_mesh.indices().empty());
+  EXPECT_EQ(0, clustered_mesh.indices().size() % 3);
+}
+
+TEST(VertexClusteringTest, TestClusterVerticesProducesValidTriangles) {
+  const auto clustered_mesh = mesh::ClusterVertices(test::CreateGridMesh(16), 64);
+  const auto& positions = clustered_mesh.positions();
+  const auto& indices = clustered_mesh.indices();
+
+  std::unordered_set<std::uint64_t> edges;
+  std::vector<bool> referenced(positions.size(), false);
+
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      const auto v0 = indices[i + j];
+      const auto v1 = indices[i + (j + 1) % 3];
+      ASSERT_LT(v0, positions.size());
+      EXPECT_NE(v0, v1);
+      EXPECT_TRUE(edges.insert(GetEdgeKey(v0, v1)).second);
+      referenced[v0] = true;
+    }
+  }
+
+  for (const auto is_referenced : referenced) {
+    EXPECT_TRUE(is_referenced);
+  }
+}
+
+TEST(VertexClusteringTest, TestClusterVerticesUsesAveragePosition) {
+  // both vertices on the right side of the triangle pair fall into the same cell
+  const std::vector positions{
+      glm::vec3{0.0f}, glm::vec3{4.0f, 0.0f, 0.0f}, glm::vec3{4.0f, 0.5f, 0.0f}, glm::vec3{0.0f, 4.0f, 0.0f}};
+  const std::vector<std::uint32_t> indices{0, 1, 2, 0, 2, 3};
+  const MeshData mesh{positions, {}, {}, indices};
+
+  const auto clustered_mesh = mesh::ClusterVertices(mesh, 4);
+
+  ASSERT_EQ(3, clustered_mesh.indices().size());
+  const auto& clustered_positions = clustered_mesh.positions();
+  EXPECT_NE(std::ranges::find(clustered_positions, glm::vec3{4.0f, 0.25f, 0.0f}), clustered_positions.end());
+}
+
+TEST(VertexClusteringTest, TestClusterVerticesWithZeroVerticesThrowsException) {
+  EXPECT_THROW((void)mesh::ClusterVertices(test::CreateGridMesh(1), 0), std::invalid_argument);
+}
+
+}  // namespace
@@ -0,0 +1,180 @@
+#include "geometry/vertex_welder.cpp"  // NOLINT
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+
+#include "geometry/half_edge_mesh.h"
+#include "geometry/mesh_simplifier.h"
+#include "test_meshes.h"
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+/** @brief Creates a triangle soup of a square grid where every triangle has its own copy of each of its vertices. */
+vertex_welder::WeldedMesh CreateGridSoup(const int size, const float jitter) {
+  std::mt19937 random_engine{0};  // NOLINT(cert-msc32-c, cert-msc51-cpp): fixed seed for reproducible tests
+  std::uniform_real_distribution<float> distribution{-jitter, jitter};
+
+  vertex_welder::WeldedMesh mesh;
+  const auto add_vertex = [&](const int x, const int y) {
+    const glm::vec3 offset{distribution(random_engine), distribution(random_engine), 0.0f};
+    mesh.positions.push_back(glm::vec3{static_cast<float>(x), static_cast<float>(y), 0.0f} + offset);
+    mesh.normals.emplace_back(0.0f, 0.0f, 1.0f);
+    mesh.indices.push_back(static_cast<std::uint32_t>(mesh.indices.size()));
+  };
+  for (auto y = 0; y < size; ++y) {
+    for (auto x = 0; x < size; ++x) {
+      for (const auto& [dx, dy] : {std::pair{0, 0}, {1, 0}, {1, 1}, {0, 0}, {1, 1}, {0, 1}}) add_vertex(x + dx, y + dy);
+    }
+  }
+  return mesh;
+}
+
+/** @brief Welds the vertices of a mesh stored in the same layout as a welded mesh. */
+vertex_welder::WeldedMesh Weld(const vertex_welder::WeldedMesh& mesh,
+                               const WeldOptions& options = {},
+                               const std::size_t thread_count = 4) {
+  return vertex_welder::Weld(mesh.positions, mesh.normals, mesh.texcoords, mesh.indices, options, thread_count);
+}
+
+TEST(VertexWelderTest, TestWeldTriangleSoup) {
+  const auto soup = CreateGridSoup(8, 1.0e-6f);
+  const auto welded_mesh = Weld(soup);
+
+  EXPECT_EQ(81, welded_mesh.positions.size());
+  EXPECT_EQ(81, welded_mesh.normals.size());
+  EXPECT_TRUE(welded_mesh.texcoords.empty());
+  EXPECT_EQ(soup.indices.size(), welded_mesh.indices.size());
+
+  const HalfEdgeMesh half_edge_mesh{welded_mesh.positions, welded_mesh.normals, {}, welded_mesh.indices};
+  EXPECT_EQ(81, half_edge_mesh.vertices().size());
+  EXPECT_EQ(2 * (8 * 9 * 2 + 8 * 8), half_edge_mesh.edges().size());
+}
+
+TEST(VertexWelderTest, TestWeldIsIndependentOfThreadCount) {
+  const auto soup = CreateGridSoup(16, 1.0e-6f);
+  const auto expected_mesh = Weld(soup, {}, 1);
+  for (const auto thread_count : {2, 3, 8}) {
+    const auto welded_mesh = Weld(soup, {}, static_cast<std::size_t>(thread_count));
+    EXPECT_EQ(expected_mesh.positions, welded_mesh.positions);
+    EXPECT_EQ(expected_mesh.normals, welded_mesh.normals);
+    EXPECT_EQ(expected_mesh.indices, welded_mesh.indices);
+  }
+}
+
+TEST(VertexWelderTest, TestWeldExactPositionsOnly) {
+  const auto soup = CreateGridSoup(2, 1.0e-6f);
+  WeldOptions options;
+  options.position_tolerance = 0.0f;
+  EXPECT_EQ(soup.positions.size(), Weld(soup, options).positions.size());
+}
+
+TEST(VertexWelderTest, TestWeldDoesNotMergeDistinctAttributes) {
+  // the square is split along its diagonal by per-face normals and texture coordinates
+  const vertex_welder::WeldedMesh mesh{
+      .positions = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f},
+                    {0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 1.0e-7f}},
+      .normals = {{0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f},
+                  {0.0f, 1.0e-3f, 1.0f}, {0.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 1.0f}},
+      .texcoords = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}},
+      .indices = {0, 1, 2, 3, 4, 5}};
+  const auto welded_mesh = Weld(mesh);
+
+  // the first corner agrees within tolerance but the shared diagonal corner has a different normal
+  EXPECT_EQ(5, welded_mesh.positions.size());
+  EXPECT_EQ((std::vector<std::uint32_t>{0, 1, 2, 0, 3, 4}), welded_mesh.indices);
+  EXPECT_EQ(welded_mesh.positions[2], welded_mesh.positions[3]);
+  EXPECT_EQ(mesh.normals[4], welded_mesh.normals[3]);
+  EXPECT_EQ((glm::vec3{0.0f, 1.0f, 1.0e-7f}), welded_mesh.positions[4]);
+
+  const HalfEdgeMesh half_edge_mesh{welded_mesh.positions, welded_mesh.normals, welded_mesh.texcoords,
+                                    welded_mesh.indices};
+  EXPECT_EQ(4, half_edge_mesh.vertices().size());
+  EXPECT_EQ(10, half_edge_mesh.edges().size());
+}
+
+TEST(VertexWelderTest, TestWeldDiscardsDegenerateTriangles) {
+  const vertex_welder::WeldedMesh mesh{
+      .positions = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0e-7f, 0.0f}},
+      .normals = {},
+      .texcoords = {},
+      .indices = {0, 1, 2, 1, 3, 2}};
+  const auto welded_mesh = Weld(mesh);
+  EXPECT_EQ(3, welded_mesh.positions.size());
+  EXPECT_EQ((std::vector<std::uint32_t>{0, 1, 2}), welded_mesh.indices);
+}
+
+TEST(VertexWelderTest, TestWeldKeepsOriginalVerticesOfDuplicateTriangles) {
+  const vertex_welder::WeldedMesh mesh{
+      .positions = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+                    {1.0e-7f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 1.0e-7f}},
+      .normals = {},
+      .texcoords = {},
+      .indices = {0, 1, 2, 3, 4, 5}};
+  const auto welded_mesh = Weld(mesh);
+
+  // welding the second triangle would duplicate every directed edge of the first triangle
+  EXPECT_EQ(mesh.positions, welded_mesh.positions);
+  EXPECT_EQ(mesh.indices, welded_mesh.indices);
+}
+
+TEST(VertexWelderTest, TestWeldSplitsTouchingShells) {
+  // two spheres whose surfaces are closer than the position tolerance at a single point
+  const auto sphere = test::CreateSubdividedOctahedron(2);
+  const auto vertex_count = static_cast<std::uint32_t>(sphere.positions().size());
+  vertex_welder::WeldedMesh mesh;
+  for (const auto& offset : {glm::vec3{0.0f}, glm::vec3{2.000001f, 0.0f, 0.0f}}) {
+    for (const auto& position : sphere.positions()) {
+      mesh.positions.push_back(position + offset);
+      mesh.normals.push_back(position);
+    }
+  }
+  mesh.indices.assign(sphere.indices().begin(), sphere.indices().end());
+  for (const auto index : sphere.indices()) mesh.indices.push_back(index + vertex_count);
+
+  // the shells share no edges so the vertex welded between them would join two fans of triangles
+  const auto welded_mesh = Weld(mesh, WeldOptions{.position_tolerance = 1.0e-5f});
+  std::set<std::tuple<float, float, float>> touching_positions;
+  for (const auto& position : welded_mesh.positions) {
+    if (glm::distance(position, glm::vec3{1.0f, 0.0f, 0.0f}) < 1.0e-3f) {
+      touching_positions.emplace(position.x, position.y, position.z);
+    }
+  }
+  EXPECT_EQ(2, touching_positions.size());
+  EXPECT_EQ(mesh.indices.size(), welded_mesh.indices.size());
+
+  SimplifierOptions options;
+  options.normal_weight = 1.0f;
+  MeshSimplifier mesh_simplifier{MeshData{welded_mesh.positions, welded_mesh.normals, {}, welded_mesh.indices},
+                                 nullptr,
+                                 options};
+  mesh_simplifier.Simplify(welded_mesh.indices.size() / 3 / 10);
+  EXPECT_LT(mesh_simplifier.face_count(), welded_mesh.indices.size() / 3 / 10);
+}
+
+TEST(VertexWelderTest, TestWeldInvalidInput) {
+  const std::vector<glm::vec3> positions{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+  const std::vector<glm::vec3> normals{{0.0f, 0.0f, 1.0f}};
+  EXPECT_THROW(std::ignore = vertex_welder::Weld(positions, {}, {}, std::vector<std::uint32_t>{0, 1}),
+               std::invalid_argument);
+  EXPECT_THROW(std::ignore = vertex_welder::Weld(positions, {}, {}, std::vector<std::uint32_t>{0, 1, 3}),
+               std::invalid_argument);
+  EXPECT_THROW(std::ignore = vertex_welder::Weld(positions, normals, {}, std::vector<std::uint32_t>{0, 1, 2}),
+               std::invalid_argument);
+
+  WeldOptions options;
+  options.position_tolerance = -1.0f;
+  EXPECT_THROW(std::ignore = vertex_welder::Weld(positions, {}, {}, std::vector<std::uint32_t>{0, 1, 2}, options),
+               std::invalid_argument);
+}
+
+}  // namespace
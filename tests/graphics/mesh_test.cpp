@@ -1,6 +1,7 @@
 #include "graphics/mesh.cpp"  // NOLINT
 
-#include <array>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -9,54 +10,48 @@ namespace {
 
 using namespace gfx;  // NOLINT
 
-TEST(MeshTest, TestValidateMeshWithInvalidNumberOfPositions) {
-  for (auto i = 0; i <= 4; ++i) {
-    if (i != 3) {
-      EXPECT_THROW((gfx::Mesh{std::vector<glm::vec3>(i), {}, {}, {}}), std::invalid_argument);
-    }
-  }
+TEST(MeshTest, TestCreateMeshMovesMeshData) {
+  std::vector<glm::vec3> positions(3);
+  const auto* const positions_data = positions.data();
+  const Mesh mesh{MeshData{std::move(positions), {}, {}, {0, 1, 2}}};
+  EXPECT_EQ(mesh.positions().data(), positions_data);
+  EXPECT_EQ(mesh.indices(), (std::vector<std::uint32_t>{0, 1, 2}));
 }
 
-TEST(MeshTest, TestValidateMeshWithInvalidNumberOfTextureCoordinates) {
-  const std::vector<glm::vec3> positions(3);
-  for (auto i = 1; i <= 4; ++i) {
-    if (i != 3) {
-      EXPECT_THROW((gfx::Mesh{positions, {}, std::vector<glm::vec2>(i), {}}), std::invalid_argument);
-    }
-  }
+TEST(MeshTest, TestMoveMesh) {
+  Mesh mesh{MeshData{std::vector<glm::vec3>(3), {}, {}, {0, 1, 2}}};
+  Mesh moved_mesh{MeshData{std::vector<glm::vec3>(6)}};
+  moved_mesh = std::move(mesh);
+  EXPECT_EQ(moved_mesh.positions().size(), 3);
+  EXPECT_EQ(moved_mesh.indices().size(), 3);
 }
 
-TEST(MeshTest, TestValidateMeshInvalidNumberOfNormals) {
-  const std::vector<glm::vec3> positions(3);
-  for (auto i = 1; i <= 4; ++i) {
-    if (i != 3) {
-      EXPECT_THROW((gfx::Mesh{positions, std::vector<glm::vec3>(i), {}, {}}), std::invalid_argument);
-    }
-  }
+TEST(MeshTest, TestResizeIndices) {
+  Mesh mesh{MeshData{std::vector<glm::vec3>(3), {}, {}, {0, 1, 2, 2, 1, 0}}};
+
+  mesh.ResizeIndices(3);
+  EXPECT_EQ(mesh.indices().size(), 3);
+
+  mesh.ResizeIndices(6);
+  EXPECT_EQ(mesh.indices().size(), 6);
 }
 
-TEST(MeshTest, TestValidateMeshWithInvalidIndices) {
-  const std::vector<glm::vec3> positions(3);
-  for (auto i = 1; i <= 4; ++i) {
-    if (i != 3) {
-      EXPECT_THROW((gfx::Mesh{positions, {}, {}, std::vector<GLuint>(i)}), std::invalid_argument);
-    }
-  }
+TEST(MeshTest, TestResizeIndicesWithInvalidSize) {
+  Mesh mesh{MeshData{std::vector<glm::vec3>(3), {}, {}, {0, 1, 2}}};
+  EXPECT_THROW(mesh.ResizeIndices(2), std::invalid_argument);
+  EXPECT_THROW(mesh.ResizeIndices(6), std::invalid_argument);
 }
 
-TEST(MeshTest, TestValidateMeshWithCorrectNumberOfPositionsTextureCoordinatesAndNormals) {
-  const std::vector<glm::vec3> positions(3);
-  const std::vector<glm::vec3> normals(3);
-  const std::vector<glm::vec2> texcoords(3);
-  EXPECT_NO_THROW((gfx::Mesh{positions, normals, texcoords, {}}));
+TEST(MeshTest, TestUpdateIndices) {
+  Mesh mesh{MeshData{std::vector<glm::vec3>(3), {}, {}, {0, 1, 2, 0, 1, 2}}};
+  mesh.UpdateIndices(3, std::vector<std::uint32_t>{2, 1, 0});
+  EXPECT_EQ(mesh.indices(), (std::vector<std::uint32_t>{0, 1, 2, 2, 1, 0}));
 }
 
-TEST(MeshTest, TestValidateMeshWithCorrectNumberOfPositionsTextureCoordinatesNormalsAndIndices) {
-  static constexpr std::array<glm::vec3, 4> kPositions{};
-  static constexpr std::array<glm::vec3, 5> kNormals{};
-  static constexpr std::array<glm::vec2, 2> kTextureCoordinates{};
-  static constexpr std::array<GLuint, 3> kIndices{};
-  EXPECT_NO_THROW((gfx::Mesh{kPositions, kNormals, kTextureCoordinates, kIndices}));
+TEST(MeshTest, TestUpdateIndicesOutOfRange) {
+  Mesh mesh{MeshData{std::vector<glm::vec3>(3), {}, {}, {0, 1, 2}}};
+  const std::vector<std::uint32_t> indices{0, 1, 2};
+  EXPECT_THROW(mesh.UpdateIndices(1, indices), std::out_of_range);
 }
 
 }  // namespace
@@ -0,0 +1,129 @@
+#include "graphics/view_dependent_mesh.cpp"  // NOLINT
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+/**
+ * @brief Creates a progressive mesh with a single recorded edge contraction applied.
+ * @param add_untouched_face Indicates if a disjoint triangle that no edge contraction touches should be added.
+ */
+ProgressiveMesh CreateProgressiveMesh(const bool add_untouched_face = false) {
+  std::vector<glm::vec3> positions{
+      {1.0f, 0.0f, 0.0f},   // v0
+      {2.0f, 0.0f, 0.0f},   // v1
+      {0.5f, -1.0f, 0.0f},  // v2
+      {1.5f, -1.0f, 0.0f},  // v3
+      {2.5f, -1.0f, 0.0f},  // v4
+      {3.0f, 0.0f, 0.0f},   // v5
+      {2.5f, 1.0f, 0.0f},   // v6
+      {1.5f, 1.0f, 0.0f},   // v7
+      {0.5f, 1.0f, 0.0f},   // v8
+      {0.0f, 0.0f, 0.0f}    // v9
+  };
+
+  std::vector<std::uint32_t> indices{
+      0, 2, 3,  // f0
+      0, 3, 1,  // f1
+      0, 1, 7,  // f2
+      0, 7, 8,  // f3
+      0, 8, 9,  // f4
+      0, 9, 2,  // f5
+      1, 3, 4,  // f6
+      1, 4, 5,  // f7
+      1, 5, 6,  // f8
+      1, 6, 7   // f9
+  };
+
+  if (add_untouched_face) {
+    positions.insert(positions.end(), {{4.0f, 0.0f, 0.0f}, {5.0f, 0.0f, 0.0f}, {4.5f, 1.0f, 0.0f}});
+    indices.insert(indices.end(), {10, 11, 12});
+  }
+
+  const auto v = static_cast<int>(positions.size());
+  ProgressiveMesh progressive_mesh{MeshData{std::move(positions), {}, {}, std::move(indices)}};
+  progressive_mesh.Append(VertexSplit{
+      .collapsed_vertices = {0, 1},
+      .vertex = v,
+      .position = glm::vec3{1.5f, 0.0f, 0.0f},
+      .removed_faces = {{0, 2, 3}, {0, 3, 1}, {0, 1, 7}, {0, 7, 8}, {0, 8, 9},
+                        {0, 9, 2}, {1, 3, 4}, {1, 4, 5}, {1, 5, 6}, {1, 6, 7}},
+      .added_faces = {{2, 3, v}, {3, 4, v}, {4, 5, v}, {5, 6, v}, {6, 7, v}, {7, 8, v}, {8, 9, v}, {2, v, 9}},
+  });
+  progressive_mesh.SetFaceCount(0);
+
+  return progressive_mesh;
+}
+
+glm::mat4 GetModelViewTransform(const float distance) {
+  const glm::vec3 look_at{1.5f, 0.0f, 0.0f};
+  return glm::lookAt(look_at + glm::vec3{0.0f, 0.0f, distance}, look_at, glm::vec3{0.0f, 1.0f, 0.0f});
+}
+
+const glm::mat4 kProjectionTransform = glm::perspective(glm::radians(45.0f), 1.0f, 0.1f, 10000.0f);
+constexpr auto kViewportHeight = 720.0f;
+
+TEST(ViewDependentMeshTest, TestCreateViewDependentMeshFromCurrentLevelOfDetail) {
+  const ViewDependentMesh view_dependent_mesh{CreateProgressiveMesh()};
+  EXPECT_EQ(view_dependent_mesh.face_count(), 8);
+  EXPECT_EQ(view_dependent_mesh.mesh().indices().size(), 24);
+}
+
+TEST(ViewDependentMeshTest, TestCreateViewDependentMeshWithoutVertexSplits) {
+  ProgressiveMesh progressive_mesh{CreateProgressiveMesh().ToMesh()};
+  ViewDependentMesh view_dependent_mesh{progressive_mesh};
+  EXPECT_EQ(view_dependent_mesh.face_count(), 8);
+
+  view_dependent_mesh.Update(GetModelViewTransform(1.0f), kProjectionTransform, kViewportHeight);
+  EXPECT_EQ(view_dependent_mesh.face_count(), 8);
+}
+
+TEST(ViewDependentMeshTest, TestRefineWithFacesUntouchedByVertexSplits) {
+  ViewDependentMesh view_dependent_mesh{CreateProgressiveMesh(true)};
+  EXPECT_EQ(view_dependent_mesh.face_count(), 9);
+  EXPECT_EQ(view_dependent_mesh.mesh().indices().size(), 27);
+
+  view_dependent_mesh.Update(GetModelViewTransform(1.0f), kProjectionTransform, kViewportHeight);
+  EXPECT_EQ(view_dependent_mesh.face_count(), 11);
+
+  view_dependent_mesh.Update(GetModelViewTransform(5000.0f), kProjectionTransform, kViewportHeight);
+  EXPECT_EQ(view_dependent_mesh.face_count(), 9);
+}
+
+TEST(ViewDependentMeshTest, TestRefineNearCamera) {
+  ViewDependentMesh view_dependent_mesh{CreateProgressiveMesh()};
+  view_dependent_mesh.Update(GetModelViewTransform(1.0f), kProjectionTransform, kViewportHeight);
+  EXPECT_EQ(view_dependent_mesh.face_count(), 10);
+  EXPECT_EQ(view_dependent_mesh.mesh().indices().size(), 30);
+}
+
+TEST(ViewDependentMeshTest, TestCoarsenFarFromCamera) {
+  ViewDependentMesh view_dependent_mesh{CreateProgressiveMesh()};
+  view_dependent_mesh.Update(GetModelViewTransform(1.0f), kProjectionTransform, kViewportHeight);
+  view_dependent_mesh.Update(GetModelViewTransform(5000.0f), kProjectionTransform, kViewportHeight);
+  EXPECT_EQ(view_dependent_mesh.face_count(), 8);
+}
+
+TEST(ViewDependentMeshTest, TestCoarsenOutsideViewFrustum) {
+  ViewDependentMesh view_dependent_mesh{CreateProgressiveMesh()};
+  view_dependent_mesh.Update(GetModelViewTransform(1.0f), kProjectionTransform, kViewportHeight);
+  view_dependent_mesh.Update(GetModelViewTransform(-1.0f), kProjectionTransform, kViewportHeight);
+  EXPECT_EQ(view_dependent_mesh.face_count(), 8);
+}
+
+TEST(ViewDependentMeshTest, TestUpdateRespectsOperationBudget) {
+  RefinementOptions options;
+  options.max_operations = 0;
+  ViewDependentMesh view_dependent_mesh{CreateProgressiveMesh(), options};
+  view_dependent_mesh.Update(GetModelViewTransform(1.0f), kProjectionTransform, kViewportHeight);
+  EXPECT_EQ(view_dependent_mesh.face_count(), 8);
+}
+
+}  // namespace
@@ -0,0 +1,159 @@
+#include "io/batch_io.cpp"  // NOLINT
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+class BatchIoTest : public testing::TestWithParam<bool> {
+protected:
+  BatchIoTest() : directory_{std::filesystem::path{testing::TempDir()} / "batch_io_test"} {
+    std::filesystem::create_directories(directory_);
+    options_.use_io_uring = GetParam();
+  }
+
+  ~BatchIoTest() override { std::filesystem::remove_all(directory_); }
+
+  /** @brief Creates files in the test directory with distinct contents of varying length including an empty file. */
+  std::vector<std::string> CreateFiles(const std::size_t count) {
+    std::vector<std::string> contents;
+    for (std::size_t i = 0; i < count; ++i) {
+      contents.emplace_back(i * 997, static_cast<char>('a' + i % 26));
+      std::ofstream{GetFilepath(i), std::ios::binary} << contents.back();
+      filepaths_.push_back(GetFilepath(i));
+    }
+    return contents;
+  }
+
+  /** @brief Gets the path to a file in the test directory. */
+  [[nodiscard]] std::filesystem::path GetFilepath(const std::size_t i) const {
+    return directory_ / ("file" + std::to_string(i) + ".txt");
+  }
+
+  std::filesystem::path directory_;
+  std::vector<std::filesystem::path> filepaths_;
+  BatchIoOptions options_;
+};
+
+TEST_P(BatchIoTest, TestReadFiles) {
+  const auto expected_contents = CreateFiles(100);
+  options_.queue_depth = 8;
+
+  std::mutex mutex;
+  std::vector<std::string> contents(filepaths_.size());
+  std::vector<std::size_t> read_counts(filepaths_.size(), 0);
+  batch_io::ReadFiles(
+      filepaths_,
+      [&](const std::size_t i, const std::string_view file_contents) {
+        const std::scoped_lock lock{mutex};
+        contents.at(i) = file_contents;
+        ++read_counts.at(i);
+      },
+      options_,
+      4);
+
+  EXPECT_EQ(expected_contents, contents);
+  EXPECT_EQ(std::vector<std::size_t>(filepaths_.size(), 1), read_counts);
+}
+
+TEST_P(BatchIoTest, TestReadFilesWithSingleBuffer) {
+  const auto expected_contents = CreateFiles(10);
+  options_.queue_depth = 1;
+
+  std::atomic<std::size_t> in_parser_count = 0, max_in_parser_count = 0;
+  std::vector<std::string> contents(filepaths_.size());
+  batch_io::ReadFiles(
+      filepaths_,
+      [&](const std::size_t i, const std::string_view file_contents) {
+        max_in_parser_count = std::max(max_in_parser_count.load(), ++in_parser_count);
+        contents.at(i) = file_contents;
+        --in_parser_count;
+      },
+      options_,
+      4);
+
+  EXPECT_EQ(expected_contents, contents);
+  if (GetParam()) {  // the thread pool maps files instead of buffering them
+    EXPECT_EQ(1, max_in_parser_count);
+  }
+}
+
+TEST_P(BatchIoTest, TestReadFilesReportsFirstFailureAfterReadingEveryFile) {
+  const auto expected_contents = CreateFiles(6);
+  filepaths_[4] = directory_ / "missing4.txt";
+  filepaths_[2] = directory_ / "missing2.txt";
+
+  std::atomic<std::size_t> read_count = 0;
+  try {
+    batch_io::ReadFiles(
+        filepaths_, [&](const std::size_t, const std::string_view) { ++read_count; }, options_, 2);
+    FAIL() << "Expected std::runtime_error";
+  } catch (const std::runtime_error& e) {
+    EXPECT_NE(std::string_view{e.what()}.find("missing2.txt"), std::string_view::npos);
+  }
+  EXPECT_EQ(4, read_count);
+}
+
+TEST_P(BatchIoTest, TestReadFilesRethrowsParserException) {
+  CreateFiles(4);
+  EXPECT_THROW(batch_io::ReadFiles(
+                   filepaths_,
+                   [](const std::size_t i, const std::string_view) {
+                     if (i == 3) throw std::invalid_argument{"Invalid file"};
+                   },
+                   options_,
+                   2),
+               std::invalid_argument);
+}
+
+TEST_P(BatchIoTest, TestWriteFiles) {
+  std::vector<std::string> contents;
+  for (std::size_t i = 0; i < 50; ++i) {
+    contents.emplace_back(i * 1009, static_cast<char>('A' + i % 26));
+    filepaths_.push_back(GetFilepath(i));
+  }
+  std::ofstream{filepaths_.front(), std::ios::binary} << "contents longer than the file that replaces them";
+  options_.queue_depth = 4;
+
+  const std::vector<std::string_view> content_views{contents.begin(), contents.end()};
+  batch_io::WriteFiles(filepaths_, content_views, options_, 4);
+
+  for (std::size_t i = 0; i < filepaths_.size(); ++i) {
+    std::ifstream ifs{filepaths_[i], std::ios::binary};
+    EXPECT_EQ(contents[i], (std::string{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}}));
+  }
+}
+
+TEST_P(BatchIoTest, TestWriteFilesToMissingDirectoryThrowsException) {
+  const std::vector filepaths{GetFilepath(0), directory_ / "missing" / "file.txt"};
+  const std::vector<std::string_view> contents{"first", "second"};
+  EXPECT_THROW(batch_io::WriteFiles(filepaths, contents, options_), std::runtime_error);
+  EXPECT_TRUE(std::filesystem::exists(filepaths.front()));
+}
+
+TEST_P(BatchIoTest, TestInvalidArguments) {
+  CreateFiles(2);
+  options_.queue_depth = 0;
+  EXPECT_THROW(batch_io::ReadFiles(filepaths_, [](const std::size_t, const std::string_view) {}, options_),
+               std::invalid_argument);
+
+  options_.queue_depth = 1;
+  const std::vector<std::string_view> contents{"contents"};
+  EXPECT_THROW(batch_io::WriteFiles(filepaths_, contents, options_), std::invalid_argument);
+}
+
+INSTANTIATE_TEST_SUITE_P(IoUringAndThreadPool, BatchIoTest, testing::Bool());
+
+}  // namespace
@@ -0,0 +1,212 @@
+#include "io/gltf_writer.cpp"  // NOLINT
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+/** @brief The JSON document and binary buffer of a .glb file. */
+struct Glb {
+  std::string json;
+  std::string binary;
+};
+
+/** @brief Reads a .glb file written by the test, validates its container, and removes it. */
+Glb ReadGlb(const std::filesystem::path& filepath) {
+  std::string contents;
+  {
+    std::ifstream ifs{filepath, std::ios::binary};
+    contents.assign(std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{});
+  }
+  std::filesystem::remove(filepath);
+
+  const auto read_uint32 = [&](const std::size_t offset) {
+    std::uint32_t value = 0;
+    std::memcpy(&value, contents.data() + offset, sizeof(value));
+    return value;
+  };
+
+  EXPECT_EQ(0, contents.size() % 4);
+  EXPECT_EQ(0x46546C67, read_uint32(0));
+  EXPECT_EQ(2, read_uint32(4));
+  EXPECT_EQ(contents.size(), read_uint32(8));
+
+  const auto json_size = read_uint32(12);
+  EXPECT_EQ(0x4E4F534A, read_uint32(16));
+  const auto binary_offset = 20 + json_size;
+  const auto binary_size = read_uint32(binary_offset);
+  EXPECT_EQ(0x004E4942, read_uint32(binary_offset + 4));
+  EXPECT_EQ(contents.size(), binary_offset + 8 + binary_size);
+
+  return Glb{.json = contents.substr(20, json_size), .binary = contents.substr(binary_offset + 8, binary_size)};
+}
+
+/** @brief Creates a tetrahedron scaled and translated to fit in a bounding box. */
+MeshData CreateTetrahedron(const float scale, const glm::vec3& offset = glm::vec3{0.0f}) {
+  const std::vector positions{offset, offset + glm::vec3{scale, 0.0f, 0.0f}, offset + glm::vec3{0.0f, scale, 0.0f},
+                              offset + glm::vec3{0.0f, 0.0f, scale}};
+  const std::vector normals{glm::vec3{0.0f, 0.0f, -1.0f},
+                            glm::vec3{1.0f, 0.0f, 0.0f},
+                            glm::vec3{0.0f, 1.0f, 0.0f},
+                            glm::vec3{0.0f, 0.0f, 1.0f}};
+  const std::vector texcoords{glm::vec2{0.0f}, glm::vec2{1.0f, 0.0f}, glm::vec2{0.0f, 1.0f}, glm::vec2{1.0f}};
+  const std::vector<std::uint32_t> indices{0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 3};
+  return MeshData{positions, normals, texcoords, indices};
+}
+
+TEST(GltfWriterTest, TestWriteMeshes) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "gltf_writer_test.glb";
+  glm::mat4 model_transform{1.0f};
+  model_transform[3] = glm::vec4{1.0f, 2.0f, 3.0f, 1.0f};
+  std::vector<MeshData> meshes;
+  meshes.push_back(CreateTetrahedron(2.0f));
+  meshes.push_back(
+      MeshData{std::vector{glm::vec3{0.0f}, glm::vec3{1.0f}, glm::vec3{2.0f}}, {}, {}, {}, model_transform});
+
+  gltf_writer::WriteGlb(filepath, meshes);
+  const auto [json, binary] = ReadGlb(filepath);
+
+  EXPECT_EQ(std::string::npos, json.find("extensionsUsed"));
+  EXPECT_NE(std::string::npos, json.find(R"("scenes":[{"nodes":[0,1]}])"));
+  EXPECT_NE(std::string::npos,
+            json.find(R"("nodes":[{"mesh":0},{"mesh":1,"matrix":[1,0,0,0,0,1,0,0,0,0,1,0,1,2,3,1]}])"));
+  EXPECT_NE(std::string::npos,
+            json.find(R"({"bufferView":0,"componentType":5126,"count":4,"type":"VEC3","min":[0,0,0],"max":[2,2,2]})"));
+  EXPECT_NE(std::string::npos, json.find(R"("attributes":{"POSITION":0,"NORMAL":1,"TEXCOORD_0":2},"indices":3)"));
+  EXPECT_NE(std::string::npos, json.find(R"({"bufferView":3,"componentType":5123,"count":12,"type":"SCALAR"})"));
+  EXPECT_NE(std::string::npos, json.find(R"({"primitives":[{"attributes":{"POSITION":4},"mode":4}]})"));
+
+  // attributes are stored in order without padding and indices are padded to the alignment of the next buffer view
+  const auto& positions = meshes[0].positions();
+  ASSERT_EQ(4 * 12 + 4 * 12 + 4 * 8 + 24 + 3 * 12, binary.size());
+  EXPECT_EQ(0, std::memcmp(binary.data(), positions.data(), positions.size() * sizeof(glm::vec3)));
+  std::array<std::uint16_t, 12> indices{};
+  std::memcpy(indices.data(), binary.data() + 128, sizeof(indices));
+  EXPECT_EQ((std::array<std::uint16_t, 12>{0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 3}), indices);
+}
+
+TEST(GltfWriterTest, TestWriteLevelsOfDetail) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "gltf_writer_test.glb";
+  const std::array lods{mesh::LevelOfDetail{.mesh = CreateTetrahedron(1.0f), .face_count = 4, .max_error = 0.0f},
+                        mesh::LevelOfDetail{.mesh = CreateTetrahedron(1.0f), .face_count = 4, .max_error = 0.1f},
+                        mesh::LevelOfDetail{.mesh = CreateTetrahedron(1.0f), .face_count = 4, .max_error = 0.2f}};
+
+  gltf_writer::WriteGlb(filepath, lods);
+  const auto [json, binary] = ReadGlb(filepath);
+
+  EXPECT_NE(std::string::npos, json.find(R"("extensionsUsed":["MSFT_lod"])"));
+  EXPECT_EQ(std::string::npos, json.find("extensionsRequired"));
+  EXPECT_NE(std::string::npos, json.find(R"("scenes":[{"nodes":[0]}])"));
+  EXPECT_NE(std::string::npos,
+            json.find(R"("nodes":[{"mesh":0,"extensions":{"MSFT_lod":{"ids":[1,2]}}},{"mesh":1},{"mesh":2}])"));
+}
+
+TEST(GltfWriterTest, TestWriteQuantizedLevelsOfDetail) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "gltf_writer_test.glb";
+  const glm::vec3 offset{-1.0f, 2.0f, 0.5f};
+  const std::array lods{
+      mesh::LevelOfDetail{.mesh = CreateTetrahedron(4.0f, offset), .face_count = 4, .max_error = 0.0f},
+      mesh::LevelOfDetail{.mesh = CreateTetrahedron(2.0f, offset), .face_count = 4, .max_error = 0.1f}};
+  GltfOptions options;
+  options.quantize = true;
+
+  gltf_writer::WriteGlb(filepath, lods, options);
+  const auto [json, binary] = ReadGlb(filepath);
+
+  EXPECT_NE(std::string::npos, json.find(R"("extensionsUsed":["MSFT_lod","KHR_mesh_quantization"])"));
+  EXPECT_NE(std::string::npos, json.find(R"("extensionsRequired":["KHR_mesh_quantization"])"));
+
+  // both levels of detail are dequantized by the same transform so switching between them does not shift positions
+  const std::string matrix{R"("matrix":[4,0,0,0,0,4,0,0,0,0,4,0,-1,2,0.5,1])"};
+  const auto first_matrix = json.find(matrix);
+  ASSERT_NE(std::string::npos, first_matrix);
+  EXPECT_NE(std::string::npos, json.find(matrix, first_matrix + 1));
+
+  EXPECT_NE(std::string::npos,
+            json.find(R"({"bufferView":0,"componentType":5123,"normalized":true,"count":4,"type":"VEC3",)"
+                      R"("min":[0,0,0],"max":[65535,65535,65535]})"));
+  EXPECT_NE(std::string::npos,
+            json.find(R"({"buffer":0,"byteOffset":0,"byteLength":32,"byteStride":8,"target":34962})"));
+  EXPECT_NE(std::string::npos, json.find(R"({"bufferView":1,"componentType":5120,"normalized":true,"count":4)"));
+  EXPECT_NE(std::string::npos, json.find(R"({"bufferView":2,"componentType":5123,"normalized":true,"count":4)"));
+  EXPECT_NE(std::string::npos, json.find(R"("max":[32768,32768,32768])"));
+
+  std::array<std::uint16_t, 4> quantized_position{};
+  std::memcpy(quantized_position.data(), binary.data() + 8, sizeof(quantized_position));
+  EXPECT_EQ((std::array<std::uint16_t, 4>{65535, 0, 0, 0}), quantized_position);
+
+  std::array<std::int8_t, 4> quantized_normal{};
+  std::memcpy(quantized_normal.data(), binary.data() + 32, sizeof(quantized_normal));
+  EXPECT_EQ((std::array<std::int8_t, 4>{0, 0, -127, 0}), quantized_normal);
+}
+
+TEST(GltfWriterTest, TestWriteTexcoordsOutsideUnitIntervalAsFloats) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "gltf_writer_test.glb";
+  std::vector<MeshData> meshes;
+  meshes.push_back(
+      MeshData{std::vector<glm::vec3>(3), {}, std::vector{glm::vec2{0.0f}, glm::vec2{2.0f}, glm::vec2{1.0f}}});
+  GltfOptions options;
+  options.quantize = true;
+
+  gltf_writer::WriteGlb(filepath, meshes, options);
+  const auto [json, binary] = ReadGlb(filepath);
+
+  EXPECT_NE(std::string::npos, json.find(R"({"bufferView":1,"componentType":5126,"count":3,"type":"VEC2"})"));
+}
+
+TEST(GltfWriterTest, TestWriteShortIndicesBelowPrimitiveRestartValue) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "gltf_writer_test.glb";
+
+  // the largest index of a mesh with 65535 vertices is 65534 which is the largest valid 16-bit index
+  for (const auto& [vertex_count, component_type] : {std::pair{65535u, 5123}, std::pair{65536u, 5125}}) {
+    std::vector<std::uint32_t> indices{0, 1, vertex_count - 1};
+    std::vector<MeshData> meshes;
+    meshes.push_back(MeshData{std::vector<glm::vec3>(vertex_count), {}, {}, std::move(indices)});
+
+    gltf_writer::WriteGlb(filepath, meshes);
+    const auto [json, binary] = ReadGlb(filepath);
+
+    EXPECT_NE(std::string::npos,
+              json.find(std::format(R"({{"bufferView":1,"componentType":{},"count":3,"type":"SCALAR"}})",
+                                    component_type)));
+  }
+}
+
+TEST(GltfWriterTest, TestWriteNonFiniteValueThrowsException) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "gltf_writer_test.glb";
+  std::vector<MeshData> meshes;
+  meshes.push_back(CreateTetrahedron(1.0f, glm::vec3{std::numeric_limits<float>::infinity(), 0.0f, 0.0f}));
+
+  EXPECT_THROW(gltf_writer::WriteGlb(filepath, meshes), std::invalid_argument);
+  GltfOptions options;
+  options.quantize = true;
+  EXPECT_THROW(gltf_writer::WriteGlb(filepath, meshes, options), std::invalid_argument);
+
+  meshes.front() =
+      MeshData{std::vector<glm::vec3>(3), {}, {}, {}, glm::mat4{std::numeric_limits<float>::quiet_NaN()}};
+  EXPECT_THROW(gltf_writer::WriteGlb(filepath, meshes), std::invalid_argument);
+  EXPECT_FALSE(std::filesystem::exists(filepath));
+}
+
+TEST(GltfWriterTest, TestWriteWithoutMeshesThrowsException) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "gltf_writer_test.glb";
+  EXPECT_THROW(gltf_writer::WriteGlb(filepath, std::span<const MeshData>{}), std::invalid_argument);
+  EXPECT_THROW(gltf_writer::WriteGlb(filepath, std::span<const mesh::LevelOfDetail>{}), std::invalid_argument);
+  EXPECT_FALSE(std::filesystem::exists(filepath));
+}
+
+}  // namespace
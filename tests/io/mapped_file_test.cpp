@@ -0,0 +1,47 @@
+#include "io/mapped_file.cpp"  // NOLINT
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+class MappedFileTest : public testing::Test {
+protected:
+  MappedFileTest() : filepath_{std::filesystem::path{testing::TempDir()} / "mapped_file_test.txt"} {}
+
+  ~MappedFileTest() override { std::filesystem::remove(filepath_); }
+
+  std::filesystem::path filepath_;
+};
+
+TEST_F(MappedFileTest, TestMapFileContents) {
+  std::ofstream{filepath_, std::ios::binary} << "v 0.0 0.1 0.2\nf 1 2 3\n";
+  const MappedFile mapped_file{filepath_};
+  EXPECT_EQ("v 0.0 0.1 0.2\nf 1 2 3\n", mapped_file.contents());
+}
+
+TEST_F(MappedFileTest, TestMapEmptyFile) {
+  std::ofstream{filepath_, std::ios::binary}.flush();
+  const MappedFile mapped_file{filepath_};
+  EXPECT_TRUE(mapped_file.contents().empty());
+}
+
+TEST_F(MappedFileTest, TestMoveMappedFile) {
+  std::ofstream{filepath_, std::ios::binary} << "contents";
+  MappedFile mapped_file{filepath_};
+  const auto moved_mapped_file = std::move(mapped_file);
+  EXPECT_EQ("contents", moved_mapped_file.contents());
+  EXPECT_TRUE(mapped_file.contents().empty());  // NOLINT(bugprone-use-after-move)
+}
+
+TEST_F(MappedFileTest, TestMapMissingFileThrowsException) {
+  EXPECT_THROW(MappedFile{filepath_}, std::runtime_error);
+}
+
+}  // namespace
@@ -0,0 +1,122 @@
+#include "io/mesh_cache.cpp"  // NOLINT
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+class MeshCacheTest : public testing::Test {
+protected:
+  MeshCacheTest()
+      : directory_{std::filesystem::path{testing::TempDir()} / "mesh_cache_test"},
+        filepath_{directory_ / "mesh_cache_test.meshcache"} {
+    std::filesystem::create_directories(directory_);
+  }
+
+  ~MeshCacheTest() override { std::filesystem::remove_all(directory_); }
+
+  std::filesystem::path directory_;
+  std::filesystem::path filepath_;
+};
+
+TEST_F(MeshCacheTest, TestReadWrittenMeshCache) {
+  const std::vector positions{glm::vec3{0.0f, 0.1f, 0.2f}, glm::vec3{1.0f, 1.1f, 1.2f}, glm::vec3{2.0f, 2.1f, 2.2f}};
+  const std::vector normals{glm::vec3{0.0f, 0.0f, 1.0f}, glm::vec3{0.0f, 1.0f, 0.0f}, glm::vec3{1.0f, 0.0f, 0.0f}};
+  const std::vector texcoords{glm::vec2{0.0f, 0.0f}, glm::vec2{1.0f, 0.0f}, glm::vec2{0.0f, 1.0f}};
+  const std::vector<std::uint32_t> indices{0, 1, 2};
+  const MeshCache::Source source{.size = 42, .write_time = -7};
+
+  MeshCache::Write(filepath_, source, positions, normals, texcoords, indices);
+  const MeshCache mesh_cache{filepath_};
+
+  EXPECT_EQ(source, mesh_cache.source());
+  EXPECT_EQ(positions, (std::vector(mesh_cache.positions().begin(), mesh_cache.positions().end())));
+  EXPECT_EQ(normals, (std::vector(mesh_cache.normals().begin(), mesh_cache.normals().end())));
+  EXPECT_EQ(texcoords, (std::vector(mesh_cache.texcoords().begin(), mesh_cache.texcoords().end())));
+  EXPECT_EQ(indices, (std::vector(mesh_cache.indices().begin(), mesh_cache.indices().end())));
+  EXPECT_EQ(1, std::distance(std::filesystem::directory_iterator{directory_}, std::filesystem::directory_iterator{}));
+}
+
+TEST_F(MeshCacheTest, TestConcurrentWritesOfSameMeshCache) {
+  const std::vector positions{glm::vec3{0.0f}, glm::vec3{1.0f}, glm::vec3{2.0f}};
+  const std::vector<std::uint32_t> indices{0, 1, 2};
+  const MeshCache::Source source{.size = 42, .write_time = 7};
+
+  {
+    std::vector<std::jthread> writers;
+    for (auto i = 0; i < 8; ++i) {
+      writers.emplace_back([&] {
+        for (auto j = 0; j < 8; ++j) MeshCache::Write(filepath_, source, positions, {}, {}, indices);
+      });
+    }
+  }
+
+  const MeshCache mesh_cache{filepath_};
+  EXPECT_EQ(source, mesh_cache.source());
+  EXPECT_EQ(positions, (std::vector(mesh_cache.positions().begin(), mesh_cache.positions().end())));
+  EXPECT_EQ(indices, (std::vector(mesh_cache.indices().begin(), mesh_cache.indices().end())));
+}
+
+TEST_F(MeshCacheTest, TestMeshCacheArraysAreAligned) {
+  const std::vector positions{glm::vec3{0.0f}, glm::vec3{1.0f}, glm::vec3{2.0f}};
+  const std::vector<std::uint32_t> indices{0, 1, 2};
+  MeshCache::Write(filepath_, MeshCache::Source{}, positions, {}, {}, indices);
+  const MeshCache mesh_cache{filepath_};
+
+  EXPECT_TRUE(mesh_cache.normals().empty());
+  EXPECT_TRUE(mesh_cache.texcoords().empty());
+  EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(mesh_cache.positions().data()) % kArrayAlignment);  // NOLINT
+  EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(mesh_cache.indices().data()) % kArrayAlignment);    // NOLINT
+}
+
+TEST_F(MeshCacheTest, TestGetSourceChangesWithFileSize) {
+  std::ofstream{filepath_, std::ios::binary} << "v 0.0 0.1 0.2\n";
+  const auto source = MeshCache::GetSource(filepath_);
+  EXPECT_EQ(14, source.size);
+
+  std::ofstream{filepath_, std::ios::binary | std::ios::app} << "v 1.0 1.1 1.2\n";
+  EXPECT_NE(source, MeshCache::GetSource(filepath_));
+}
+
+TEST_F(MeshCacheTest, TestGetSourceOfMissingFileThrowsException) {
+  EXPECT_THROW((void)MeshCache::GetSource(filepath_), std::runtime_error);
+}
+
+TEST_F(MeshCacheTest, TestReadInvalidMeshCacheThrowsException) {
+  std::ofstream{filepath_, std::ios::binary} << "v 0.0 0.1 0.2\n";
+  EXPECT_THROW(MeshCache{filepath_}, std::runtime_error);
+}
+
+TEST_F(MeshCacheTest, TestReadTruncatedMeshCacheThrowsException) {
+  const std::vector positions(64, glm::vec3{1.0f});
+  MeshCache::Write(filepath_, MeshCache::Source{}, positions, {}, {}, {});
+  std::filesystem::resize_file(filepath_, std::filesystem::file_size(filepath_) - sizeof(glm::vec3));
+  EXPECT_THROW(MeshCache{filepath_}, std::runtime_error);
+}
+
+TEST_F(MeshCacheTest, TestReadMeshCacheWithUnsupportedVersionThrowsException) {
+  MeshCache::Write(filepath_, MeshCache::Source{}, {}, {}, {}, {});
+  {
+    std::fstream fs{filepath_, std::ios::binary | std::ios::in | std::ios::out};
+    fs.seekp(offsetof(MeshCacheHeader, version));
+    const auto version = kMeshCacheVersion + 1;
+    fs.write(reinterpret_cast<const char*>(&version), sizeof(version));  // NOLINT(*-reinterpret-cast)
+  }
+  EXPECT_THROW(MeshCache{filepath_}, std::runtime_error);
+}
+
+TEST_F(MeshCacheTest, TestReadMissingMeshCacheThrowsException) {
+  EXPECT_THROW(MeshCache{filepath_}, std::runtime_error);
+}
+
+}  // namespace
@@ -0,0 +1,573 @@
+#include "io/obj_loader.cpp"  // NOLINT
+
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+/**
+ * @brief Creates the contents of an .obj file for a grid whose faces reference texture coordinates and normals in a
+ *        pattern that shares some index groups between faces and splits others at the same vertex position.
+ */
+std::string CreateGridObj(const int size) {
+  std::ostringstream oss;
+  oss << "# grid\n";
+  for (auto i = 0; i <= size; ++i) {
+    for (auto j = 0; j <= size; ++j) oss << std::format("v {} {} 0.0\n", j, i);
+  }
+  for (auto i = 0; i < 4; ++i) oss << std::format("vt {} 0.5\nvn 0.0 0.{} 1.0\n", i, i);
+
+  for (auto i = 0; i < size; ++i) {
+    oss << "\n  # row\n";
+    for (auto j = 0; j < size; ++j) {
+      const auto v0 = i * (size + 1) + j + 1;
+      const auto v1 = v0 + 1;
+      const auto v2 = v0 + size + 1;
+      const auto v3 = v2 + 1;
+      const auto vt = (i + j) % 4 + 1;
+      oss << std::format("f {}/{}/1 {}/{}/2 {}/{}/3\n", v0, vt, v1, vt, v3, vt);
+      oss << std::format("\tf {}//4 {}//4 {}//4\n", v0, v3, v2);
+    }
+  }
+  return oss.str();
+}
+
+/** @brief Gets tokens delimited by a set of characters in a newly allocated vector. */
+std::vector<std::string_view> SplitTokens(const std::string_view line, const std::string_view delimiter) {
+  std::vector<std::string_view> tokens;
+  for (auto i = line.find_first_not_of(delimiter); i < line.size();) {
+    const auto j = std::min<>(line.find_first_of(delimiter, i), line.size());
+    tokens.push_back(line.substr(i, j - i));
+    i = line.find_first_not_of(delimiter, j);
+  }
+  return tokens;
+}
+
+/**
+ * @brief Parses the contents of an .obj file by copying each line with @c std::getline and splitting it and each of
+ *        its index groups into vectors of tokens which is how lines were parsed before they were scanned in place.
+ * @note Retained as a throughput baseline for the single-pass scanner and assumes well-formed input.
+ */
+ObjChunk ParseChunkWithSplit(const std::string& contents) {
+  const auto parse_float = [](const std::string_view token) {
+    float value{};
+    std::from_chars(token.data(), token.data() + token.size(), value);
+    return value;
+  };
+  const auto parse_index = [](const std::string_view token) {
+    int value{};
+    std::from_chars(token.data(), token.data() + token.size(), value);
+    return value - 1;
+  };
+
+  ObjChunk chunk;
+  std::istringstream iss{contents};
+  for (std::string line; std::getline(iss, line);) {
+    const auto tokens = SplitTokens(line, " \t");
+    if (tokens.empty()) continue;
+    if (tokens[0] == "v" || tokens[0] == "vn") {
+      (tokens[0] == "v" ? chunk.positions : chunk.normals)
+          .emplace_back(parse_float(tokens[1]), parse_float(tokens[2]), parse_float(tokens[3]));
+    } else if (tokens[0] == "vt") {
+      chunk.texcoords.emplace_back(parse_float(tokens[1]), parse_float(tokens[2]));
+    } else if (tokens[0] == "f") {
+      auto& face = chunk.faces.emplace_back();
+      for (std::size_t i = 0; i < face.size(); ++i) {
+        const auto index_tokens = SplitTokens(tokens[i + 1], "/");
+        const auto has_texcoord = index_tokens.size() == 3 || tokens[i + 1].find("//") == std::string_view::npos;
+        face[i] = glm::ivec3{parse_index(index_tokens[0]), kInvalidFaceElementIndex, kInvalidFaceElementIndex};
+        if (index_tokens.size() > 1 && has_texcoord) face[i][1] = parse_index(index_tokens[1]);
+        if (index_tokens.size() == 3 || (index_tokens.size() == 2 && !has_texcoord)) {
+          face[i][2] = parse_index(index_tokens.back());
+        }
+      }
+    }
+  }
+  return chunk;
+}
+
+TEST(StringTest, TestTrimWhitespaceString) {
+  static constexpr auto* kLine = "     ";
+  static_assert(Trim(kLine).empty());
+}
+
+TEST(StringTest, TestTrimString) {
+  static constexpr auto* kLine = "\t  Hello, World!  \t";
+  static_assert("Hello, World!" == Trim(kLine));
+}
+
+TEST(StringTest, TestNextTokenOfEmptyString) {
+  std::string_view line;
+  EXPECT_TRUE(NextToken(line).empty());
+  EXPECT_TRUE(line.empty());
+}
+
+TEST(StringTest, TestNextTokenOfWhitespaceString) {
+  std::string_view line = "   ";
+  EXPECT_TRUE(NextToken(line, " ").empty());
+  EXPECT_TRUE(line.empty());
+}
+
+TEST(StringTest, TestNextTokenOfNoWhitespaceString) {
+  std::string_view line = "Hello";
+  EXPECT_EQ("Hello", NextToken(line, " "));
+  EXPECT_TRUE(line.empty());
+}
+
+TEST(StringTest, TestNextTokenOnWhitespaceAndTab) {
+  static constexpr auto kTokens = [] {
+    std::string_view line = "\t vt 0.707 0.395\t0.684 ";
+    std::array<std::string_view, 5> tokens;
+    for (auto& token : tokens) token = NextToken(line, " \t");
+    return tokens;
+  }();
+  static_assert(std::array<std::string_view, 5>{"vt", "0.707", "0.395", "0.684", ""} == kTokens);
+}
+
+TEST(ObjLoaderTest, TestParseEmptyToken) { EXPECT_THROW(ParseToken<int>(""), std::invalid_argument); }
+
+TEST(ObjLoaderTest, TestParseInvalidToken) {
+  EXPECT_THROW(ParseToken<float>("Definitely a float"), std::invalid_argument);
+}
+
+TEST(ObjLoaderTest, TestParseIntToken) { EXPECT_EQ(42, ParseToken<int>("42")); }
+
+TEST(ObjLoaderTest, TestParseFloatToken) { EXPECT_FLOAT_EQ(3.14f, ParseToken<float>("3.14")); }
+
+TEST(ObjLoaderTest, TestParseFloatTokenMatchesGeneralConversion) {
+  std::mt19937 random_engine{0};  // NOLINT(cert-msc32-c, cert-msc51-cpp)
+  std::uniform_int_distribution<std::uint64_t> mantissa_distribution{0, (std::uint64_t{1} << 54u) - 1};
+  std::uniform_int_distribution<int> digit_distribution{0, 20};
+  std::uniform_int_distribution<int> exponent_distribution{-45, 40};
+
+  std::vector<std::string> tokens{"0", "-0.0", "1e0", "1E+2", "2.5e-3", "16777217", "-16777219", "0.1", "3.4028235e38"};
+  for (auto i = 0; i < 100'000; ++i) {
+    auto token = std::to_string(mantissa_distribution(random_engine) >> digit_distribution(random_engine));
+    if (const auto fraction_digit_count = digit_distribution(random_engine) % 10;
+        fraction_digit_count > 0 && static_cast<std::size_t>(fraction_digit_count) < token.size()) {
+      token.insert(token.size() - static_cast<std::size_t>(fraction_digit_count), ".");
+    }
+    if (i % 2 == 0) token += std::format("e{}", exponent_distribution(random_engine) / (i % 4 == 0 ? 1 : 4));
+    tokens.push_back(i % 3 == 0 ? "-" + token : token);
+  }
+
+  for (const auto& token : tokens) {
+    float expected_value{};
+    if (const auto [_, error_code] = std::from_chars(token.data(), token.data() + token.size(), expected_value);
+        error_code != std::errc{}) {
+      continue;  // out of range values are rejected by both conversions
+    }
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(expected_value), std::bit_cast<std::uint32_t>(ParseToken<float>(token)))
+        << token;
+  }
+}
+
+TEST(ObjLoaderTest, TestParseFloatTokenOutsideFastPath) {
+  EXPECT_FLOAT_EQ(0.5f, ParseToken<float>(".5"));
+  EXPECT_FLOAT_EQ(1.0f, ParseToken<float>("1.00000000000000000000001"));
+  EXPECT_FLOAT_EQ(1.0e-40f, ParseToken<float>("1e-40"));
+  EXPECT_THROW(ParseToken<float>("1e39"), std::invalid_argument);
+  EXPECT_THROW(ParseToken<float>("-"), std::invalid_argument);
+}
+
+TEST(ObjLoaderTest, TestParseEmptyLine) { EXPECT_THROW((ParseLine<float, 3>("")), std::invalid_argument); }
+
+TEST(ObjLoaderTest, TestParseLineWithInvalidSizeArgument) {
+  EXPECT_THROW((ParseLine<float, 2>("vt 0.707 0.395 0.684")), std::invalid_argument);
+}
+
+TEST(ObjLoaderTest, TestParseLine) {
+  EXPECT_EQ((glm::vec3{.707f, .395f, .684f}), (ParseLine<float, 3>("vt 0.707 0.395 0.684")));
+}
+
+TEST(ObjLoaderTest, TestParseIndexGroupWithPositionIndex) {
+  EXPECT_EQ((glm::ivec3{0, kInvalidFaceElementIndex, kInvalidFaceElementIndex}), ParseIndexGroup("1"));
+}
+
+TEST(ObjLoaderTest, TestParseIndexGroupWithPositionAndTextureCoordinatesIndices) {
+  EXPECT_EQ((glm::ivec3{0, 1, kInvalidFaceElementIndex}), ParseIndexGroup("1/2"));
+}
+
+TEST(ObjLoaderTest, TestParseIndexGroupWithPositionAndNormalIndices) {
+  EXPECT_EQ((glm::ivec3{0, kInvalidFaceElementIndex, 1}), ParseIndexGroup("1//2"));
+}
+
+TEST(ObjLoaderTest, TestParseIndexGroupWithPositionTextureCoordinateAndNormalIndices) {
+  EXPECT_EQ((glm::ivec3{0, 1, 2}), ParseIndexGroup("1/2/3"));
+}
+
+TEST(ObjLoaderTest, TestParseInvalidIndexGroup) {
+  EXPECT_THROW(ParseIndexGroup(""), std::invalid_argument);
+  EXPECT_THROW(ParseIndexGroup("1/2/3/4"), std::invalid_argument);
+  EXPECT_THROW(ParseIndexGroup("1///3"), std::invalid_argument);
+  EXPECT_THROW(ParseIndexGroup("/"), std::invalid_argument);
+  EXPECT_THROW(ParseIndexGroup("//"), std::invalid_argument);
+  EXPECT_THROW(ParseIndexGroup("1/"), std::invalid_argument);
+  EXPECT_THROW(ParseIndexGroup("/2"), std::invalid_argument);
+  EXPECT_THROW(ParseIndexGroup("1//"), std::invalid_argument);
+  EXPECT_THROW(ParseIndexGroup("/2/"), std::invalid_argument);
+  EXPECT_THROW(ParseIndexGroup("//3"), std::invalid_argument);
+  EXPECT_THROW(ParseIndexGroup("1/2/"), std::invalid_argument);
+  EXPECT_THROW(ParseIndexGroup("/2/3"), std::invalid_argument);
+}
+
+TEST(ObjLoaderTest, TestParseFaceWithInvalidNumberOfIndexGroups) {
+  EXPECT_THROW(ParseFace("f 1/2/3 4/5/6"), std::invalid_argument);
+  EXPECT_THROW(ParseFace("f 1/2/3 4/5/6 7/8/9 10/11/12"), std::invalid_argument);
+}
+
+TEST(ObjLoaderTest, TestParseFaceWithThreeIndexGroups) {
+  EXPECT_EQ((std::array{glm::ivec3{0, 1, 2}, glm::ivec3{3, 4, 5}, glm::ivec3{6, 7, 8}}),
+            ParseFace("f 1/2/3 4/5/6 7/8/9"));
+}
+
+TEST(ObjLoaderTest, TestLoadMeshWithoutFaceIndices) {
+  // clang-format off
+  std::istringstream ss{R"(
+    # positions
+    v 0.0 0.1 0.2
+    v 1.0 1.1 1.2
+    v 2.0 2.1 2.2
+    # texture coordinates
+    vt 3.0 3.1
+    vt 4.0 4.1
+    vt 5.0 5.1
+    # normals
+    vn 6.0 6.1 6.2
+    vn 7.0 7.1 7.2
+    vn 8.0 8.1 8.2
+  )"};
+  // clang-format on
+
+  const auto mesh = LoadMesh(ss);
+  static constexpr glm::vec3 kV0{0.0f, 0.1f, 0.2f}, kV1{1.0f, 1.1f, 1.2f}, kV2{2.0f, 2.1f, 2.2f};
+  static constexpr glm::vec2 kVt0{3.0f, 3.1f}, kVt1{4.0f, 4.1f}, kVt2{5.0f, 5.1f};
+  static constexpr glm::vec3 kVn0{6.0f, 6.1f, 6.2f}, kVn1{7.0f, 7.1f, 7.2f}, kVn2{8.0f, 8.1f, 8.2f};
+
+  EXPECT_EQ((std::vector{kV0, kV1, kV2}), mesh.positions());
+  EXPECT_EQ((std::vector{kVt0, kVt1, kVt2}), mesh.texcoords());
+  EXPECT_EQ((std::vector{kVn0, kVn1, kVn2}), mesh.normals());
+  EXPECT_TRUE(mesh.indices().empty());
+}
+
+TEST(ObjLoaderTest, TestLoadMeshWithFaceIndices) {
+  // clang-format off
+  std::istringstream ss{R"(
+    # positions
+    v 0.0 0.1 0.2
+    v 1.0 1.1 1.2
+    v 2.0 2.1 2.2
+    v 3.0 3.1 3.2
+    # texture coordinates
+    vt 4.0 4.1
+    vt 5.0 5.1
+    vt 6.0 6.1
+    vt 7.0 7.1
+    # normals
+    vn 8.0  8.1  8.2
+    vn 9.0  9.1  9.2
+    vn 10.0 10.1 10.2
+    # faces
+    f 1/4/2 2/1/3 3/2/1
+    f 1/2/2 2/1/3 4/3/1
+  )"};
+  // clang-format on
+
+  const auto mesh = LoadMesh(ss);
+  static constexpr glm::vec3 kV0{0.0f, 0.1f, 0.2f}, kV1{1.0f, 1.1f, 1.2f}, kV2{2.0f, 2.1f, 2.2f}, kV3{3.0f, 3.1f, 3.2f};
+  static constexpr glm::vec2 kVt0{4.0f, 4.1f}, kVt1{5.0f, 5.1f}, kVt2{6.0f, 6.1f}, kVt3{7.0f, 7.1f};
+  static constexpr glm::vec3 kVn0{8.0f, 8.1f, 8.2f}, kVn1{9.0f, 9.1f, 9.2f}, kVn2{10.0f, 10.1f, 10.2f};
+
+  EXPECT_EQ((std::vector{kV0, kV1, kV2, kV0, kV3}), mesh.positions());
+  EXPECT_EQ((std::vector{kVt3, kVt0, kVt1, kVt1, kVt2}), mesh.texcoords());
+  EXPECT_EQ((std::vector{kVn1, kVn2, kVn0, kVn1, kVn0}), mesh.normals());
+  EXPECT_EQ((std::vector{0u, 1u, 2u, 3u, 1u, 4u}), mesh.indices());
+}
+
+TEST(ObjLoaderTest, TestSplitChunksEndOnLineBoundaries) {
+  static constexpr std::string_view kContents = "v 0 0 0\nv 1 1 1\n\nf 1 2 3\nf 3 2 1";
+  for (std::size_t chunk_count = 1; chunk_count <= kContents.size(); ++chunk_count) {
+    const auto chunks = SplitChunks(kContents, chunk_count);
+    EXPECT_LE(chunks.size(), chunk_count);
+    std::string concatenated_chunks;
+    for (const auto chunk : chunks) concatenated_chunks += chunk;
+    EXPECT_EQ(kContents, concatenated_chunks);
+    for (std::size_t i = 0; i + 1 < chunks.size(); ++i) EXPECT_TRUE(chunks[i].ends_with('\n'));
+  }
+}
+
+TEST(ObjLoaderTest, TestLoadMeshInParallelMatchesSerialParser) {
+  const auto contents = CreateGridObj(32);
+  std::istringstream ss{contents};
+  const auto serial_mesh = LoadMesh(ss);
+  ASSERT_EQ(32 * 32 * 6, serial_mesh.indices().size());
+
+  for (const auto thread_count : {2u, 3u, 8u}) {
+    const auto parallel_mesh = LoadMesh(contents, thread_count, 64);
+    EXPECT_EQ(serial_mesh.positions(), parallel_mesh.positions());
+    EXPECT_EQ(serial_mesh.texcoords(), parallel_mesh.texcoords());
+    EXPECT_EQ(serial_mesh.normals(), parallel_mesh.normals());
+    EXPECT_EQ(serial_mesh.indices(), parallel_mesh.indices());
+  }
+}
+
+TEST(ObjLoaderTest, TestLoadMeshInParallelWithInvalidIndexThrowsException) {
+  auto contents = CreateGridObj(8);
+  contents += "f 1 2 1000\n";
+  EXPECT_THROW((void)LoadMesh(contents, 4, 64), std::out_of_range);
+}
+
+// Compares the throughput of the single-pass scanner on a single thread with the baseline that splits each line.
+// Run in a release build with --gtest_also_run_disabled_tests --gtest_filter=ObjLoaderTest.DISABLED_TestParseThroughput
+TEST(ObjLoaderTest, DISABLED_TestParseThroughput) {
+  std::mt19937 random_engine{0};  // NOLINT(cert-msc32-c, cert-msc51-cpp)
+  std::uniform_real_distribution<float> distribution{-100.0f, 100.0f};
+  std::string contents;
+  for (auto i = 0; i < 1'000'000; ++i) {
+    const glm::vec3 position{distribution(random_engine), distribution(random_engine), distribution(random_engine)};
+    contents += std::format("v {:.6f} {:.6f} {:.6f}\n", position.x, position.y, position.z);
+  }
+  contents += CreateGridObj(512);
+
+  const auto measure = [&contents](const auto& parse) {
+    static constexpr auto kIterations = 5;
+    ObjChunk chunk;
+    auto min_seconds = std::numeric_limits<double>::infinity();
+    for (auto i = 0; i < kIterations; ++i) {
+      const auto start_time = std::chrono::steady_clock::now();
+      chunk = parse();
+      const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+      min_seconds = std::min(min_seconds, duration.count());
+    }
+    return std::pair{chunk, static_cast<double>(contents.size()) / min_seconds / 1.0e6};
+  };
+
+  const auto [chunk, throughput] = measure([&contents] { return ParseChunk(contents); });
+  const auto [baseline_chunk, baseline_throughput] = measure([&contents] { return ParseChunkWithSplit(contents); });
+  EXPECT_EQ(baseline_chunk.positions, chunk.positions);
+  EXPECT_EQ(baseline_chunk.texcoords, chunk.texcoords);
+  EXPECT_EQ(baseline_chunk.normals, chunk.normals);
+  EXPECT_EQ(baseline_chunk.faces, chunk.faces);
+
+  std::clog << std::format("Parsed {:.1f} MB: single-pass scanner {:.0f} MB/s, split lines {:.0f} MB/s ({:.1f}x)\n",
+                           static_cast<double>(contents.size()) / 1.0e6,
+                           throughput,
+                           baseline_throughput,
+                           throughput / baseline_throughput);
+}
+
+TEST(ObjLoaderTest, TestLoadMeshWithWindowsLineEndings) {
+  std::istringstream ss{"v 0.0 0.1 0.2\r\nv 1.0 1.1 1.2\r\nv 2.0 2.1 2.2\r\nf 1 2 3\r\n"};
+  const auto mesh = LoadMesh(ss);
+  EXPECT_EQ((std::vector{glm::vec3{0.0f, 0.1f, 0.2f}, glm::vec3{1.0f, 1.1f, 1.2f}, glm::vec3{2.0f, 2.1f, 2.2f}}),
+            mesh.positions());
+  EXPECT_EQ((std::vector{0u, 1u, 2u}), mesh.indices());
+}
+
+TEST(ObjLoaderTest, TestLoadHalfEdgeMeshMatchesMesh) {
+  // every index group refers to a texture coordinate so that attributes align with vertex positions
+  auto contents = CreateGridObj(8);
+  for (auto i = contents.find("//"); i != std::string::npos; i = contents.find("//", i)) contents.replace(i, 2, "/1/");
+
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "obj_loader_test.obj";
+  std::ofstream{filepath, std::ios::binary} << contents;
+
+  std::stringstream expected_stream, actual_stream;
+  HalfEdgeMesh{obj_loader::LoadMesh(filepath)}.Write(expected_stream);
+  obj_loader::LoadHalfEdgeMesh(filepath, 2).Write(actual_stream);
+  std::filesystem::remove(filepath);
+  std::filesystem::remove(GetMeshCachePath(filepath));
+
+  EXPECT_EQ(expected_stream.str(), actual_stream.str());
+}
+
+TEST(ObjLoaderTest, TestLoadMeshFromMeshCache) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "obj_loader_cache_test.obj";
+  const auto mesh_cache_path = GetMeshCachePath(filepath);
+  std::ofstream{filepath, std::ios::binary} << "v 0.0 0.1 0.2\nv 1.0 1.1 1.2\nv 2.0 2.1 2.2\nf 1 2 3\n";
+
+  (void)obj_loader::LoadHalfEdgeMesh(filepath, 1);
+  ASSERT_TRUE(std::filesystem::exists(mesh_cache_path));
+
+  // a cache whose source matches the file is used in place of parsing it
+  const std::vector cached_positions{glm::vec3{3.0f}, glm::vec3{4.0f}, glm::vec3{5.0f}};
+  const std::vector<std::uint32_t> cached_indices{2, 1, 0};
+  MeshCache::Write(mesh_cache_path, MeshCache::GetSource(filepath), cached_positions, {}, {}, cached_indices);
+  auto mesh = obj_loader::LoadMesh(filepath, 1);
+  EXPECT_EQ(cached_positions, mesh.positions());
+  EXPECT_EQ(cached_indices, mesh.indices());
+
+  // a cache created from a different version of the file is replaced
+  std::ofstream{filepath, std::ios::binary | std::ios::app} << "# modified\n";
+  mesh = obj_loader::LoadMesh(filepath, 1);
+  EXPECT_EQ((std::vector{glm::vec3{0.0f, 0.1f, 0.2f}, glm::vec3{1.0f, 1.1f, 1.2f}, glm::vec3{2.0f, 2.1f, 2.2f}}),
+            mesh.positions());
+  EXPECT_EQ(MeshCache::GetSource(filepath), MeshCache{mesh_cache_path}.source());
+
+  // an invalid cache is ignored and replaced
+  std::ofstream{mesh_cache_path, std::ios::binary} << "invalid";
+  mesh = obj_loader::LoadMesh(filepath, 1);
+  EXPECT_EQ((std::vector{0u, 1u, 2u}), mesh.indices());
+  EXPECT_EQ(MeshCache::GetSource(filepath), MeshCache{mesh_cache_path}.source());
+
+  std::filesystem::remove(filepath);
+  std::filesystem::remove(mesh_cache_path);
+}
+
+TEST(ObjLoaderTest, TestLoadMeshFromPlyFile) {
+  // the backend is chosen by file signature rather than by extension
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "obj_loader_ply_test.obj";
+  const std::vector positions{glm::vec3{0.0f, 0.1f, 0.2f}, glm::vec3{1.0f, 1.1f, 1.2f}, glm::vec3{2.0f, 2.1f, 2.2f}};
+  const std::vector<std::uint32_t> indices{0, 1, 2};
+  ply::Write(filepath, positions, {}, {}, indices);
+
+  const auto mesh = obj_loader::LoadMesh(filepath, 1);
+  std::filesystem::remove(filepath);
+  std::filesystem::remove(GetMeshCachePath(filepath));
+
+  EXPECT_EQ(positions, mesh.positions());
+  EXPECT_EQ(indices, mesh.indices());
+}
+
+TEST(ObjLoaderTest, TestLoadHalfEdgeMeshFromMissingFileThrowsException) {
+  EXPECT_THROW((void)obj_loader::LoadHalfEdgeMesh(std::filesystem::path{testing::TempDir()} / "missing.obj"),
+               std::runtime_error);
+}
+
+TEST(ObjLoaderTest, TestLoadHalfEdgeMeshesMatchesLoadHalfEdgeMesh) {
+  std::vector<std::filesystem::path> filepaths;
+  std::vector<std::string> expected_meshes;
+  for (const auto size : {4, 1, 16, 8}) {
+    const auto& filepath = filepaths.emplace_back(std::filesystem::path{testing::TempDir()}
+                                                  / std::format("obj_loader_batch_test{}.obj", size));
+    // every index group refers to a texture coordinate so that attributes align with vertex positions
+    auto contents = CreateGridObj(size);
+    for (auto i = contents.find("//"); i != std::string::npos; i = contents.find("//", i)) {
+      contents.replace(i, 2, "/1/");
+    }
+    std::ofstream{filepath, std::ios::binary} << contents;
+    std::stringstream ss;
+    obj_loader::LoadHalfEdgeMesh(filepath, 1).Write(ss);
+    expected_meshes.push_back(ss.str());
+    std::filesystem::remove(GetMeshCachePath(filepath));
+  }
+
+  for (const auto use_io_uring : {true, false}) {
+    BatchIoOptions io_options;
+    io_options.queue_depth = 2;
+    io_options.use_io_uring = use_io_uring;
+    const auto half_edge_meshes = obj_loader::LoadHalfEdgeMeshes(filepaths, io_options, 2);
+    ASSERT_EQ(filepaths.size(), half_edge_meshes.size());
+    for (std::size_t i = 0; i < half_edge_meshes.size(); ++i) {
+      std::stringstream ss;
+      half_edge_meshes[i].Write(ss);
+      EXPECT_EQ(expected_meshes[i], ss.str());
+    }
+  }
+
+  for (const auto& filepath : filepaths) {
+    EXPECT_FALSE(std::filesystem::exists(GetMeshCachePath(filepath)));
+    std::filesystem::remove(filepath);
+  }
+}
+
+TEST(ObjLoaderTest, TestLoadHalfEdgeMeshWeldsSplitVertices) {
+  // each triangle of the quad has its own copy of the shared positions written with limited precision
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "obj_loader_weld_test.obj";
+  std::ofstream{filepath, std::ios::binary} << "v 0 0 0\nv 1 0 0\nv 1 1 0\n"
+                                               "v 0.0000001 0 0\nv 1 0.9999999 0\nv 0 1 0\n"
+                                               "f 1 2 3\nf 4 5 6\n";
+
+  const auto half_edge_mesh = obj_loader::LoadHalfEdgeMesh(filepath, 2);
+  const auto welded_half_edge_mesh = obj_loader::LoadHalfEdgeMesh(filepath, WeldOptions{}, 2);
+  std::filesystem::remove(filepath);
+  std::filesystem::remove(GetMeshCachePath(filepath));
+
+  EXPECT_EQ(6, half_edge_mesh.vertices().size());
+  EXPECT_EQ(4, welded_half_edge_mesh.vertices().size());
+  EXPECT_EQ(2, welded_half_edge_mesh.faces().size());
+  EXPECT_EQ(10, welded_half_edge_mesh.edges().size());
+}
+
+TEST(ObjLoaderTest, TestLoadObjects) {
+  // clang-format off
+  static constexpr std::string_view kContents{R"(
+    v 0.0 0.0 0.0
+    v 1.0 0.0 0.0
+    v 1.0 1.0 0.0
+    v 0.0 1.0 0.0
+    vn 0.0 0.0 1.0
+    f 1//1 2//1 3//1
+    o quad
+    f 1//1 3//1 4//1
+    g  left side
+    f 4//1 1//1 2//1
+    o quad
+    f 2//1 3//1 4//1
+    g
+    o empty
+  )"};
+  // clang-format on
+
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "obj_loader_objects_test.obj";
+  std::ofstream{filepath, std::ios::binary} << kContents;
+  const auto objects = obj_loader::LoadObjects(filepath, 2);
+  std::filesystem::remove(filepath);
+
+  ASSERT_EQ(3, objects.size());
+  EXPECT_EQ("default", objects[0].name);
+  EXPECT_EQ("quad", objects[1].name);
+  EXPECT_EQ("left side", objects[2].name);
+
+  EXPECT_EQ((std::vector<glm::vec3>{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}}),
+            objects[0].mesh.positions());
+  EXPECT_EQ((std::vector<glm::vec3>{{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}),
+            objects[1].mesh.positions());
+  EXPECT_EQ((std::vector<std::uint32_t>{0, 1, 2, 3, 1, 2}), objects[1].mesh.indices());
+  EXPECT_EQ(4, objects[1].mesh.normals().size());
+  EXPECT_EQ((std::vector<std::uint32_t>{0, 1, 2}), objects[2].mesh.indices());
+}
+
+TEST(ObjLoaderTest, TestReadTriangles) {
+  // clang-format off
+  static constexpr std::string_view kContents{R"(
+    v 0.0 0.1 0.2
+    vt 4.0 4.1
+    vn 8.0 8.1 8.2
+    v 1.0 1.1 1.2
+    v 2.0 2.1 2.2
+    f 1/1/1 2/1/1 3/1/1
+    v 3.0 3.1 3.2
+    f 1 3 4
+  )"};
+  // clang-format on
+
+  std::vector<glm::vec3> positions;
+  std::vector<std::array<int, 3>> faces;
+  ReadTriangles(
+      kContents,
+      [&positions](const glm::vec3& position) { positions.push_back(position); },
+      [&faces](const std::array<int, 3>& face) { faces.push_back(face); });
+
+  static constexpr glm::vec3 kV0{0.0f, 0.1f, 0.2f}, kV1{1.0f, 1.1f, 1.2f}, kV2{2.0f, 2.1f, 2.2f}, kV3{3.0f, 3.1f, 3.2f};
+  EXPECT_EQ((std::vector{kV0, kV1, kV2, kV3}), positions);
+  EXPECT_EQ((std::vector{std::array{0, 1, 2}, std::array{0, 2, 3}}), faces);
+}
+
+}  // namespace
@@ -0,0 +1,144 @@
+#include "io/obj_writer.cpp"  // NOLINT
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "io/obj_loader.h"
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+/** @brief Reads the contents of a file written by the test and removes it. */
+std::string ReadAndRemove(const std::filesystem::path& filepath) {
+  std::string contents;
+  {
+    std::ifstream ifs{filepath, std::ios::binary};
+    contents.assign(std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{});
+  }
+  std::filesystem::remove(filepath);
+  return contents;
+}
+
+TEST(ObjWriterTest, TestWriteMeshWithoutVertexAttributes) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "obj_writer_test.obj";
+  const std::vector positions{glm::vec3{0.0f, 0.1f, -2.5f}, glm::vec3{1.0f, 1e-7f, 3.0f}, glm::vec3{1e20f, 0.0f, 0.0f}};
+  const std::vector<std::uint32_t> indices{0, 1, 2};
+
+  obj_writer::WriteMesh(filepath, positions, {}, {}, indices, 1);
+  EXPECT_EQ("v 0 0.1 -2.5\nv 1 1e-07 3\nv 1e+20 0 0\nf 1 2 3\n", ReadAndRemove(filepath));
+}
+
+TEST(ObjWriterTest, TestWriteMeshWithVertexAttributes) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "obj_writer_test.obj";
+  const std::vector positions{glm::vec3{0.0f}, glm::vec3{1.0f}, glm::vec3{2.0f}};
+  const std::vector normals{glm::vec3{0.0f, 0.0f, 1.0f}, glm::vec3{0.0f, 1.0f, 0.0f}, glm::vec3{1.0f, 0.0f, 0.0f}};
+  const std::vector texcoords{glm::vec2{0.0f, 0.5f}, glm::vec2{1.0f, 0.5f}, glm::vec2{0.5f, 1.0f}};
+  const std::vector<std::uint32_t> indices{0, 1, 2};
+
+  obj_writer::WriteMesh(filepath, positions, normals, {}, indices, 1);
+  EXPECT_EQ("v 0 0 0\nv 1 1 1\nv 2 2 2\nvn 0 0 1\nvn 0 1 0\nvn 1 0 0\nf 1//1 2//2 3//3\n", ReadAndRemove(filepath));
+
+  obj_writer::WriteMesh(filepath, positions, normals, texcoords, indices, 1);
+  EXPECT_EQ(
+      "v 0 0 0\nv 1 1 1\nv 2 2 2\nvt 0 0.5\nvt 1 0.5\nvt 0.5 1\nvn 0 0 1\nvn 0 1 0\nvn 1 0 0\n"
+      "f 1/1/1 2/2/2 3/3/3\n",
+      ReadAndRemove(filepath));
+}
+
+TEST(ObjWriterTest, TestWriteMeshInParallelMatchesSerialWriter) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "obj_writer_test.obj";
+  std::vector<glm::vec3> positions;
+  std::vector<std::uint32_t> indices;
+  for (std::uint32_t i = 0; i < 3 * kChunkSize; ++i) {
+    positions.emplace_back(static_cast<float>(i) * 0.1f, -static_cast<float>(i), 1.0f / static_cast<float>(i + 1));
+    indices.push_back((i * 7u) % (3 * kChunkSize));
+  }
+
+  obj_writer::WriteMesh(filepath, positions, {}, {}, indices, 1);
+  const auto serial_contents = ReadAndRemove(filepath);
+  obj_writer::WriteMesh(filepath, positions, {}, {}, indices, 4);
+  EXPECT_EQ(serial_contents, ReadAndRemove(filepath));
+}
+
+TEST(ObjWriterTest, TestLoadWrittenMeshReproducesValues) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "obj_writer_roundtrip_test.obj";
+  const std::vector positions{glm::vec3{0.1f, -0.2f, 0.3f},
+                              glm::vec3{std::numeric_limits<float>::max(), std::numeric_limits<float>::min(), 1.0f},
+                              glm::vec3{-std::numeric_limits<float>::denorm_min(), 1.0f / 3.0f, 2.0f / 3.0f},
+                              glm::vec3{123456.789f, -9.87654e-5f, 0.0f}};
+  const std::vector normals{glm::vec3{0.0f, 0.0f, 1.0f},
+                            glm::vec3{0.0f, 0.6f, 0.8f},
+                            glm::vec3{0.6f, 0.0f, 0.8f},
+                            glm::vec3{0.0f, 0.8f, 0.6f}};
+  const std::vector texcoords{glm::vec2{0.0f}, glm::vec2{0.1f}, glm::vec2{0.2f}, glm::vec2{0.3f}};
+  const std::vector<std::uint32_t> indices{0, 1, 2, 2, 1, 3};
+
+  obj_writer::WriteMesh(filepath, positions, normals, texcoords, indices, 2);
+  const auto mesh = obj_loader::LoadMesh(filepath, 1);
+  std::filesystem::remove(filepath);
+  std::filesystem::remove(std::filesystem::path{filepath} += ".meshcache");
+
+  EXPECT_EQ(positions, mesh.positions());
+  EXPECT_EQ(normals, mesh.normals());
+  EXPECT_EQ(texcoords, mesh.texcoords());
+  EXPECT_EQ(indices, mesh.indices());
+}
+
+TEST(ObjWriterTest, TestWriteMeshes) {
+  std::vector<MeshData> meshes;
+  const std::vector normals{glm::vec3{0.0f, 0.0f, 1.0f}, glm::vec3{0.0f, 1.0f, 0.0f}, glm::vec3{1.0f, 0.0f, 0.0f}};
+  meshes.push_back(MeshData{std::vector{glm::vec3{0.0f}, glm::vec3{1.0f}, glm::vec3{2.0f}},
+                            {},
+                            {},
+                            std::vector<std::uint32_t>{0, 1, 2}});
+  meshes.push_back(MeshData{std::vector{glm::vec3{0.5f}, glm::vec3{1.5f}, glm::vec3{2.5f}},
+                            normals,
+                            {},
+                            std::vector<std::uint32_t>{2, 1, 0}});
+  const std::vector filepaths{std::filesystem::path{testing::TempDir()} / "obj_writer_batch_test0.obj",
+                              std::filesystem::path{testing::TempDir()} / "obj_writer_batch_test1.obj"};
+
+  obj_writer::WriteMeshes(filepaths, meshes, {}, 2);
+  EXPECT_EQ("v 0 0 0\nv 1 1 1\nv 2 2 2\nf 1 2 3\n", ReadAndRemove(filepaths[0]));
+  EXPECT_EQ("v 0.5 0.5 0.5\nv 1.5 1.5 1.5\nv 2.5 2.5 2.5\nvn 0 0 1\nvn 0 1 0\nvn 1 0 0\nf 3//3 2//2 1//1\n",
+            ReadAndRemove(filepaths[1]));
+
+  EXPECT_THROW(obj_writer::WriteMeshes(std::span{filepaths}.first(1), meshes), std::invalid_argument);
+}
+
+TEST(ObjWriterTest, TestFormatPartsReferringToEarlierVertices) {
+  const std::vector first_positions{glm::vec3{0.0f}, glm::vec3{1.0f, 0.0f, 0.0f}, glm::vec3{0.0f, 1e-7f, 0.0f}};
+  const std::vector<std::uint32_t> first_indices{0, 1, 2};
+  const std::vector second_positions{glm::vec3{1.0f, 1.0f, 0.5f}};
+  const std::vector<std::uint32_t> second_indices{1, 3, 2};
+
+  EXPECT_EQ("v 0 0 0\nv 1 0 0\nv 0 1e-07 0\nf 1 2 3\n", obj_writer::FormatPart(first_positions, first_indices, 0));
+  EXPECT_EQ("v 1 1 0.5\nf 2 4 3\n", obj_writer::FormatPart(second_positions, second_indices, 3));
+  EXPECT_THROW(std::ignore = obj_writer::FormatPart(second_positions, second_indices, 2), std::invalid_argument);
+}
+
+TEST(ObjWriterTest, TestWriteInvalidMeshThrowsException) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "obj_writer_test.obj";
+  const std::vector positions{glm::vec3{0.0f}, glm::vec3{1.0f}, glm::vec3{2.0f}};
+  const std::vector normals{glm::vec3{1.0f}};
+  const std::vector<std::uint32_t> indices{0, 1, 2};
+  const std::vector<std::uint32_t> invalid_indices{0, 1, 3};
+
+  EXPECT_THROW(obj_writer::WriteMesh(filepath, positions, {}, {}, std::span{indices}.first(2)), std::invalid_argument);
+  EXPECT_THROW(obj_writer::WriteMesh(filepath, positions, normals, {}, indices), std::invalid_argument);
+  EXPECT_THROW(obj_writer::WriteMesh(filepath, positions, {}, {}, invalid_indices), std::invalid_argument);
+  EXPECT_FALSE(std::filesystem::exists(filepath));
+}
+
+}  // namespace
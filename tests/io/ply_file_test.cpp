@@ -0,0 +1,155 @@
+#include "io/ply_file.cpp"  // NOLINT
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "io/mapped_file.h"
+
+namespace {
+
+using namespace gfx;  // NOLINT
+
+/** @brief Appends the bytes of a value to the contents of a PLY file in the specified byte order. */
+template <typename T>
+void Append(std::string& contents, const T value, const bool is_big_endian = false) {
+  auto bytes = std::bit_cast<std::array<char, sizeof(T)>>(value);
+  if (is_big_endian != (std::endian::native == std::endian::big)) std::ranges::reverse(bytes);
+  contents.append(bytes.data(), bytes.size());
+}
+
+TEST(PlyFileTest, TestHasSignature) {
+  EXPECT_TRUE(ply::HasSignature("ply\nformat binary_little_endian 1.0\n"));
+  EXPECT_TRUE(ply::HasSignature("ply\r\nformat binary_little_endian 1.0\r\n"));
+  EXPECT_FALSE(ply::HasSignature("v 0.0 0.1 0.2\n"));
+  EXPECT_FALSE(ply::HasSignature("plywood\n"));
+}
+
+TEST(PlyFileTest, TestReadLittleEndianTriangles) {
+  std::string contents{
+      "ply\n"
+      "format binary_little_endian 1.0\n"
+      "comment written by a scanner\n"
+      "element vertex 3\n"
+      "property float x\n"
+      "property float y\n"
+      "property float z\n"
+      "element face 1\n"
+      "property list uchar int vertex_indices\n"
+      "end_header\n"};
+  for (const auto value : {0.0f, 0.1f, 0.2f, 1.0f, 1.1f, 1.2f, 2.0f, 2.1f, 2.2f}) Append(contents, value);
+  Append<std::uint8_t>(contents, 3);
+  for (const auto index : {0, 1, 2}) Append(contents, index);
+
+  const auto [positions, normals, texcoords, indices] = ply::Read(contents);
+  EXPECT_EQ((std::vector{glm::vec3{0.0f, 0.1f, 0.2f}, glm::vec3{1.0f, 1.1f, 1.2f}, glm::vec3{2.0f, 2.1f, 2.2f}}),
+            positions);
+  EXPECT_TRUE(normals.empty());
+  EXPECT_TRUE(texcoords.empty());
+  EXPECT_EQ((std::vector<std::uint32_t>{0, 1, 2}), indices);
+}
+
+TEST(PlyFileTest, TestReadBigEndianPolygonsWithOtherProperties) {
+  std::string contents{
+      "ply\r\n"
+      "format binary_big_endian 1.0\r\n"
+      "element vertex 4\r\n"
+      "property double x\r\n"
+      "property double y\r\n"
+      "property double z\r\n"
+      "property uchar red\r\n"
+      "property float u\r\n"
+      "property float v\r\n"
+      "element material 1\r\n"
+      "property list uchar float coefficients\r\n"
+      "element face 1\r\n"
+      "property uchar flags\r\n"
+      "property list ushort uint vertex_index\r\n"
+      "end_header\r\n"};
+  for (auto i = 0; i < 4; ++i) {
+    for (const auto value : {static_cast<double>(i), 1.0, 2.0}) Append(contents, value, true);
+    Append<std::uint8_t>(contents, 255, true);
+    Append(contents, 0.5f * static_cast<float>(i), true);
+    Append(contents, 0.25f, true);
+  }
+  Append<std::uint8_t>(contents, 2, true);
+  Append(contents, 1.0f, true);
+  Append(contents, 2.0f, true);
+  Append<std::uint8_t>(contents, 7, true);
+  Append<std::uint16_t>(contents, 4, true);
+  for (const auto index : {0u, 1u, 2u, 3u}) Append(contents, index, true);
+
+  const auto [positions, normals, texcoords, indices] = ply::Read(contents);
+  ASSERT_EQ(4, positions.size());
+  EXPECT_EQ((glm::vec3{3.0f, 1.0f, 2.0f}), positions[3]);
+  EXPECT_TRUE(normals.empty());
+  const std::vector expected_texcoords{
+      glm::vec2{0.0f, 0.25f}, glm::vec2{0.5f, 0.25f}, glm::vec2{1.0f, 0.25f}, glm::vec2{1.5f, 0.25f}};
+  EXPECT_EQ(expected_texcoords, texcoords);
+  EXPECT_EQ((std::vector<std::uint32_t>{0, 1, 2, 0, 2, 3}), indices);
+}
+
+TEST(PlyFileTest, TestWriteAndReadPlyFile) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "ply_file_test.ply";
+  const std::vector positions{glm::vec3{0.0f, 0.1f, 0.2f}, glm::vec3{1.0f, 1.1f, 1.2f}, glm::vec3{2.0f, 2.1f, 2.2f}};
+  const std::vector normals{glm::vec3{0.0f, 0.0f, 1.0f}, glm::vec3{0.0f, 1.0f, 0.0f}, glm::vec3{1.0f, 0.0f, 0.0f}};
+  const std::vector texcoords{glm::vec2{0.0f, 0.0f}, glm::vec2{1.0f, 0.0f}, glm::vec2{0.0f, 1.0f}};
+  const std::vector<std::uint32_t> indices{0, 1, 2, 2, 1, 0};
+
+  ply::Write(filepath, positions, normals, texcoords, indices);
+  const auto indexed_triangles = [&] {
+    const MappedFile mapped_file{filepath};
+    return ply::Read(mapped_file.contents());
+  }();
+  std::filesystem::remove(filepath);
+
+  EXPECT_EQ(positions, indexed_triangles.positions);
+  EXPECT_EQ(normals, indexed_triangles.normals);
+  EXPECT_EQ(texcoords, indexed_triangles.texcoords);
+  EXPECT_EQ(indices, indexed_triangles.indices);
+}
+
+TEST(PlyFileTest, TestWriteMisalignedAttributesThrowsException) {
+  const auto filepath = std::filesystem::path{testing::TempDir()} / "ply_file_test.ply";
+  const std::vector positions{glm::vec3{0.0f}, glm::vec3{1.0f}, glm::vec3{2.0f}};
+  const std::vector normals{glm::vec3{1.0f}};
+  const std::vector<std::uint32_t> indices{0, 1, 2};
+  EXPECT_THROW(ply::Write(filepath, positions, normals, {}, indices), std::invalid_argument);
+  EXPECT_THROW(ply::Write(filepath, positions, {}, {}, std::span{indices}.first(2)), std::invalid_argument);
+}
+
+TEST(PlyFileTest, TestReadUnsupportedFormatThrowsException) {
+  EXPECT_THROW((void)ply::Read("ply\nformat ascii 1.0\nelement vertex 0\nend_header\n"), std::invalid_argument);
+  EXPECT_THROW((void)ply::Read("ply\nformat binary_little_endian 1.0\nelement vertex 0\n"), std::invalid_argument);
+  EXPECT_THROW((void)ply::Read("ply\nformat binary_little_endian 1.0\nend_header\n"), std::invalid_argument);
+  EXPECT_THROW((void)ply::Read("ply\nformat binary_little_endian 1.0\nelement vertex 1\nproperty half x\nend_header\n"),
+               std::invalid_argument);
+}
+
+TEST(PlyFileTest, TestReadTruncatedDataThrowsException) {
+  std::string contents{
+      "ply\nformat binary_little_endian 1.0\nelement vertex 2\n"
+      "property float x\nproperty float y\nproperty float z\nend_header\n"};
+  for (const auto value : {0.0f, 0.1f, 0.2f, 1.0f}) Append(contents, value);
+  EXPECT_THROW((void)ply::Read(contents), std::invalid_argument);
+}
+
+TEST(PlyFileTest, TestReadInvalidIndexThrowsException) {
+  std::string contents{
+      "ply\nformat binary_little_endian 1.0\nelement vertex 1\n"
+      "property float x\nproperty float y\nproperty float z\n"
+      "element face 1\nproperty list uchar int vertex_indices\nend_header\n"};
+  for (const auto value : {0.0f, 0.1f, 0.2f}) Append(contents, value);
+  Append<std::uint8_t>(contents, 3);
+  for (const auto index : {0, 0, -1}) Append(contents, index);
+  EXPECT_THROW((void)ply::Read(contents), std::invalid_argument);
+}
+
+}  // namespace
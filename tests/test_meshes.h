@@ -0,0 +1,93 @@
+#ifndef TEST_MESHES_H_
+#define TEST_MESHES_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "geometry/mesh_data.h"
+
+namespace gfx::test {
+
+/**
+ * @brief Creates a square grid of triangles with two triangles per cell.
+ * @param size The number of cells along each side of the grid.
+ * @param get_height Gets the z-coordinate of the grid vertex at an xy position.
+ * @return An open mesh whose boundary is the perimeter of the grid.
+ */
+template <typename F>
+MeshData CreateGrid(const int size, const F& get_height) {
+  std::vector<glm::vec3> positions;
+  for (auto y = 0; y <= size; ++y) {
+    for (auto x = 0; x <= size; ++x) {
+      const glm::vec2 xy{static_cast<float>(x), static_cast<float>(y)};
+      positions.emplace_back(xy, get_height(xy));
+    }
+  }
+
+  std::vector<std::uint32_t> indices;
+  for (auto y = 0; y < size; ++y) {
+    for (auto x = 0; x < size; ++x) {
+      const auto v0 = static_cast<std::uint32_t>(y * (size + 1) + x);
+      const auto v1 = v0 + 1;
+      const auto v2 = v0 + static_cast<std::uint32_t>(size) + 1;
+      const auto v3 = v2 + 1;
+      indices.insert(indices.end(), {v0, v1, v3, v0, v3, v2});
+    }
+  }
+
+  return MeshData{positions, {}, {}, indices};
+}
+
+/** @brief Creates a planar grid of unit squares each split into two triangles. */
+inline MeshData CreateGridMesh(const int size) {
+  return CreateGrid(size, [](const glm::vec2&) { return 0.0f; });
+}
+
+/** @brief Creates a square grid on a paraboloid with two triangles per cell. */
+inline MeshData CreateParaboloidGrid(const int size) {
+  return CreateGrid(size, [](const glm::vec2& xy) { return 0.1f * glm::dot(xy, xy); });
+}
+
+/** @brief Creates a closed mesh by subdividing each face of an octahedron and projecting vertices onto a sphere. */
+inline MeshData CreateSubdividedOctahedron(const int subdivisions) {
+  std::vector<glm::vec3> positions{{1.0f, 0.0f, 0.0f},
+                                   {-1.0f, 0.0f, 0.0f},
+                                   {0.0f, 1.0f, 0.0f},
+                                   {0.0f, -1.0f, 0.0f},
+                                   {0.0f, 0.0f, 1.0f},
+                                   {0.0f, 0.0f, -1.0f}};
+  std::vector<std::uint32_t> indices{0, 2, 4, 2, 1, 4, 1, 3, 4, 3, 0, 4, 2, 0, 5, 1, 2, 5, 3, 1, 5, 0, 3, 5};
+
+  for (auto i = 0; i < subdivisions; ++i) {
+    std::map<std::pair<std::uint32_t, std::uint32_t>, std::uint32_t> midpoints;
+    const auto get_midpoint = [&](const std::uint32_t v0, const std::uint32_t v1) {
+      const auto [iterator, inserted] =
+          midpoints.try_emplace(std::minmax(v0, v1), static_cast<std::uint32_t>(positions.size()));
+      if (inserted) positions.push_back(glm::normalize(positions[v0] + positions[v1]));
+      return iterator->second;
+    };
+
+    std::vector<std::uint32_t> subdivided_indices;
+    for (std::size_t j = 0; j < indices.size(); j += 3) {
+      const auto v0 = indices[j];
+      const auto v1 = indices[j + 1];
+      const auto v2 = indices[j + 2];
+      const auto v01 = get_midpoint(v0, v1);
+      const auto v12 = get_midpoint(v1, v2);
+      const auto v20 = get_midpoint(v2, v0);
+      subdivided_indices.insert(subdivided_indices.end(), {v0, v01, v20, v01, v1, v12, v20, v12, v2, v01, v12, v20});
+    }
+    indices = std::move(subdivided_indices);
+  }
+
+  return MeshData{positions, {}, {}, indices};
+}
+
+}  // namespace gfx::test
+
+#endif  // TEST_MESHES_H_